@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/batched_gemm/include/batched_gemm.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomValues(std::size_t size, std::mt19937& gen) {
+  std::uniform_real_distribution<T> dist(-1, 1);
+  std::vector<T> values(size);
+  for (auto& value : values) {
+    value = dist(gen);
+  }
+  return values;
+}
+
+// Multiplies a batch whose matrices have leading dimensions wider than their rows and gaps between them, and checks
+// every product against a plain loop nest in double as well as that padding and gaps keep their guard value.
+template <typename T>
+void CheckBatch(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, double tolerance) {
+  std::mt19937 gen(static_cast<unsigned>((batch * 31) + (m * 13) + (n * 7) + k));
+  const std::size_t lda = k + 1;
+  const std::size_t ldb = n + 2;
+  const std::size_t ldc = n + 3;
+  const std::size_t stride_a = (m * lda) + 5;
+  const std::size_t stride_b = (k * ldb) + 1;
+  const std::size_t stride_c = (m * ldc) + 4;
+  const std::vector<T> a = RandomValues<T>(batch * stride_a, gen);
+  const std::vector<T> b = RandomValues<T>(batch * stride_b, gen);
+  const std::vector<T> c_initial = RandomValues<T>(batch * stride_c, gen);
+  std::vector<T> c = c_initial;
+
+  ppc::core::GemmStridedBatched(batch, m, n, k, a.data(), lda, stride_a, b.data(), ldb, stride_b, c.data(), ldc,
+                                stride_c);
+
+  for (std::size_t s = 0; s < batch; ++s) {
+    for (std::size_t offset = 0; offset < stride_c; ++offset) {
+      const std::size_t i = offset / ldc;
+      const std::size_t j = offset % ldc;
+      const std::size_t index = (s * stride_c) + offset;
+      if (i >= m || j >= n) {
+        ASSERT_EQ(c[index], c_initial[index]) << s << ' ' << offset;
+        continue;
+      }
+      double expected = c_initial[index];
+      for (std::size_t p = 0; p < k; ++p) {
+        expected += static_cast<double>(a[(s * stride_a) + (i * lda) + p]) * b[(s * stride_b) + (p * ldb) + j];
+      }
+      ASSERT_NEAR(c[index], expected, tolerance * static_cast<double>(k + 1)) << s << ' ' << i << ' ' << j;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(batched_gemm_tests, fixed_sizes_are_square_only) {
+  for (const std::size_t size : ppc::core::kFixedGemmSizes) {
+    EXPECT_TRUE(ppc::core::HasFixedSizeGemm(size, size, size));
+  }
+  EXPECT_FALSE(ppc::core::HasFixedSizeGemm(5, 5, 5));
+  EXPECT_FALSE(ppc::core::HasFixedSizeGemm(8, 8, 16));
+  EXPECT_FALSE(ppc::core::HasFixedSizeGemm(128, 128, 128));
+}
+
+TEST(batched_gemm_tests, every_fixed_size) {
+  for (const std::size_t size : ppc::core::kFixedGemmSizes) {
+    CheckBatch<double>(3, size, size, size, 1e-13);
+  }
+}
+
+TEST(batched_gemm_tests, every_fixed_size_float) {
+  for (const std::size_t size : ppc::core::kFixedGemmSizes) {
+    CheckBatch<float>(3, size, size, size, 1e-5);
+  }
+}
+
+TEST(batched_gemm_tests, sizes_without_fixed_kernel) {
+  CheckBatch<double>(4, 1, 1, 1, 1e-13);
+  CheckBatch<double>(4, 5, 5, 5, 1e-13);
+  CheckBatch<double>(4, 13, 13, 13, 1e-13);
+  CheckBatch<double>(2, 70, 70, 70, 1e-13);
+}
+
+TEST(batched_gemm_tests, rectangular) {
+  CheckBatch<double>(5, 4, 8, 16, 1e-13);
+  CheckBatch<double>(5, 3, 17, 9, 1e-13);
+  CheckBatch<float>(5, 16, 4, 8, 1e-5);
+}
+
+TEST(batched_gemm_tests, large_batch) { CheckBatch<double>(1000, 4, 4, 4, 1e-13); }
+
+TEST(batched_gemm_tests, empty_batch_is_a_no_op) {
+  std::vector<double> c(16, 1.0);
+  ppc::core::GemmStridedBatched(0, 4, 4, 4, nullptr, 4, 16, nullptr, 4, 16, c.data(), 4, 16);
+  const double* none = nullptr;
+  ppc::core::GemmStridedBatched(1, 4, 4, 0, none, 4, 16, none, 4, 16, c.data(), 4, 16);
+  EXPECT_EQ(c, std::vector<double>(16, 1.0));
+}
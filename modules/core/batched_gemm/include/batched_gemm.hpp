@@ -0,0 +1,26 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace ppc::core {
+
+// Square sizes with a kernel whose loop bounds are compile-time constants.
+inline constexpr std::array<std::size_t, 8> kFixedGemmSizes = {4, 8, 12, 16, 24, 32, 48, 64};
+
+// Whether an m x k by k x n product is multiplied by one of the fixed-size kernels.
+bool HasFixedSizeGemm(std::size_t m, std::size_t n, std::size_t k);
+
+// C_i += A_i * B_i for i in [0, batch), where A_i starts at a + i * stride_a, B_i at b + i * stride_b and C_i at
+// c + i * stride_c; every matrix is row-major with the given leading dimension. Products of a size listed in
+// kFixedGemmSizes use an unrolled kernel for the instruction set Gemm would use, which skips Gemm's packing; tiny
+// products of other sizes use a plain loop nest and the rest Gemm.
+// Like Gemm, this runs on the calling thread: parallel callers hand each thread a slice of the batch.
+void GemmStridedBatched(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, const double* a,
+                        std::size_t lda, std::size_t stride_a, const double* b, std::size_t ldb, std::size_t stride_b,
+                        double* c, std::size_t ldc, std::size_t stride_c);
+void GemmStridedBatched(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, const float* a,
+                        std::size_t lda, std::size_t stride_a, const float* b, std::size_t ldb, std::size_t stride_b,
+                        float* c, std::size_t ldc, std::size_t stride_c);
+
+}  // namespace ppc::core
@@ -0,0 +1,197 @@
+#include "core/batched_gemm/include/batched_gemm.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+#include "core/gemm/include/gemm.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PPC_BATCHED_GEMM_GNU
+#if defined(__x86_64__) || defined(__i386__)
+#define PPC_BATCHED_GEMM_X86
+#endif
+#endif
+
+namespace {
+
+// Products without a fixed-size kernel are multiplied by a plain loop nest up to this size and by Gemm above it,
+// where packing already costs less than the loop nest loses.
+constexpr std::size_t kSmallSize = 6;
+
+template <typename T>
+void SmallGemm(std::size_t m, std::size_t n, std::size_t k, const T* a, std::size_t lda, const T* b,
+               std::size_t ldb, T* c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; ++i) {
+    T* c_row = c + (i * ldc);
+    for (std::size_t p = 0; p < k; ++p) {
+      const T a_ip = a[(i * lda) + p];
+      const T* b_row = b + (p * ldb);
+      for (std::size_t j = 0; j < n; ++j) {
+        c_row[j] += a_ip * b_row[j];
+      }
+    }
+  }
+}
+
+#ifdef PPC_BATCHED_GEMM_GNU
+// A fixed-size product is computed in tiles of up to kTileRows rows by two vectors, whose accumulators stay in
+// registers for the whole inner dimension: 8 of the 16 ymm or 32 zmm registers.
+constexpr std::size_t kTileRows = 4;
+constexpr std::size_t kTileVectors = 2;
+
+// GCC vector of kLanes elements that may be loaded from and stored to any address aligned for T.
+template <typename T, std::size_t kLanes>
+using Vector [[gnu::vector_size(kLanes * sizeof(T)), gnu::aligned(alignof(T))]] = T;
+
+// C += A * B for one small product on vectors of kVectorBytes. With M, N and K known at compile time every tile
+// loop is unrolled and no edge cases remain: a size not divisible by the full vector width uses narrower vectors.
+// Inlined into the kernels below, each compiled for its own instruction set.
+template <typename T, std::size_t kVectorBytes, std::size_t M, std::size_t N, std::size_t K>
+[[gnu::always_inline]] inline void FixedGemmBody(const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c,
+                                                 std::size_t ldc) {
+  constexpr std::size_t kLanes = std::gcd(N, kVectorBytes / sizeof(T));
+  constexpr std::size_t kVectors = std::gcd(N / kLanes, kTileVectors);
+  constexpr std::size_t kRows = std::gcd(M, kTileRows);
+  using V = Vector<T, kLanes>;
+  for (std::size_t i0 = 0; i0 < M; i0 += kRows) {
+    for (std::size_t j0 = 0; j0 < N; j0 += kVectors * kLanes) {
+      V acc[kRows][kVectors];
+#pragma GCC unroll 8
+      for (std::size_t i = 0; i < kRows; ++i) {
+#pragma GCC unroll 8
+        for (std::size_t v = 0; v < kVectors; ++v) {
+          acc[i][v] = *reinterpret_cast<const V*>(c + ((i0 + i) * ldc) + j0 + (v * kLanes));
+        }
+      }
+      for (std::size_t p = 0; p < K; ++p) {
+        V b_row[kVectors];
+#pragma GCC unroll 8
+        for (std::size_t v = 0; v < kVectors; ++v) {
+          b_row[v] = *reinterpret_cast<const V*>(b + (p * ldb) + j0 + (v * kLanes));
+        }
+#pragma GCC unroll 8
+        for (std::size_t i = 0; i < kRows; ++i) {
+          const T a_ip = a[((i0 + i) * lda) + p];
+#pragma GCC unroll 8
+          for (std::size_t v = 0; v < kVectors; ++v) {
+            acc[i][v] += a_ip * b_row[v];
+          }
+        }
+      }
+#pragma GCC unroll 8
+      for (std::size_t i = 0; i < kRows; ++i) {
+#pragma GCC unroll 8
+        for (std::size_t v = 0; v < kVectors; ++v) {
+          *reinterpret_cast<V*>(c + ((i0 + i) * ldc) + j0 + (v * kLanes)) = acc[i][v];
+        }
+      }
+    }
+  }
+}
+
+// The baseline instruction set has 16-byte vectors on x86-64 and on AArch64.
+template <typename T, std::size_t M, std::size_t N, std::size_t K>
+void FixedGemm(const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c, std::size_t ldc) {
+  FixedGemmBody<T, 16, M, N, K>(a, lda, b, ldb, c, ldc);
+}
+#else
+// Without GCC vectors the fixed sizes only save the dispatch on the sizes.
+template <typename T, std::size_t M, std::size_t N, std::size_t K>
+void FixedGemm(const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c, std::size_t ldc) {
+  SmallGemm(M, N, K, a, lda, b, ldb, c, ldc);
+}
+#endif  // PPC_BATCHED_GEMM_GNU
+
+#ifdef PPC_BATCHED_GEMM_X86
+template <typename T, std::size_t M, std::size_t N, std::size_t K>
+__attribute__((target("avx2,fma"))) void FixedGemmAvx2(const T* a, std::size_t lda, const T* b, std::size_t ldb,
+                                                       T* c, std::size_t ldc) {
+  FixedGemmBody<T, 32, M, N, K>(a, lda, b, ldb, c, ldc);
+}
+
+template <typename T, std::size_t M, std::size_t N, std::size_t K>
+__attribute__((target("avx512f"))) void FixedGemmAvx512(const T* a, std::size_t lda, const T* b, std::size_t ldb,
+                                                        T* c, std::size_t ldc) {
+  FixedGemmBody<T, 64, M, N, K>(a, lda, b, ldb, c, ldc);
+}
+#endif
+
+template <typename T>
+using FixedGemmFn = void (*)(const T* a, std::size_t lda, const T* b, std::size_t ldb, T* c, std::size_t ldc);
+
+template <typename T, std::size_t kSize>
+FixedGemmFn<T> SelectFixedKernel(ppc::core::GemmKernel kernel) {
+#ifdef PPC_BATCHED_GEMM_X86
+  switch (kernel) {
+    case ppc::core::GemmKernel::kAvx512:
+      return FixedGemmAvx512<T, kSize, kSize, kSize>;
+    case ppc::core::GemmKernel::kAvx2:
+      return FixedGemmAvx2<T, kSize, kSize, kSize>;
+    case ppc::core::GemmKernel::kScalar:
+      break;
+  }
+#endif
+  return FixedGemm<T, kSize, kSize, kSize>;
+}
+
+template <typename T, std::size_t... kIndex>
+std::array<FixedGemmFn<T>, sizeof...(kIndex)> MakeFixedKernels(ppc::core::GemmKernel kernel,
+                                                               std::index_sequence<kIndex...> /*unused*/) {
+  return {SelectFixedKernel<T, ppc::core::kFixedGemmSizes[kIndex]>(kernel)...};
+}
+
+// FixedKernels<T>()[i] multiplies matrices of size kFixedGemmSizes[i] with the instruction set Gemm uses.
+template <typename T>
+const std::array<FixedGemmFn<T>, ppc::core::kFixedGemmSizes.size()>& FixedKernels() {
+  static const auto kKernels = MakeFixedKernels<T>(ppc::core::BestGemmKernel(),
+                                                   std::make_index_sequence<ppc::core::kFixedGemmSizes.size()>{});
+  return kKernels;
+}
+
+template <typename T>
+void GemmStridedBatchedImpl(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, const T* a,
+                            std::size_t lda, std::size_t stride_a, const T* b, std::size_t ldb, std::size_t stride_b,
+                            T* c, std::size_t ldc, std::size_t stride_c) {
+  if (batch == 0 || m == 0 || n == 0) {
+    return;
+  }
+  // The kernel is chosen once for the whole batch
+  if (ppc::core::HasFixedSizeGemm(m, n, k)) {
+    const auto it = std::ranges::find(ppc::core::kFixedGemmSizes, m);
+    const FixedGemmFn<T> kernel =
+        FixedKernels<T>()[static_cast<std::size_t>(std::distance(ppc::core::kFixedGemmSizes.begin(), it))];
+    for (std::size_t i = 0; i < batch; ++i) {
+      kernel(a + (i * stride_a), lda, b + (i * stride_b), ldb, c + (i * stride_c), ldc);
+    }
+  } else if (std::max({m, n, k}) <= kSmallSize) {
+    for (std::size_t i = 0; i < batch; ++i) {
+      SmallGemm(m, n, k, a + (i * stride_a), lda, b + (i * stride_b), ldb, c + (i * stride_c), ldc);
+    }
+  } else {
+    for (std::size_t i = 0; i < batch; ++i) {
+      ppc::core::Gemm(m, n, k, a + (i * stride_a), lda, b + (i * stride_b), ldb, c + (i * stride_c), ldc);
+    }
+  }
+}
+
+}  // namespace
+
+bool ppc::core::HasFixedSizeGemm(std::size_t m, std::size_t n, std::size_t k) {
+  return m == n && n == k && std::ranges::find(kFixedGemmSizes, m) != kFixedGemmSizes.end();
+}
+
+void ppc::core::GemmStridedBatched(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, const double* a,
+                                   std::size_t lda, std::size_t stride_a, const double* b, std::size_t ldb,
+                                   std::size_t stride_b, double* c, std::size_t ldc, std::size_t stride_c) {
+  GemmStridedBatchedImpl(batch, m, n, k, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c);
+}
+
+void ppc::core::GemmStridedBatched(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, const float* a,
+                                   std::size_t lda, std::size_t stride_a, const float* b, std::size_t ldb,
+                                   std::size_t stride_b, float* c, std::size_t ldc, std::size_t stride_c) {
+  GemmStridedBatchedImpl(batch, m, n, k, a, lda, stride_a, b, ldb, stride_b, c, ldc, stride_c);
+}
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(std::size_t size, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> matrix(size);
+  for (auto& value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+template <typename To, typename From>
+std::vector<To> Convert(const std::vector<From>& values) {
+  return {values.begin(), values.end()};
+}
+
+void ReferenceGemm(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+                   std::size_t ldb, double* c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * ldc) + j] += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+    }
+  }
+}
+
+// Multiplies with every supported kernel into a C with a leading dimension wider than n and checks both the
+// product and that the padding columns are left untouched. In and Out are the element types of A, B and of C;
+// the reference is computed in double from the same In values.
+template <typename In = double, typename Out = In>
+void CheckAllKernels(std::size_t m, std::size_t n, std::size_t k, double tolerance = 1e-9) {
+  std::mt19937 gen(static_cast<unsigned>((m * 31) + (n * 17) + k));
+  const std::size_t lda = k + 3;
+  const std::size_t ldb = n + 5;
+  const std::size_t ldc = n + 7;
+  const std::vector<In> a = Convert<In>(RandomMatrix(m * lda, gen));
+  const std::vector<In> b = Convert<In>(RandomMatrix(k * ldb, gen));
+  const std::vector<Out> c0 = Convert<Out>(RandomMatrix(m * ldc, gen));
+
+  std::vector<double> expected = Convert<double>(c0);
+  const std::vector<double> a_ref = Convert<double>(a);
+  const std::vector<double> b_ref = Convert<double>(b);
+  ReferenceGemm(m, n, k, a_ref.data(), lda, b_ref.data(), ldb, expected.data(), ldc);
+
+  for (const auto kernel : {ppc::core::GemmKernel::kScalar, ppc::core::GemmKernel::kAvx2,
+                            ppc::core::GemmKernel::kAvx512}) {
+    if (!ppc::core::IsGemmKernelSupported(kernel)) {
+      continue;
+    }
+    std::vector<Out> c = c0;
+    ppc::core::Gemm(kernel, m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+    for (std::size_t i = 0; i < c.size(); ++i) {
+      ASSERT_NEAR(c[i], expected[i], tolerance * static_cast<double>(k + 1)) << ppc::core::GemmKernelName(kernel);
+    }
+  }
+}
+
+// Stores each operand of an m x k by k x n product in a buffer of its own layout and transpose, with a leading
+// dimension wider than needed, then multiplies through descriptors. Elements of C outside the operand must keep
+// their initial value.
+void CheckLayouts(std::size_t m, std::size_t n, std::size_t k) {
+  using ppc::core::MatrixDesc;
+  using ppc::core::MatrixLayout;
+  std::mt19937 gen(static_cast<unsigned>((m * 7) + (n * 5) + k));
+  const std::vector<double> a_ref = RandomMatrix(m * k, gen);
+  const std::vector<double> b_ref = RandomMatrix(k * n, gen);
+  const std::vector<double> c_ref = RandomMatrix(m * n, gen);
+  std::vector<double> expected = c_ref;
+  ReferenceGemm(m, n, k, a_ref.data(), k, b_ref.data(), n, expected.data(), n);
+
+  // Places a row-major rows x cols matrix into a buffer as described, leaving the other elements at `fill`
+  const auto place = [](const std::vector<double>& src, MatrixDesc desc, double fill) {
+    std::vector<double> buffer(desc.Span() + 3, fill);
+    for (std::size_t i = 0; i < desc.rows; ++i) {
+      for (std::size_t j = 0; j < desc.cols; ++j) {
+        buffer[desc.Offset(i, j)] = src[(i * desc.cols) + j];
+      }
+    }
+    return buffer;
+  };
+  for (const auto layout_a : {MatrixLayout::kRowMajor, MatrixLayout::kColumnMajor}) {
+    for (const auto layout_b : {MatrixLayout::kRowMajor, MatrixLayout::kColumnMajor}) {
+      for (const auto layout_c : {MatrixLayout::kRowMajor, MatrixLayout::kColumnMajor}) {
+        for (const bool transpose_a : {false, true}) {
+          for (const bool transpose_b : {false, true}) {
+            // The stored matrix of A is k x m if transposed; its contiguous dimension decides the minimum ld
+            MatrixDesc a_desc{.rows = m, .cols = k, .ld = 0, .transpose = transpose_a, .layout = layout_a};
+            a_desc.ld = (a_desc.RowStride() == 1 ? m : k) + 2;
+            MatrixDesc b_desc{.rows = k, .cols = n, .ld = 0, .transpose = transpose_b, .layout = layout_b};
+            b_desc.ld = (b_desc.RowStride() == 1 ? k : n) + 1;
+            const MatrixDesc c_desc{.rows = m,
+                                    .cols = n,
+                                    .ld = (layout_c == MatrixLayout::kRowMajor ? n : m) + 4,
+                                    .transpose = false,
+                                    .layout = layout_c};
+            ASSERT_TRUE(a_desc.IsValid() && b_desc.IsValid() && c_desc.IsValid());
+            const std::vector<double> a = place(a_ref, a_desc, 0.0);
+            const std::vector<double> b = place(b_ref, b_desc, 0.0);
+            const double guard = 12345.0;
+            std::vector<double> c = place(c_ref, c_desc, guard);
+            const std::vector<double> c0 = c;
+
+            ppc::core::Gemm(a_desc, a.data(), b_desc, b.data(), c_desc, c.data());
+
+            std::vector<bool> inside(c.size(), false);
+            for (std::size_t i = 0; i < m; ++i) {
+              for (std::size_t j = 0; j < n; ++j) {
+                inside[c_desc.Offset(i, j)] = true;
+                ASSERT_NEAR(c[c_desc.Offset(i, j)], expected[(i * n) + j], 1e-9 * static_cast<double>(k + 1));
+              }
+            }
+            for (std::size_t i = 0; i < c.size(); ++i) {
+              if (!inside[i]) {
+                ASSERT_EQ(c[i], c0[i]);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(gemm_tests, scalar_kernel_is_always_supported) {
+  EXPECT_TRUE(ppc::core::IsGemmKernelSupported(ppc::core::GemmKernel::kScalar));
+  EXPECT_TRUE(ppc::core::IsGemmKernelSupported(ppc::core::BestGemmKernel()));
+}
+
+TEST(gemm_tests, single_element) { CheckAllKernels(1, 1, 1); }
+
+TEST(gemm_tests, smaller_than_one_tile) { CheckAllKernels(3, 5, 7); }
+
+TEST(gemm_tests, exact_tiles) { CheckAllKernels(48, 64, 32); }
+
+TEST(gemm_tests, ragged_edges) { CheckAllKernels(37, 53, 29); }
+
+TEST(gemm_tests, crosses_all_cache_blocks) { CheckAllKernels(211, 2100, 300); }
+
+TEST(gemm_tests, zero_inner_dimension_keeps_c) {
+  std::vector<double> c = {1.0, 2.0, 3.0, 4.0};
+  const std::vector<double> c0 = c;
+  const double* none = nullptr;
+  ppc::core::Gemm(2, 2, 0, none, 0, none, 2, c.data(), 2);
+  EXPECT_EQ(c, c0);
+}
+
+TEST(gemm_tests, identity_product) {
+  const std::size_t n = 19;
+  std::mt19937 gen(7);
+  const std::vector<double> a = RandomMatrix(n * n, gen);
+  std::vector<double> identity(n * n, 0.0);
+  for (std::size_t i = 0; i < n; ++i) {
+    identity[(i * n) + i] = 1.0;
+  }
+  std::vector<double> c(n * n, 0.0);
+  ppc::core::Gemm(n, n, n, a.data(), n, identity.data(), n, c.data(), n);
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    EXPECT_DOUBLE_EQ(c[i], a[i]);
+  }
+}
+
+// Single precision: float rounding of k products of values in [-1, 1] stays well below 1e-5 per term
+TEST(gemm_tests, float_ragged_edges) { CheckAllKernels<float>(37, 53, 29, 1e-5); }
+
+TEST(gemm_tests, float_crosses_all_cache_blocks) { CheckAllKernels<float>(211, 2100, 300, 1e-5); }
+
+// Mixed precision: the float inputs are exact in double, so only double rounding remains
+TEST(gemm_tests, mixed_ragged_edges) { CheckAllKernels<float, double>(37, 53, 29); }
+
+TEST(gemm_tests, mixed_crosses_all_cache_blocks) { CheckAllKernels<float, double>(211, 2100, 300); }
+
+TEST(gemm_tests, matrix_desc_strides) {
+  using ppc::core::MatrixLayout;
+  const ppc::core::MatrixDesc row_major{.rows = 3, .cols = 4, .ld = 6, .transpose = false};
+  EXPECT_EQ(row_major.RowStride(), 6U);
+  EXPECT_EQ(row_major.ColStride(), 1U);
+  EXPECT_EQ(row_major.Offset(2, 3), 15U);
+  EXPECT_EQ(row_major.Span(), 16U);
+  EXPECT_TRUE(row_major.IsValid());
+
+  // A 4 x 3 row-major buffer read as its 3 x 4 transpose walks the buffer column by column
+  const ppc::core::MatrixDesc transposed{.rows = 3, .cols = 4, .ld = 3, .transpose = true};
+  EXPECT_EQ(transposed.RowStride(), 1U);
+  EXPECT_EQ(transposed.ColStride(), 3U);
+  EXPECT_TRUE(transposed.IsValid());
+  ppc::core::MatrixDesc narrow = transposed;
+  narrow.ld = 2;
+  EXPECT_FALSE(narrow.IsValid());
+
+  const ppc::core::MatrixDesc column_major{
+      .rows = 3, .cols = 4, .ld = 3, .transpose = false, .layout = MatrixLayout::kColumnMajor};
+  EXPECT_EQ(column_major.Offset(1, 2), 7U);
+  EXPECT_TRUE(column_major.IsValid());
+  EXPECT_FALSE(column_major.Block(4, 4).IsValid());
+
+  EXPECT_EQ(ppc::core::RowMajorDesc(5, 7).Span(), 35U);
+  EXPECT_EQ(ppc::core::RowMajorDesc(0, 7).Span(), 0U);
+}
+
+TEST(gemm_tests, every_layout_and_transpose) {
+  CheckLayouts(5, 3, 4);
+  CheckLayouts(37, 53, 29);
+}
+
+TEST(gemm_tests, layouts_across_cache_blocks) { CheckLayouts(130, 300, 270); }
+
+TEST(gemm_tests, submatrix_view) {
+  // The 20 x 30 block at (5, 10) of a 64 x 64 matrix times the transpose of the 30 x 20 block at (1, 2) of another
+  const std::size_t n = 64;
+  std::mt19937 gen(3);
+  const std::vector<double> a = RandomMatrix(n * n, gen);
+  const std::vector<double> b = RandomMatrix(n * n, gen);
+  const ppc::core::MatrixDesc a_desc = ppc::core::RowMajorDesc(n, n).Block(20, 30);
+  const ppc::core::MatrixDesc b_desc{.rows = 30, .cols = 20, .ld = n, .transpose = true};
+  const ppc::core::MatrixDesc c_desc = ppc::core::RowMajorDesc(20, 20);
+  std::vector<double> c(20 * 20, 0.0);
+  ppc::core::Gemm(a_desc, a.data() + (5 * n) + 10, b_desc, b.data() + (1 * n) + 2, c_desc, c.data());
+  for (std::size_t i = 0; i < 20; ++i) {
+    for (std::size_t j = 0; j < 20; ++j) {
+      double expected = 0.0;
+      for (std::size_t p = 0; p < 30; ++p) {
+        expected += a[((5 + i) * n) + 10 + p] * b[((1 + j) * n) + 2 + p];
+      }
+      ASSERT_NEAR(c[(i * 20) + j], expected, 1e-12);
+    }
+  }
+}
+
+TEST(gemm_tests, copy_to_column_major_matrix) {
+  const std::vector<double> src = {1, 2, 3, 4, 5, 6};
+  const ppc::core::MatrixDesc desc{
+      .rows = 2, .cols = 3, .ld = 3, .transpose = false, .layout = ppc::core::MatrixLayout::kColumnMajor};
+  std::vector<double> dst(9, 0.0);
+  ppc::core::CopyToMatrix(src.data(), desc, dst.data());
+  EXPECT_EQ(dst, (std::vector<double>{1, 4, 0, 2, 5, 0, 3, 6, 0}));
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ppc::core {
+
+enum class GemmKernel : uint8_t { kScalar, kAvx2, kAvx512 };
+
+enum class MatrixLayout : uint8_t { kRowMajor, kColumnMajor };
+
+// A matrix operand inside a larger buffer. rows and cols are the dimensions of the operand as it takes part in a
+// product; with `transpose` set the buffer holds its transpose, i.e. a cols x rows matrix. `layout` and `ld` say how
+// that stored matrix lies in memory: stored element (r, c) is at r * ld + c in row-major and at r + c * ld in
+// column-major order. A submatrix is the same descriptor with smaller rows and cols and a pointer moved by Offset.
+struct MatrixDesc {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::size_t ld = 0;
+  bool transpose = false;
+  MatrixLayout layout = MatrixLayout::kRowMajor;
+
+  // Distance between elements (i, j) and (i + 1, j), and between (i, j) and (i, j + 1) of the operand.
+  [[nodiscard]] std::size_t RowStride() const;
+  [[nodiscard]] std::size_t ColStride() const;
+
+  [[nodiscard]] std::size_t Offset(std::size_t i, std::size_t j) const;
+
+  // Number of elements from the first to the last one the operand refers to, inclusive.
+  [[nodiscard]] std::size_t Span() const;
+
+  // Whether ld is at least the length of a stored row (row-major) or column (column-major).
+  [[nodiscard]] bool IsValid() const;
+
+  // The rows x cols submatrix starting where the pointer passed along with it points.
+  [[nodiscard]] MatrixDesc Block(std::size_t block_rows, std::size_t block_cols) const;
+};
+
+// A contiguous row-major rows x cols matrix.
+MatrixDesc RowMajorDesc(std::size_t rows, std::size_t cols);
+
+// C += A * B for row-major A (m x k), B (k x n) and C (m x n) with leading dimensions lda, ldb and ldc.
+// Panels of A and B are packed into cache-sized blocks and multiplied by a register-tiled micro-kernel.
+// Runs on the calling thread only: parallel tasks call it for independent blocks of C.
+void Gemm(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+          std::size_t ldb, double* c, std::size_t ldc);
+
+// Single precision: the micro-kernels hold twice as many floats per vector, so tiles are twice as wide.
+void Gemm(std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda, const float* b,
+          std::size_t ldb, float* c, std::size_t ldc);
+
+// Mixed precision: float A and B, double C. Operands are widened to double while they are packed, so products and
+// sums are formed in double while A and B are read from memory at float width.
+void Gemm(std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda, const float* b,
+          std::size_t ldb, double* c, std::size_t ldc);
+
+// Same with an explicit micro-kernel, which must be supported by the CPU.
+void Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda,
+          const double* b, std::size_t ldb, double* c, std::size_t ldc);
+void Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda,
+          const float* b, std::size_t ldb, float* c, std::size_t ldc);
+void Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda,
+          const float* b, std::size_t ldb, double* c, std::size_t ldc);
+
+// C += A * B for operands described by descriptors: a.rows x a.cols by b.rows x b.cols into c, with a.cols == b.rows,
+// c.rows == a.rows and c.cols == b.cols. Any combination of layouts and transposes runs without copying operands
+// first: A and B are read in the order that keeps unit stride while they are packed, and a C stored column by
+// column is computed as C^T = B^T * A^T.
+void Gemm(const MatrixDesc& a_desc, const double* a, const MatrixDesc& b_desc, const double* b,
+          const MatrixDesc& c_desc, double* c);
+void Gemm(const MatrixDesc& a_desc, const float* a, const MatrixDesc& b_desc, const float* b,
+          const MatrixDesc& c_desc, float* c);
+void Gemm(const MatrixDesc& a_desc, const float* a, const MatrixDesc& b_desc, const float* b,
+          const MatrixDesc& c_desc, double* c);
+
+// Writes a contiguous row-major desc.rows x desc.cols matrix into the operand `desc` describes, walking dst with
+// unit stride.
+void CopyToMatrix(const double* src, const MatrixDesc& desc, double* dst);
+void CopyToMatrix(const float* src, const MatrixDesc& desc, float* dst);
+
+bool IsGemmKernelSupported(GemmKernel kernel);
+
+// Widest supported kernel; chosen once at the first call.
+GemmKernel BestGemmKernel();
+
+std::string_view GemmKernelName(GemmKernel kernel);
+
+}  // namespace ppc::core
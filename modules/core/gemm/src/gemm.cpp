@@ -0,0 +1,489 @@
+#include "core/gemm/include/gemm.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PPC_GEMM_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Cache blocking: an mc x kc block of A stays in L2, a kc x nc panel of B in L3 and a kc x nr sliver of it
+// in L1 while the micro-kernel sweeps the A block. mc and nc are multiples of every kernel's mr and nr.
+constexpr std::size_t kMc = 96;
+constexpr std::size_t kKc = 256;
+constexpr std::size_t kNc = 2048;
+
+// Computes the full mr x nr tile C += A_panel * B_panel, where A_panel holds kc columns of mr values and
+// B_panel kc rows of nr values, both packed contiguously.
+template <typename T>
+using MicroKernelFn = void (*)(std::size_t kc, const T* a, const T* b, T* c, std::size_t ldc);
+
+template <typename T>
+struct MicroKernel {
+  std::size_t mr;
+  std::size_t nr;
+  MicroKernelFn<T> compute;
+};
+
+constexpr std::size_t kScalarMr = 4;
+constexpr std::size_t kScalarNr = 4;
+
+template <typename T>
+void MicroKernelScalar(std::size_t kc, const T* a, const T* b, T* c, std::size_t ldc) {
+  T acc[kScalarMr][kScalarNr] = {};
+  for (std::size_t p = 0; p < kc; ++p) {
+    for (std::size_t i = 0; i < kScalarMr; ++i) {
+      for (std::size_t j = 0; j < kScalarNr; ++j) {
+        acc[i][j] += a[i] * b[j];
+      }
+    }
+    a += kScalarMr;
+    b += kScalarNr;
+  }
+  for (std::size_t i = 0; i < kScalarMr; ++i) {
+    for (std::size_t j = 0; j < kScalarNr; ++j) {
+      c[(i * ldc) + j] += acc[i][j];
+    }
+  }
+}
+
+#ifdef PPC_GEMM_X86
+
+// Tiles of 6 rows by two vectors (8 doubles or 16 floats): 12 ymm accumulators, 2 for the B row and 1 broadcast
+// of A.
+constexpr std::size_t kAvx2Mr = 6;
+template <typename T>
+constexpr std::size_t kAvx2Nr = 2 * 32 / sizeof(T);
+
+__attribute__((target("avx2,fma"))) void MicroKernelAvx2(std::size_t kc, const double* a, const double* b, double* c,
+                                                         std::size_t ldc) {
+  __m256d acc[kAvx2Mr][2];
+#pragma GCC unroll 6
+  for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+    acc[i][0] = _mm256_setzero_pd();
+    acc[i][1] = _mm256_setzero_pd();
+  }
+  for (std::size_t p = 0; p < kc; ++p) {
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b + 4);
+#pragma GCC unroll 6
+    for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+      const __m256d ai = _mm256_broadcast_sd(a + i);
+      acc[i][0] = _mm256_fmadd_pd(ai, b0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_pd(ai, b1, acc[i][1]);
+    }
+    a += kAvx2Mr;
+    b += kAvx2Nr<double>;
+  }
+#pragma GCC unroll 6
+  for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+    double* row = c + (i * ldc);
+    _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), acc[i][0]));
+    _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), acc[i][1]));
+  }
+}
+
+__attribute__((target("avx2,fma"))) void MicroKernelAvx2(std::size_t kc, const float* a, const float* b, float* c,
+                                                         std::size_t ldc) {
+  __m256 acc[kAvx2Mr][2];
+#pragma GCC unroll 6
+  for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+    acc[i][0] = _mm256_setzero_ps();
+    acc[i][1] = _mm256_setzero_ps();
+  }
+  for (std::size_t p = 0; p < kc; ++p) {
+    const __m256 b0 = _mm256_loadu_ps(b);
+    const __m256 b1 = _mm256_loadu_ps(b + 8);
+#pragma GCC unroll 6
+    for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+      const __m256 ai = _mm256_broadcast_ss(a + i);
+      acc[i][0] = _mm256_fmadd_ps(ai, b0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_ps(ai, b1, acc[i][1]);
+    }
+    a += kAvx2Mr;
+    b += kAvx2Nr<float>;
+  }
+#pragma GCC unroll 6
+  for (std::size_t i = 0; i < kAvx2Mr; ++i) {
+    float* row = c + (i * ldc);
+    _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), acc[i][0]));
+    _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), acc[i][1]));
+  }
+}
+
+// Tiles of 8 rows by two vectors (16 doubles or 32 floats): 16 zmm accumulators, 2 for the B row and 1 broadcast
+// of A.
+constexpr std::size_t kAvx512Mr = 8;
+template <typename T>
+constexpr std::size_t kAvx512Nr = 2 * 64 / sizeof(T);
+
+__attribute__((target("avx512f"))) void MicroKernelAvx512(std::size_t kc, const double* a, const double* b, double* c,
+                                                          std::size_t ldc) {
+  __m512d acc[kAvx512Mr][2];
+#pragma GCC unroll 8
+  for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+    acc[i][0] = _mm512_setzero_pd();
+    acc[i][1] = _mm512_setzero_pd();
+  }
+  for (std::size_t p = 0; p < kc; ++p) {
+    const __m512d b0 = _mm512_loadu_pd(b);
+    const __m512d b1 = _mm512_loadu_pd(b + 8);
+#pragma GCC unroll 8
+    for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+      const __m512d ai = _mm512_set1_pd(a[i]);
+      acc[i][0] = _mm512_fmadd_pd(ai, b0, acc[i][0]);
+      acc[i][1] = _mm512_fmadd_pd(ai, b1, acc[i][1]);
+    }
+    a += kAvx512Mr;
+    b += kAvx512Nr<double>;
+  }
+#pragma GCC unroll 8
+  for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+    double* row = c + (i * ldc);
+    _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[i][0]));
+    _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[i][1]));
+  }
+}
+
+__attribute__((target("avx512f"))) void MicroKernelAvx512(std::size_t kc, const float* a, const float* b, float* c,
+                                                          std::size_t ldc) {
+  __m512 acc[kAvx512Mr][2];
+#pragma GCC unroll 8
+  for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+    acc[i][0] = _mm512_setzero_ps();
+    acc[i][1] = _mm512_setzero_ps();
+  }
+  for (std::size_t p = 0; p < kc; ++p) {
+    const __m512 b0 = _mm512_loadu_ps(b);
+    const __m512 b1 = _mm512_loadu_ps(b + 16);
+#pragma GCC unroll 8
+    for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+      const __m512 ai = _mm512_set1_ps(a[i]);
+      acc[i][0] = _mm512_fmadd_ps(ai, b0, acc[i][0]);
+      acc[i][1] = _mm512_fmadd_ps(ai, b1, acc[i][1]);
+    }
+    a += kAvx512Mr;
+    b += kAvx512Nr<float>;
+  }
+#pragma GCC unroll 8
+  for (std::size_t i = 0; i < kAvx512Mr; ++i) {
+    float* row = c + (i * ldc);
+    _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[i][0]));
+    _mm512_storeu_ps(row + 16, _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[i][1]));
+  }
+}
+
+#endif  // PPC_GEMM_X86
+
+template <typename T>
+MicroKernel<T> GetMicroKernel(ppc::core::GemmKernel kernel) {
+  switch (kernel) {
+#ifdef PPC_GEMM_X86
+    case ppc::core::GemmKernel::kAvx2:
+      return {.mr = kAvx2Mr, .nr = kAvx2Nr<T>, .compute = &MicroKernelAvx2};
+    case ppc::core::GemmKernel::kAvx512:
+      return {.mr = kAvx512Mr, .nr = kAvx512Nr<T>, .compute = &MicroKernelAvx512};
+#else
+    case ppc::core::GemmKernel::kAvx2:
+    case ppc::core::GemmKernel::kAvx512:
+#endif
+    case ppc::core::GemmKernel::kScalar:
+      break;
+  }
+  return {.mr = kScalarMr, .nr = kScalarNr, .compute = &MicroKernelScalar<T>};
+}
+
+// Packs rows [0, mc) x columns [0, kc) of A, whose element (i, p) is at a[i * rs + p * cs], into micro-panels of
+// mr rows stored column by column, padding the last panel with zeros. Values are converted to the kernel's type on
+// the way. A is read along whichever of its dimensions is contiguous.
+template <typename Src, typename Dst>
+void PackA(std::size_t mc, std::size_t kc, const Src* a, std::size_t rs, std::size_t cs, std::size_t mr, Dst* dst) {
+  for (std::size_t i0 = 0; i0 < mc; i0 += mr) {
+    const std::size_t rows = std::min(mr, mc - i0);
+    if (cs == 1 && rs != 1) {
+      for (std::size_t i = 0; i < rows; ++i) {
+        const Src* src = a + ((i0 + i) * rs);
+        for (std::size_t p = 0; p < kc; ++p) {
+          dst[(p * mr) + i] = static_cast<Dst>(src[p]);
+        }
+      }
+      for (std::size_t p = 0; p < kc; ++p) {
+        std::fill(dst + (p * mr) + rows, dst + ((p + 1) * mr), Dst{0});
+      }
+    } else {
+      for (std::size_t p = 0; p < kc; ++p) {
+        for (std::size_t i = 0; i < rows; ++i) {
+          dst[(p * mr) + i] = static_cast<Dst>(a[((i0 + i) * rs) + (p * cs)]);
+        }
+        std::fill(dst + (p * mr) + rows, dst + ((p + 1) * mr), Dst{0});
+      }
+    }
+    dst += kc * mr;
+  }
+}
+
+// Packs rows [0, kc) x columns [0, nc) of B, whose element (p, j) is at b[p * rs + j * cs], into micro-panels of
+// nr columns stored row by row, padding the last panel with zeros.
+template <typename Src, typename Dst>
+void PackB(std::size_t kc, std::size_t nc, const Src* b, std::size_t rs, std::size_t cs, std::size_t nr, Dst* dst) {
+  for (std::size_t j0 = 0; j0 < nc; j0 += nr) {
+    const std::size_t cols = std::min(nr, nc - j0);
+    if (cs == 1) {
+      for (std::size_t p = 0; p < kc; ++p) {
+        const Src* src = b + (p * rs) + j0;
+        std::transform(src, src + cols, dst + (p * nr), [](Src value) { return static_cast<Dst>(value); });
+      }
+    } else {
+      for (std::size_t j = 0; j < cols; ++j) {
+        const Src* src = b + ((j0 + j) * cs);
+        for (std::size_t p = 0; p < kc; ++p) {
+          dst[(p * nr) + j] = static_cast<Dst>(src[p * rs]);
+        }
+      }
+    }
+    for (std::size_t p = 0; p < kc; ++p) {
+      std::fill(dst + (p * nr) + cols, dst + ((p + 1) * nr), Dst{0});
+    }
+    dst += kc * nr;
+  }
+}
+
+std::size_t RoundUp(std::size_t value, std::size_t step) { return (value + step - 1) / step * step; }
+
+// Multiplies a packed mc x kc block of A by a packed kc x nc panel of B into C. Edge tiles go through a
+// zeroed scratch tile so that the micro-kernel never writes outside C.
+template <typename T>
+void MacroKernel(const MicroKernel<T>& kernel, std::size_t mc, std::size_t nc, std::size_t kc, const T* a_pack,
+                 const T* b_pack, T* c, std::size_t ldc, T* tile) {
+  for (std::size_t j0 = 0; j0 < nc; j0 += kernel.nr) {
+    const std::size_t cols = std::min(kernel.nr, nc - j0);
+    const T* b_panel = b_pack + (j0 * kc);
+    for (std::size_t i0 = 0; i0 < mc; i0 += kernel.mr) {
+      const std::size_t rows = std::min(kernel.mr, mc - i0);
+      const T* a_panel = a_pack + (i0 * kc);
+      T* c_tile = c + (i0 * ldc) + j0;
+      if (rows == kernel.mr && cols == kernel.nr) {
+        kernel.compute(kc, a_panel, b_panel, c_tile, ldc);
+        continue;
+      }
+      std::fill(tile, tile + (kernel.mr * kernel.nr), T{0});
+      kernel.compute(kc, a_panel, b_panel, tile, kernel.nr);
+      for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+          c_tile[(i * ldc) + j] += tile[(i * kernel.nr) + j];
+        }
+      }
+    }
+  }
+}
+
+// C += A * B with A and B packed into the type of C, which is also the type the micro-kernel computes in. Element
+// (i, p) of A is at a[i * rs_a + p * cs_a] and element (p, j) of B at b[p * rs_b + j * cs_b]; rows of C are
+// contiguous.
+template <typename In, typename T>
+void GemmImpl(ppc::core::GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const In* a,
+              std::size_t rs_a, std::size_t cs_a, const In* b, std::size_t rs_b, std::size_t cs_b, T* c,
+              std::size_t ldc) {
+  if (m == 0 || n == 0 || k == 0) {
+    return;
+  }
+  const MicroKernel<T> micro = GetMicroKernel<T>(kernel);
+
+  // Packing buffers are reused between calls, since block algorithms call this many times per run
+  thread_local std::vector<T> a_pack;
+  thread_local std::vector<T> b_pack;
+  thread_local std::vector<T> tile;
+  const std::size_t kc_max = std::min(k, kKc);
+  a_pack.resize(std::max(a_pack.size(), RoundUp(std::min(m, kMc), micro.mr) * kc_max));
+  b_pack.resize(std::max(b_pack.size(), RoundUp(std::min(n, kNc), micro.nr) * kc_max));
+  tile.resize(std::max(tile.size(), micro.mr * micro.nr));
+
+  for (std::size_t jc = 0; jc < n; jc += kNc) {
+    const std::size_t nc = std::min(kNc, n - jc);
+    for (std::size_t pc = 0; pc < k; pc += kKc) {
+      const std::size_t kc = std::min(kKc, k - pc);
+      PackB(kc, nc, b + (pc * rs_b) + (jc * cs_b), rs_b, cs_b, micro.nr, b_pack.data());
+      for (std::size_t ic = 0; ic < m; ic += kMc) {
+        const std::size_t mc = std::min(kMc, m - ic);
+        PackA(mc, kc, a + (ic * rs_a) + (pc * cs_a), rs_a, cs_a, micro.mr, a_pack.data());
+        MacroKernel(micro, mc, nc, kc, a_pack.data(), b_pack.data(), c + (ic * ldc) + jc, ldc, tile.data());
+      }
+    }
+  }
+}
+
+template <typename In, typename T>
+void GemmImpl(ppc::core::GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const In* a,
+              std::size_t lda, const In* b, std::size_t ldb, T* c, std::size_t ldc) {
+  GemmImpl(kernel, m, n, k, a, lda, 1, b, ldb, 1, c, ldc);
+}
+
+template <typename In, typename T>
+void GemmDescImpl(const ppc::core::MatrixDesc& a_desc, const In* a, const ppc::core::MatrixDesc& b_desc, const In* b,
+                  const ppc::core::MatrixDesc& c_desc, T* c) {
+  const ppc::core::GemmKernel kernel = ppc::core::BestGemmKernel();
+  if (c_desc.ColStride() == 1) {
+    GemmImpl(kernel, c_desc.rows, c_desc.cols, a_desc.cols, a, a_desc.RowStride(), a_desc.ColStride(), b,
+             b_desc.RowStride(), b_desc.ColStride(), c, c_desc.RowStride());
+    return;
+  }
+  // Columns of C are contiguous, so C^T is row-major: C^T += B^T * A^T, where transposing swaps the strides
+  GemmImpl(kernel, c_desc.cols, c_desc.rows, a_desc.cols, b, b_desc.ColStride(), b_desc.RowStride(), a,
+           a_desc.ColStride(), a_desc.RowStride(), c, c_desc.ColStride());
+}
+
+template <typename T>
+void CopyToMatrixImpl(const T* src, const ppc::core::MatrixDesc& desc, T* dst) {
+  if (desc.ColStride() == 1) {
+    for (std::size_t i = 0; i < desc.rows; ++i) {
+      std::copy(src + (i * desc.cols), src + ((i + 1) * desc.cols), dst + (i * desc.RowStride()));
+    }
+    return;
+  }
+  for (std::size_t j = 0; j < desc.cols; ++j) {
+    T* column = dst + (j * desc.ColStride());
+    for (std::size_t i = 0; i < desc.rows; ++i) {
+      column[i * desc.RowStride()] = src[(i * desc.cols) + j];
+    }
+  }
+}
+
+}  // namespace
+
+void ppc::core::Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const double* a,
+                     std::size_t lda, const double* b, std::size_t ldb, double* c, std::size_t ldc) {
+  GemmImpl(kernel, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const float* a,
+                     std::size_t lda, const float* b, std::size_t ldb, float* c, std::size_t ldc) {
+  GemmImpl(kernel, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::Gemm(GemmKernel kernel, std::size_t m, std::size_t n, std::size_t k, const float* a,
+                     std::size_t lda, const float* b, std::size_t ldb, double* c, std::size_t ldc) {
+  GemmImpl(kernel, m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::Gemm(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+                     std::size_t ldb, double* c, std::size_t ldc) {
+  Gemm(BestGemmKernel(), m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::Gemm(std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda, const float* b,
+                     std::size_t ldb, float* c, std::size_t ldc) {
+  Gemm(BestGemmKernel(), m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+void ppc::core::Gemm(std::size_t m, std::size_t n, std::size_t k, const float* a, std::size_t lda, const float* b,
+                     std::size_t ldb, double* c, std::size_t ldc) {
+  Gemm(BestGemmKernel(), m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// Operand (i, j) is stored at (i, j), or at (j, i) when transposed. Along stored rows the stride is 1 in row-major
+// and ld in column-major order, so the operand steps by 1 along its own rows exactly when `transpose` and the
+// layout do not cancel out.
+std::size_t ppc::core::MatrixDesc::RowStride() const {
+  return transpose == (layout == MatrixLayout::kRowMajor) ? 1 : ld;
+}
+
+std::size_t ppc::core::MatrixDesc::ColStride() const {
+  return transpose == (layout == MatrixLayout::kRowMajor) ? ld : 1;
+}
+
+std::size_t ppc::core::MatrixDesc::Offset(std::size_t i, std::size_t j) const {
+  return (i * RowStride()) + (j * ColStride());
+}
+
+std::size_t ppc::core::MatrixDesc::Span() const {
+  if (rows == 0 || cols == 0) {
+    return 0;
+  }
+  return Offset(rows - 1, cols - 1) + 1;
+}
+
+bool ppc::core::MatrixDesc::IsValid() const {
+  const std::size_t contiguous = ColStride() == 1 ? cols : rows;
+  return ld >= contiguous && (ld > 0 || rows == 0 || cols == 0);
+}
+
+ppc::core::MatrixDesc ppc::core::MatrixDesc::Block(std::size_t block_rows, std::size_t block_cols) const {
+  MatrixDesc block = *this;
+  block.rows = block_rows;
+  block.cols = block_cols;
+  return block;
+}
+
+ppc::core::MatrixDesc ppc::core::RowMajorDesc(std::size_t rows, std::size_t cols) {
+  return {.rows = rows, .cols = cols, .ld = cols, .transpose = false, .layout = MatrixLayout::kRowMajor};
+}
+
+void ppc::core::Gemm(const MatrixDesc& a_desc, const double* a, const MatrixDesc& b_desc, const double* b,
+                     const MatrixDesc& c_desc, double* c) {
+  GemmDescImpl(a_desc, a, b_desc, b, c_desc, c);
+}
+
+void ppc::core::Gemm(const MatrixDesc& a_desc, const float* a, const MatrixDesc& b_desc, const float* b,
+                     const MatrixDesc& c_desc, float* c) {
+  GemmDescImpl(a_desc, a, b_desc, b, c_desc, c);
+}
+
+void ppc::core::Gemm(const MatrixDesc& a_desc, const float* a, const MatrixDesc& b_desc, const float* b,
+                     const MatrixDesc& c_desc, double* c) {
+  GemmDescImpl(a_desc, a, b_desc, b, c_desc, c);
+}
+
+void ppc::core::CopyToMatrix(const double* src, const MatrixDesc& desc, double* dst) {
+  CopyToMatrixImpl(src, desc, dst);
+}
+
+void ppc::core::CopyToMatrix(const float* src, const MatrixDesc& desc, float* dst) {
+  CopyToMatrixImpl(src, desc, dst);
+}
+
+bool ppc::core::IsGemmKernelSupported(GemmKernel kernel) {
+  switch (kernel) {
+    case GemmKernel::kScalar:
+      return true;
+#ifdef PPC_GEMM_X86
+    case GemmKernel::kAvx2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case GemmKernel::kAvx512:
+      return __builtin_cpu_supports("avx512f");
+#else
+    case GemmKernel::kAvx2:
+    case GemmKernel::kAvx512:
+      return false;
+#endif
+  }
+  return false;
+}
+
+ppc::core::GemmKernel ppc::core::BestGemmKernel() {
+  static const GemmKernel kBest = [] {
+    for (const GemmKernel kernel : {GemmKernel::kAvx512, GemmKernel::kAvx2}) {
+      if (IsGemmKernelSupported(kernel)) {
+        return kernel;
+      }
+    }
+    return GemmKernel::kScalar;
+  }();
+  return kBest;
+}
+
+std::string_view ppc::core::GemmKernelName(GemmKernel kernel) {
+  switch (kernel) {
+    case GemmKernel::kScalar:
+      return "scalar";
+    case GemmKernel::kAvx2:
+      return "avx2";
+    case GemmKernel::kAvx512:
+      return "avx512";
+  }
+  return "unknown";
+}
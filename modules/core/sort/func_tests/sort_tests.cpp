@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/sort/include/sort.hpp"
+
+namespace {
+
+void RunSequentially(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  for (std::size_t p = 0; p < parts; ++p) {
+    part(p);
+  }
+}
+
+void RunOnThreads(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < parts; ++p) {
+    threads.emplace_back(part, p);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+std::vector<double> RandomKeys(std::size_t n, int distinct, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, distinct - 1);
+  std::vector<double> keys(n);
+  for (auto& key : keys) {
+    key = dist(gen);
+  }
+  return keys;
+}
+
+template <typename Run>
+void CheckPartition(std::vector<double> keys, double pivot, std::size_t workers, const Run& run) {
+  std::vector<double> expected = keys;
+  const std::size_t split = ppc::core::ParallelPartition(keys.data(), keys.size(), pivot, workers, run);
+  ASSERT_LE(split, keys.size());
+  for (std::size_t i = 0; i < split; ++i) {
+    ASSERT_LE(keys[i], pivot) << i;
+  }
+  for (std::size_t i = split; i < keys.size(); ++i) {
+    ASSERT_GE(keys[i], pivot) << i;
+  }
+  std::ranges::sort(keys);
+  std::ranges::sort(expected);
+  EXPECT_EQ(keys, expected);
+}
+
+}  // namespace
+
+TEST(sort_tests, hoare_partition_around_absent_pivot) {
+  std::vector<int> keys = {5, 1, 9, 3, 7, 2, 8};
+  int* split = ppc::core::HoarePartition(keys.data(), keys.data() + keys.size(), 4);
+  EXPECT_EQ(split - keys.data(), 3);
+  EXPECT_TRUE(std::all_of(keys.data(), split, [](int key) { return key < 4; }));
+  EXPECT_TRUE(std::all_of(split, keys.data() + keys.size(), [](int key) { return key > 4; }));
+}
+
+TEST(sort_tests, block_partition_sequential_parts) {
+  CheckPartition(RandomKeys(100000, 1000, 1), 500.0, 4, RunSequentially);
+}
+
+TEST(sort_tests, block_partition_on_threads) {
+  for (const std::size_t workers : {2U, 3U, 8U}) {
+    CheckPartition(RandomKeys(200003, 1000, static_cast<unsigned>(workers)), 250.5, workers, RunOnThreads);
+  }
+}
+
+TEST(sort_tests, block_partition_with_many_equal_keys) {
+  CheckPartition(RandomKeys(100000, 3, 2), 1.0, 4, RunOnThreads);
+  CheckPartition(std::vector<double>(50000, 7.0), 7.0, 4, RunOnThreads);
+}
+
+TEST(sort_tests, block_partition_pivot_outside_the_keys) {
+  CheckPartition(RandomKeys(60000, 100, 3), -1.0, 4, RunOnThreads);
+  CheckPartition(RandomKeys(60000, 100, 4), 1000.0, 4, RunOnThreads);
+}
+
+TEST(sort_tests, block_partition_shorter_than_a_block) {
+  CheckPartition(RandomKeys(ppc::core::kPartitionBlockSize - 1, 10, 5), 4.0, 4, RunOnThreads);
+  CheckPartition(RandomKeys(1, 10, 6), 4.0, 2, RunOnThreads);
+}
+
+TEST(sort_tests, presorted_input_is_kept) {
+  std::vector<int> keys = {1, 2, 2, 3, 5, 8, 8, 13};
+  const std::vector<int> expected = keys;
+  EXPECT_TRUE(ppc::core::SortIfPresorted(keys, 3, RunOnThreads));
+  EXPECT_EQ(keys, expected);
+}
+
+TEST(sort_tests, non_increasing_input_is_reversed) {
+  std::vector<int> keys(10001);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>((keys.size() - i) / 3);
+  }
+  std::vector<int> expected = keys;
+  std::ranges::sort(expected);
+  EXPECT_TRUE(ppc::core::SortIfPresorted(keys, 4, RunOnThreads));
+  EXPECT_EQ(keys, expected);
+}
+
+TEST(sort_tests, few_runs_are_merged) {
+  for (const std::size_t runs : {std::size_t{2}, std::size_t{3}, std::size_t{7}, ppc::core::kMaxNaturalRuns}) {
+    std::vector<double> keys;
+    for (std::size_t r = 0; r < runs; ++r) {
+      for (int i = 0; i < 1000; ++i) {
+        keys.push_back(static_cast<double>((i * 7) + static_cast<int>(r)));
+      }
+    }
+    std::vector<double> expected = keys;
+    std::ranges::sort(expected);
+    EXPECT_TRUE(ppc::core::SortIfPresorted(keys, 5, RunOnThreads)) << runs;
+    EXPECT_EQ(keys, expected) << runs;
+  }
+}
+
+TEST(sort_tests, many_runs_are_left_to_the_sort) {
+  std::vector<double> keys = RandomKeys(100000, 1000, 7);
+  const std::vector<double> expected = keys;
+  EXPECT_FALSE(ppc::core::SortIfPresorted(keys, 4, RunOnThreads));
+  EXPECT_EQ(keys, expected);
+}
+
+TEST(sort_tests, parts_do_not_change_the_presort) {
+  std::vector<int> keys = {4, 5, 6, 1, 2, 3, 0};
+  for (const std::size_t parts : {1U, 2U, 6U, 100U}) {
+    std::vector<int> copy = keys;
+    EXPECT_TRUE(ppc::core::SortIfPresorted(copy, parts, RunSequentially));
+    EXPECT_EQ(copy, (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+  }
+}
+
+TEST(sort_tests, nth_element_places_the_kth_key) {
+  const std::vector<double> keys = RandomKeys(100000, 1000000, 8);
+  std::vector<double> expected = keys;
+  std::ranges::sort(expected);
+  for (const std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{49999}, std::size_t{99999}}) {
+    std::vector<double> copy = keys;
+    ppc::core::NthElement(copy, k, 4, RunOnThreads);
+    ASSERT_EQ(copy[k], expected[k]) << k;
+    EXPECT_TRUE(std::all_of(copy.begin(), copy.begin() + static_cast<std::ptrdiff_t>(k),
+                            [&](double key) { return key <= copy[k]; }));
+    EXPECT_TRUE(std::all_of(copy.begin() + static_cast<std::ptrdiff_t>(k), copy.end(),
+                            [&](double key) { return key >= copy[k]; }));
+  }
+}
+
+TEST(sort_tests, nth_element_with_many_equal_keys) {
+  std::vector<double> keys = RandomKeys(80000, 3, 9);
+  std::vector<double> expected = keys;
+  std::ranges::sort(expected);
+  ppc::core::NthElement(keys, 30000, 4, RunOnThreads);
+  EXPECT_EQ(keys[30000], expected[30000]);
+  std::vector<double> same(50000, 1.0);
+  ppc::core::NthElement(same, 123, 4, RunOnThreads);
+  EXPECT_EQ(same[123], 1.0);
+}
+
+TEST(sort_tests, partial_sort_sorts_the_smallest_keys) {
+  const std::vector<double> keys = RandomKeys(60000, 1000000, 10);
+  std::vector<double> expected = keys;
+  std::ranges::sort(expected);
+  for (const std::size_t k : {std::size_t{1}, std::size_t{2}, std::size_t{1000}, keys.size() + 10}) {
+    std::vector<double> copy = keys;
+    ppc::core::PartialSort(copy, k, 5, RunOnThreads);
+    const auto sorted = static_cast<std::ptrdiff_t>(std::min(k, keys.size()));
+    EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + sorted, copy.begin())) << k;
+  }
+}
+
+TEST(sort_tests, top_k_returns_the_largest_keys_descending) {
+  const std::vector<double> keys = RandomKeys(50000, 1000, 11);
+  std::vector<double> expected = keys;
+  std::ranges::sort(expected, std::greater<>());
+  for (const std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{700}, keys.size() + 1}) {
+    const std::vector<double> top = ppc::core::TopK(keys, k, 4, RunOnThreads);
+    EXPECT_EQ(top, std::vector<double>(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(top.size())));
+    EXPECT_EQ(top.size(), std::min(k, keys.size()));
+  }
+}
@@ -0,0 +1,344 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// The routines below take a runner as a template argument: a callable run(parts, part) that calls part(0) ..
+// part(parts - 1), possibly concurrently, and returns once all of them are done, as a PartRunner of core/sparse
+// does. Each task passes the one of its backend.
+
+// Elements in each block of a BlockPartition.
+constexpr std::size_t kPartitionBlockSize = 1 << 12;
+
+// Hoare partition of [first, last) around a value that need not be present; returns the split point.
+template <typename T>
+T* HoarePartition(T* first, T* last, const T& pivot) {
+  T* i = first;
+  T* j = last - 1;
+  while (true) {
+    while (i <= j && *i < pivot) {
+      ++i;
+    }
+    while (i <= j && pivot < *j) {
+      --j;
+    }
+    if (i >= j) {
+      return i;
+    }
+    std::swap(*i++, *j--);
+  }
+}
+
+// Shared state of one block partition of [first, first + n) (Tsigas-Zhang): workers claim blocks from both
+// ends of the range and swap misplaced elements between a left and a right block until one of them is
+// neutralized, i.e. holds only keys <= pivot (left) or >= pivot (right). Blocks still unfinished when there
+// is nothing left to claim are recorded and resolved sequentially by Finish.
+template <typename T>
+class BlockPartition {
+ public:
+  BlockPartition(T* first, std::size_t n, T pivot)
+      : first_(first),
+        n_(n),
+        pivot_(std::move(pivot)),
+        unclaimed_(static_cast<std::ptrdiff_t>(n / kPartitionBlockSize)) {}
+
+  // Neutralizes blocks until there are none left to claim. Every worker calls it once, possibly concurrently.
+  void Neutralize() {
+    std::size_t left = 0;
+    std::size_t right = 0;
+    T* l = nullptr;
+    T* r = nullptr;
+    bool has_left = false;
+    bool has_right = false;
+    while (true) {
+      if (!has_left) {
+        if (!Claim(left_taken_, left)) {
+          break;
+        }
+        l = LeftBlock(left);
+        has_left = true;
+      }
+      if (!has_right) {
+        if (!Claim(right_taken_, right)) {
+          break;
+        }
+        r = RightBlock(right);
+        has_right = true;
+      }
+      T* l_end = LeftBlock(left) + kPartitionBlockSize;
+      T* r_end = RightBlock(right) + kPartitionBlockSize;
+      while (true) {
+        while (l < l_end && *l < pivot_) {
+          ++l;
+        }
+        while (r < r_end && pivot_ < *r) {
+          ++r;
+        }
+        if (l == l_end || r == r_end) {
+          break;
+        }
+        std::swap(*l++, *r++);
+      }
+      has_left = l != l_end;
+      has_right = r != r_end;
+    }
+
+    const std::scoped_lock lock(mutex_);
+    if (has_left) {
+      left_unfinished_.push_back(left);
+    }
+    if (has_right) {
+      right_unfinished_.push_back(right);
+    }
+  }
+
+  // Once all workers are done: returns split such that [first, first + split) holds keys <= pivot and
+  // [first + split, first + n) keys >= pivot.
+  std::size_t Finish() {
+    const std::size_t left_done =
+        GatherUnfinished(left_unfinished_, left_taken_, [this](std::size_t id) { return LeftBlock(id); });
+    const std::size_t right_done =
+        GatherUnfinished(right_unfinished_, right_taken_, [this](std::size_t id) { return RightBlock(id); });
+    T* middle = HoarePartition(first_ + (left_done * kPartitionBlockSize),
+                               first_ + n_ - (right_done * kPartitionBlockSize), pivot_);
+    return static_cast<std::size_t>(middle - first_);
+  }
+
+ private:
+  [[nodiscard]] T* LeftBlock(std::size_t id) const { return first_ + (id * kPartitionBlockSize); }
+  [[nodiscard]] T* RightBlock(std::size_t id) const { return first_ + n_ - ((id + 1) * kPartitionBlockSize); }
+
+  bool Claim(std::atomic<std::size_t>& taken, std::size_t& id) {
+    if (unclaimed_.fetch_sub(1) <= 0) {
+      return false;
+    }
+    id = taken.fetch_add(1);
+    return true;
+  }
+
+  // Swaps the unfinished blocks of one side with neutralized ones closest to the middle, so that the first
+  // returned number of blocks of that side are all neutralized.
+  template <typename BlockAt>
+  static std::size_t GatherUnfinished(std::vector<std::size_t>& unfinished, std::size_t taken, BlockAt block_at) {
+    const std::size_t done = taken - unfinished.size();
+    std::ranges::sort(unfinished);
+    std::size_t slot = done;
+    for (const std::size_t id : unfinished) {
+      if (id >= done) {
+        break;
+      }
+      while (std::ranges::binary_search(unfinished, slot)) {
+        ++slot;
+      }
+      std::swap_ranges(block_at(id), block_at(id) + kPartitionBlockSize, block_at(slot++));
+    }
+    return done;
+  }
+
+  T* first_;
+  std::size_t n_;
+  T pivot_;
+  std::atomic<std::ptrdiff_t> unclaimed_;
+  std::atomic<std::size_t> left_taken_{0};
+  std::atomic<std::size_t> right_taken_{0};
+  std::mutex mutex_;
+  std::vector<std::size_t> left_unfinished_;
+  std::vector<std::size_t> right_unfinished_;
+};
+
+// Partitions [first, first + n) around `pivot` with `workers` parts of `run` sharing one BlockPartition, and
+// returns the split point as BlockPartition::Finish does. The parts need not run concurrently to be correct, but
+// only a runner that gives each part a thread of its own partitions in parallel.
+template <typename T, typename Run>
+std::size_t ParallelPartition(T* first, std::size_t n, const T& pivot, std::size_t workers, const Run& run) {
+  BlockPartition<T> partition(first, n, pivot);
+  run(workers, [&partition](std::size_t) { partition.Neutralize(); });
+  return partition.Finish();
+}
+
+// Inputs with at least this many descents are left to the full sort by SortIfPresorted.
+constexpr std::size_t kMaxNaturalRuns = 64;
+
+// Pre-pass before a full sort: sorted input is kept, non-increasing input is reversed and input made of a few
+// ascending runs is finished by merging neighbouring runs pairwise. Returns false when there are too many runs and
+// the input still has to go through the main algorithm. The scan and the reversal split the input into `parts`
+// ranges; each round of merges has a part per pair of runs.
+template <typename T, typename Run>
+bool SortIfPresorted(std::vector<T>& a, std::size_t parts, const Run& run) {
+  const std::size_t n = a.size();
+  if (n < 2) {
+    return true;
+  }
+  parts = std::clamp<std::size_t>(parts, 1, n - 1);
+  const std::size_t chunk = (n - 1 + parts - 1) / parts;
+
+  std::vector<std::size_t> ascents(parts, 0);
+  std::vector<std::size_t> descents(parts, 0);
+  // Beginnings of ascending runs, kept only while there are few of them
+  std::vector<std::vector<std::size_t>> starts(parts);
+  run(parts, [&](std::size_t part) {
+    std::size_t up = 0;
+    std::size_t down = 0;
+    const std::size_t end = std::min(n - 1, (part + 1) * chunk);
+    for (std::size_t i = part * chunk; i < end; ++i) {
+      if (a[i] < a[i + 1]) {
+        ++up;
+      } else if (a[i + 1] < a[i] && ++down < kMaxNaturalRuns) {
+        starts[part].push_back(i + 1);
+      }
+    }
+    ascents[part] = up;
+    descents[part] = down;
+  });
+
+  std::size_t total_ascents = 0;
+  std::size_t total_descents = 0;
+  for (std::size_t part = 0; part < parts; ++part) {
+    total_ascents += ascents[part];
+    total_descents += descents[part];
+  }
+  if (total_descents == 0) {
+    return true;
+  }
+  if (total_ascents == 0) {
+    const std::size_t half = n / 2;
+    const std::size_t half_chunk = (half + parts - 1) / parts;
+    run(parts, [&](std::size_t part) {
+      const std::size_t end = std::min(half, (part + 1) * half_chunk);
+      for (std::size_t i = part * half_chunk; i < end; ++i) {
+        std::swap(a[i], a[n - 1 - i]);
+      }
+    });
+    return true;
+  }
+  if (total_descents >= kMaxNaturalRuns) {
+    return false;
+  }
+
+  std::vector<std::size_t> bounds = {0};
+  for (const auto& local : starts) {
+    bounds.insert(bounds.end(), local.begin(), local.end());
+  }
+  bounds.push_back(n);
+
+  while (bounds.size() > 2) {
+    run((bounds.size() - 1) / 2, [&a, &bounds](std::size_t k) {
+      const auto first = a.begin() + static_cast<std::ptrdiff_t>(bounds[2 * k]);
+      std::inplace_merge(first, a.begin() + static_cast<std::ptrdiff_t>(bounds[(2 * k) + 1]),
+                         a.begin() + static_cast<std::ptrdiff_t>(bounds[(2 * k) + 2]));
+    });
+    std::vector<std::size_t> merged;
+    for (std::size_t k = 0; k < bounds.size(); k += 2) {
+      merged.push_back(bounds[k]);
+    }
+    if (merged.back() != n) {
+      merged.push_back(n);
+    }
+    bounds = std::move(merged);
+  }
+  return true;
+}
+
+// Ranges NthElement leaves to std::nth_element.
+constexpr std::size_t kSequentialSelection = 1 << 14;
+
+// Quickselect: rearranges `a` so that a[k] is the element a full sort would put there, with no greater element
+// before it and no smaller one after it; does nothing when k is out of range. Each round splits the remaining range
+// around a median of three with ParallelPartition over `parts` workers.
+template <typename T, typename Run>
+void NthElement(std::vector<T>& a, std::size_t k, std::size_t parts, const Run& run) {
+  if (k >= a.size()) {
+    return;
+  }
+  std::size_t lo = 0;
+  std::size_t hi = a.size();
+  while (parts > 1 && hi - lo > kSequentialSelection) {
+    T* first = a.data() + lo;
+    const std::size_t n = hi - lo;
+    const T pivot =
+        std::max(std::min(first[0], first[n / 2]), std::min(std::max(first[0], first[n / 2]), first[n - 1]));
+    const std::size_t split = lo + ParallelPartition(first, n, pivot, parts, run);
+    // All keys on one side of the pivot: a further round would not shrink the range
+    if (split == lo || split == hi) {
+      break;
+    }
+    if (k < split) {
+      hi = split;
+    } else {
+      lo = split;
+    }
+  }
+  std::nth_element(a.begin() + static_cast<std::ptrdiff_t>(lo), a.begin() + static_cast<std::ptrdiff_t>(k),
+                   a.begin() + static_cast<std::ptrdiff_t>(hi));
+}
+
+// Sorts the k smallest elements into a[0, k); the order of the rest is unspecified. After NthElement the prefix is
+// cut into `parts` chunks that are sorted by parts of their own and merged pairwise.
+template <typename T, typename Run>
+void PartialSort(std::vector<T>& a, std::size_t k, std::size_t parts, const Run& run) {
+  k = std::min(k, a.size());
+  if (k == 0) {
+    return;
+  }
+  // a[k - 1] ends up as the largest of the k smallest elements, so only the part before it is left to sort
+  NthElement(a, k - 1, parts, run);
+  const std::size_t n = k - 1;
+  if (n < 2) {
+    return;
+  }
+  parts = std::clamp<std::size_t>(parts, 1, n);
+  const auto at = [&a, n, parts](std::size_t chunk) {
+    return a.begin() + static_cast<std::ptrdiff_t>(n * std::min(chunk, parts) / parts);
+  };
+  run(parts, [&at](std::size_t chunk) { std::sort(at(chunk), at(chunk + 1)); });
+  for (std::size_t width = 1; width < parts; width *= 2) {
+    run((parts + (2 * width) - 1) / (2 * width), [&at, width](std::size_t pair) {
+      const std::size_t left = 2 * width * pair;
+      std::inplace_merge(at(left), at(left + width), at(left + (2 * width)));
+    });
+  }
+}
+
+// The k largest elements of `a` in descending order. Each of `parts` blocks keeps a min-heap of its k largest
+// elements, and the candidates of all blocks are ranked at the end.
+template <typename T, typename Run>
+std::vector<T> TopK(const std::vector<T>& a, std::size_t k, std::size_t parts, const Run& run) {
+  k = std::min(k, a.size());
+  if (k == 0) {
+    return {};
+  }
+  parts = std::clamp<std::size_t>(parts, 1, a.size());
+  std::vector<std::vector<T>> heaps(parts);
+  run(parts, [&](std::size_t part) {
+    auto& heap = heaps[part];
+    heap.reserve(k);
+    const std::size_t end = a.size() * (part + 1) / parts;
+    for (std::size_t i = a.size() * part / parts; i < end; ++i) {
+      if (heap.size() < k) {
+        heap.push_back(a[i]);
+        std::ranges::push_heap(heap, std::greater<>());
+      } else if (heap.front() < a[i]) {
+        std::ranges::pop_heap(heap, std::greater<>());
+        heap.back() = a[i];
+        std::ranges::push_heap(heap, std::greater<>());
+      }
+    }
+  });
+
+  std::vector<T> candidates;
+  for (const auto& heap : heaps) {
+    candidates.insert(candidates.end(), heap.begin(), heap.end());
+  }
+  std::ranges::partial_sort(candidates, candidates.begin() + static_cast<std::ptrdiff_t>(k), std::greater<>());
+  candidates.resize(k);
+  return candidates;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,534 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+// Roughly `density` of the entries are nonzero.
+template <typename Value>
+std::vector<Value> RandomSparseDense(std::size_t rows, std::size_t cols, double density, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<Value> dense(rows * cols);
+  for (auto& value : dense) {
+    if (nonzero(gen)) {
+      if constexpr (std::is_same_v<Value, std::complex<double>>) {
+        value = {dist(gen), dist(gen)};
+      } else {
+        value = static_cast<Value>(dist(gen));
+      }
+    }
+  }
+  return dense;
+}
+
+// Runs the parts in reverse order, so a part relying on the results of a later one would show up.
+void RunBackwards(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  for (std::size_t p = parts; p > 0; --p) {
+    part(p - 1);
+  }
+}
+
+void RunOnThreads(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < parts; ++p) {
+    threads.emplace_back(part, p);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename Value, typename Index = int>
+void CheckRoundTrips(std::size_t rows, std::size_t cols, double density, std::size_t parts,
+                     const ppc::core::PartRunner& run) {
+  std::mt19937 gen(static_cast<unsigned>((rows * 31) + cols + parts));
+  const std::size_t ld = cols + 2;
+  const std::vector<Value> dense = RandomSparseDense<Value>(rows, ld, density, gen);
+
+  const auto csr = ppc::core::CsrMatrix<Value, Index>::FromDense(static_cast<Index>(rows), static_cast<Index>(cols),
+                                                                 dense.data(), ld, 0.0, parts, run);
+  ASSERT_TRUE(csr.IsValid());
+  const auto csc = csr.ToCsc(parts, run);
+  ASSERT_TRUE(csc.IsValid());
+  const auto csc_direct = ppc::core::CscMatrix<Value, Index>::FromDense(
+      static_cast<Index>(rows), static_cast<Index>(cols), dense.data(), ld, 0.0, parts, run);
+  EXPECT_EQ(csc_direct.col_ptr, csc.col_ptr);
+  EXPECT_EQ(csc_direct.row_idx, csc.row_idx);
+  EXPECT_EQ(csc_direct.values, csc.values);
+  const auto back = csc.ToCsr(parts, run);
+  EXPECT_EQ(back.row_ptr, csr.row_ptr);
+  EXPECT_EQ(back.col_idx, csr.col_idx);
+  EXPECT_EQ(back.values, csr.values);
+
+  std::vector<Value> from_csr(rows * ld, Value{7});
+  std::vector<Value> from_csc(rows * ld, Value{7});
+  csr.ToDense(from_csr.data(), ld);
+  csc.ToDense(from_csc.data(), ld);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < ld; ++j) {
+      const Value expected = j < cols ? dense[(i * ld) + j] : Value{7};
+      ASSERT_EQ(from_csr[(i * ld) + j], expected);
+      ASSERT_EQ(from_csc[(i * ld) + j], expected);
+    }
+  }
+}
+
+template <typename Value>
+std::vector<Value> DenseProduct(std::size_t m, std::size_t n, std::size_t k, const std::vector<Value>& a,
+                                const std::vector<Value>& b) {
+  std::vector<Value> c(m * n);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+// Products of an m x k and a k x n matrix in both formats against the dense product. Low densities with wide
+// products take the hash accumulator, high ones the dense accumulator.
+template <typename Value>
+void CheckProduct(std::size_t m, std::size_t n, std::size_t k, double density_a, double density_b,
+                  std::size_t parts, const ppc::core::PartRunner& run) {
+  std::mt19937 gen(static_cast<unsigned>((m * 7) + (n * 5) + k + parts));
+  const std::vector<Value> a = RandomSparseDense<Value>(m, k, density_a, gen);
+  const std::vector<Value> b = RandomSparseDense<Value>(k, n, density_b, gen);
+  const std::vector<Value> expected = DenseProduct(m, n, k, a, b);
+  const auto mi = static_cast<int>(m);
+  const auto ni = static_cast<int>(n);
+  const auto ki = static_cast<int>(k);
+
+  const auto csr_a = ppc::core::CsrMatrix<Value>::FromDense(mi, ki, a.data(), k);
+  const auto csr_b = ppc::core::CsrMatrix<Value>::FromDense(ki, ni, b.data(), n);
+  const auto csr_c = csr_a.Multiply(csr_b, parts, run);
+  ASSERT_TRUE(csr_c.IsValid());
+  ASSERT_EQ(csr_c.rows, mi);
+  ASSERT_EQ(csr_c.cols, ni);
+  const auto csc_c = csr_a.ToCsc().Multiply(csr_b.ToCsc(), parts, run);
+  ASSERT_TRUE(csc_c.IsValid());
+  EXPECT_EQ(csc_c.ToCsr().col_idx, csr_c.col_idx);
+
+  std::vector<Value> from_csr(m * n);
+  std::vector<Value> from_csc(m * n);
+  csr_c.ToDense(from_csr.data(), n);
+  csc_c.ToDense(from_csc.data(), n);
+  for (std::size_t i = 0; i < m * n; ++i) {
+    ASSERT_LE(std::abs(from_csr[i] - expected[i]), 1e-12) << i;
+    ASSERT_LE(std::abs(from_csc[i] - expected[i]), 1e-12) << i;
+  }
+}
+
+// Kernels to run the split complex products with: the scalar loops and, where the CPU has one, a SIMD kernel.
+std::vector<ppc::core::SparseKernel> SplitKernels() {
+  std::vector<ppc::core::SparseKernel> kernels = {ppc::core::SparseKernel::kScalar};
+  if (ppc::core::BestSparseKernel() != ppc::core::SparseKernel::kScalar) {
+    kernels.push_back(ppc::core::BestSparseKernel());
+  }
+  return kernels;
+}
+
+template <typename Split, typename Interleaved>
+void ExpectSameValues(const Split& split, const Interleaved& interleaved) {
+  ASSERT_EQ(split.NonZeros(), interleaved.NonZeros());
+  for (std::size_t e = 0; e < split.NonZeros(); ++e) {
+    ASSERT_NEAR(split.real[e], interleaved.values[e].real(), 1e-12) << e;
+    ASSERT_NEAR(split.imag[e], interleaved.values[e].imag(), 1e-12) << e;
+  }
+}
+
+}  // namespace
+
+TEST(sparse_tests, dense_round_trips) {
+  CheckRoundTrips<double>(50, 40, 0.1, 1, ppc::core::RunPartsSequentially);
+  CheckRoundTrips<float>(33, 61, 0.3, 1, ppc::core::RunPartsSequentially);
+  CheckRoundTrips<std::complex<double>>(20, 20, 0.2, 1, ppc::core::RunPartsSequentially);
+  CheckRoundTrips<double, std::int64_t>(17, 9, 0.5, 1, ppc::core::RunPartsSequentially);
+}
+
+TEST(sparse_tests, parts_do_not_change_the_result) {
+  for (const std::size_t parts : {2, 3, 7, 64}) {
+    CheckRoundTrips<double>(50, 40, 0.1, parts, RunBackwards);
+    CheckRoundTrips<double>(50, 40, 0.1, parts, RunOnThreads);
+  }
+}
+
+TEST(sparse_tests, empty_rows_columns_and_matrices) {
+  CheckRoundTrips<double>(30, 30, 0.0, 4, RunBackwards);
+  CheckRoundTrips<double>(0, 5, 0.5, 4, RunBackwards);
+  CheckRoundTrips<double>(5, 0, 0.5, 4, RunBackwards);
+  CheckRoundTrips<double>(1, 100, 0.05, 4, RunBackwards);
+  CheckRoundTrips<double>(100, 1, 0.05, 4, RunBackwards);
+}
+
+TEST(sparse_tests, tolerance_drops_small_entries) {
+  const std::vector<double> dense = {1.0, 1e-12, 0.0, -1e-12, -2.0, 0.5};
+  const auto csr = ppc::core::CsrMatrix<double>::FromDense(2, 3, dense.data(), 3, 1e-10);
+  EXPECT_EQ(csr.row_ptr, (std::vector<int>{0, 1, 3}));
+  EXPECT_EQ(csr.col_idx, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(csr.values, (std::vector<double>{1.0, -2.0, 0.5}));
+}
+
+TEST(sparse_tests, coo_is_sorted_and_repeats_are_added) {
+  ppc::core::CooMatrix<double> coo;
+  coo.rows = 3;
+  coo.cols = 4;
+  coo.row_idx = {2, 0, 2, 0, 2, 1};
+  coo.col_idx = {3, 1, 0, 1, 3, 2};
+  coo.values = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  ASSERT_TRUE(coo.IsValid());
+  for (const std::size_t parts : {1, 2, 5}) {
+    const auto csr = coo.ToCsr(parts, RunBackwards);
+    ASSERT_TRUE(csr.IsValid());
+    EXPECT_EQ(csr.row_ptr, (std::vector<int>{0, 1, 2, 4}));
+    EXPECT_EQ(csr.col_idx, (std::vector<int>{1, 2, 0, 3}));
+    EXPECT_EQ(csr.values, (std::vector<double>{6.0, 6.0, 3.0, 6.0}));
+  }
+}
+
+TEST(sparse_tests, csr_to_coo_and_back) {
+  std::mt19937 gen(5);
+  const std::vector<double> dense = RandomSparseDense<double>(40, 25, 0.2, gen);
+  const auto csr = ppc::core::CsrMatrix<double>::FromDense(40, 25, dense.data(), 25);
+  auto coo = csr.ToCoo();
+  ASSERT_TRUE(coo.IsValid());
+  // Shuffled entries must come back in order
+  std::vector<std::size_t> order(coo.NonZeros());
+  for (std::size_t e = 0; e < order.size(); ++e) {
+    order[e] = e;
+  }
+  std::shuffle(order.begin(), order.end(), gen);
+  ppc::core::CooMatrix<double> shuffled;
+  shuffled.rows = coo.rows;
+  shuffled.cols = coo.cols;
+  for (const std::size_t e : order) {
+    shuffled.row_idx.push_back(coo.row_idx[e]);
+    shuffled.col_idx.push_back(coo.col_idx[e]);
+    shuffled.values.push_back(coo.values[e]);
+  }
+  const auto back = shuffled.ToCsr(3, RunOnThreads);
+  EXPECT_EQ(back.row_ptr, csr.row_ptr);
+  EXPECT_EQ(back.col_idx, csr.col_idx);
+  EXPECT_EQ(back.values, csr.values);
+}
+
+TEST(sparse_tests, validation_rejects_broken_matrices) {
+  const std::vector<double> dense = {1.0, 0.0, 2.0, 0.0, 3.0, 4.0};
+  const auto good = ppc::core::CsrMatrix<double>::FromDense(2, 3, dense.data(), 3);
+  ASSERT_TRUE(good.IsValid());
+
+  auto unsorted = good;
+  std::swap(unsorted.col_idx[2], unsorted.col_idx[3]);
+  EXPECT_FALSE(unsorted.IsValid());
+
+  auto repeated = good;
+  repeated.col_idx[3] = repeated.col_idx[2];
+  EXPECT_FALSE(repeated.IsValid());
+
+  auto out_of_range = good;
+  out_of_range.col_idx[1] = 3;
+  EXPECT_FALSE(out_of_range.IsValid());
+
+  auto bad_ptr = good;
+  bad_ptr.row_ptr[1] = 5;
+  EXPECT_FALSE(bad_ptr.IsValid());
+
+  auto short_values = good;
+  short_values.values.pop_back();
+  EXPECT_FALSE(short_values.IsValid());
+
+  auto csc = good.ToCsc();
+  ASSERT_TRUE(csc.IsValid());
+  csc.row_idx[0] = -1;
+  EXPECT_FALSE(csc.IsValid());
+
+  ppc::core::CooMatrix<double> coo{.rows = 2, .cols = 2, .row_idx = {0, 2}, .col_idx = {0, 1}, .values = {1, 2}};
+  EXPECT_FALSE(coo.IsValid());
+  coo.row_idx[1] = 1;
+  EXPECT_TRUE(coo.IsValid());
+  coo.values.pop_back();
+  EXPECT_FALSE(coo.IsValid());
+}
+
+TEST(sparse_tests, default_matrix_is_valid_and_empty) {
+  EXPECT_TRUE(ppc::core::CsrMatrix<double>().IsValid());
+  EXPECT_TRUE(ppc::core::CscMatrix<double>().IsValid());
+  EXPECT_TRUE(ppc::core::CooMatrix<double>().IsValid());
+  EXPECT_EQ(ppc::core::CsrMatrix<double>().NonZeros(), 0U);
+}
+
+TEST(sparse_tests, product_with_dense_accumulators) {
+  CheckProduct<double>(40, 30, 35, 0.3, 0.3, 1, ppc::core::RunPartsSequentially);
+  CheckProduct<std::complex<double>>(20, 25, 15, 0.4, 0.4, 1, ppc::core::RunPartsSequentially);
+}
+
+TEST(sparse_tests, product_in_parts) {
+  for (const std::size_t parts : {2, 3, 16}) {
+    CheckProduct<double>(80, 500, 200, 0.02, 0.01, parts, RunBackwards);
+    CheckProduct<double>(80, 500, 200, 0.02, 0.01, parts, RunOnThreads);
+  }
+}
+
+TEST(sparse_tests, wide_product_with_hash_accumulators) {
+  // Too wide for a dense accumulator in any L2, so sparse rows go to hash tables and the dense rows do not
+  constexpr int kCols = 1 << 21;
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> col(0, kCols - 1);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  ppc::core::CooMatrix<double> a{.rows = 50, .cols = 40, .row_idx = {}, .col_idx = {}, .values = {}};
+  ppc::core::CooMatrix<double> b{.rows = 40, .cols = kCols, .row_idx = {}, .col_idx = {}, .values = {}};
+  for (int i = 0; i < 50; ++i) {
+    for (int k = 0; k < (i == 0 ? 40 : 3); ++k) {
+      a.row_idx.push_back(i);
+      a.col_idx.push_back(i == 0 ? k : col(gen) % 40);
+      a.values.push_back(value(gen));
+    }
+  }
+  for (int k = 0; k < 40; ++k) {
+    // Row 0 of A reaches every row of B, enough products for the dense accumulator
+    for (int e = 0; e < (1 << 12); ++e) {
+      b.row_idx.push_back(k);
+      b.col_idx.push_back(e < 8 ? col(gen) : (k * 1024) + e);
+      b.values.push_back(value(gen));
+    }
+  }
+  const auto csr_a = a.ToCsr();
+  const auto csr_b = b.ToCsr();
+  std::map<std::pair<int, int>, double> expected;
+  for (int i = 0; i < csr_a.rows; ++i) {
+    for (int x = csr_a.row_ptr[i]; x < csr_a.row_ptr[i + 1]; ++x) {
+      const int k = csr_a.col_idx[x];
+      for (int y = csr_b.row_ptr[k]; y < csr_b.row_ptr[k + 1]; ++y) {
+        expected[{i, csr_b.col_idx[y]}] += csr_a.values[x] * csr_b.values[y];
+      }
+    }
+  }
+  for (const std::size_t parts : {1, 4}) {
+    const auto c = csr_a.Multiply(csr_b, parts, RunOnThreads);
+    ASSERT_TRUE(c.IsValid());
+    ASSERT_EQ(c.NonZeros(), expected.size());
+    auto it = expected.begin();
+    for (int i = 0; i < c.rows; ++i) {
+      for (int e = c.row_ptr[i]; e < c.row_ptr[i + 1]; ++e, ++it) {
+        ASSERT_EQ(it->first, std::make_pair(i, c.col_idx[e]));
+        ASSERT_NEAR(c.values[e], it->second, 1e-12);
+      }
+    }
+  }
+}
+
+TEST(sparse_tests, product_structure_is_exact) {
+  // The symbolic pass counts entries that cancel out, so they stay as explicit zeros
+  const std::vector<double> a = {1.0, 1.0};
+  const std::vector<double> b = {1.0, -1.0};
+  const auto c = ppc::core::CsrMatrix<double>::FromDense(1, 2, a.data(), 2)
+                     .Multiply(ppc::core::CsrMatrix<double>::FromDense(2, 1, b.data(), 1));
+  EXPECT_EQ(c.row_ptr, (std::vector<int>{0, 1}));
+  EXPECT_EQ(c.values, (std::vector<double>{0.0}));
+
+  const ppc::core::CsrMatrix<double> empty{.rows = 3, .cols = 0, .row_ptr = {0, 0, 0, 0}, .col_idx = {}, .values = {}};
+  const auto none = empty.Multiply(ppc::core::CsrMatrix<double>{.rows = 0,
+                                                                .cols = 4,
+                                                                .row_ptr = {0},
+                                                                .col_idx = {},
+                                                                .values = {}});
+  EXPECT_TRUE(none.IsValid());
+  EXPECT_EQ(none.row_ptr, (std::vector<int>{0, 0, 0, 0}));
+}
+
+TEST(sparse_tests, builder_sums_repeats_across_buffers) {
+  ppc::core::TripletBuilder<double> builder(3, 4, 3);
+  builder.Add(2, 3, 1.0, 0);
+  builder.Add(0, 1, 2.0, 1);
+  builder.Add(2, 0, 3.0, 2);
+  builder.Add(0, 1, 4.0, 0);
+  builder.Add(2, 3, 5.0, 2);
+  builder.Add(1, 2, 6.0, 1);
+  EXPECT_EQ(builder.Size(), 6U);
+  for (const std::size_t parts : {1, 2, 5}) {
+    const auto csr = builder.BuildCsr(parts, RunBackwards);
+    ASSERT_TRUE(csr.IsValid());
+    EXPECT_EQ(csr.row_ptr, (std::vector<int>{0, 1, 2, 4}));
+    EXPECT_EQ(csr.col_idx, (std::vector<int>{1, 2, 0, 3}));
+    EXPECT_EQ(csr.values, (std::vector<double>{6.0, 6.0, 3.0, 6.0}));
+
+    const auto csc = builder.BuildCsc(parts, RunBackwards);
+    ASSERT_TRUE(csc.IsValid());
+    EXPECT_EQ(csc.col_ptr, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(csc.row_idx, (std::vector<int>{2, 0, 1, 2}));
+    EXPECT_EQ(csc.values, (std::vector<double>{3.0, 6.0, 6.0, 6.0}));
+  }
+}
+
+TEST(sparse_tests, builder_filled_from_threads_matches_dense) {
+  constexpr int kRows = 300;
+  constexpr int kCols = 200;
+  constexpr std::size_t kThreads = 4;
+  std::mt19937 gen(45);
+  const auto dense = RandomSparseDense<std::complex<double>>(kRows, kCols, 0.05, gen);
+  ppc::core::TripletBuilder<std::complex<double>> builder(kRows, kCols, kThreads);
+  // Each thread adds its rows backwards, so every row has to be sorted when building
+  RunOnThreads(kThreads, [&](std::size_t t) {
+    for (int i = kRows - 1 - static_cast<int>(t); i >= 0; i -= static_cast<int>(kThreads)) {
+      for (int j = kCols - 1; j >= 0; --j) {
+        if (dense[(i * kCols) + j] != 0.0) {
+          builder.Add(i, j, dense[(i * kCols) + j], t);
+        }
+      }
+    }
+  });
+  const auto expected = ppc::core::CsrMatrix<std::complex<double>>::FromDense(kRows, kCols, dense.data(), kCols);
+  const auto csr = builder.BuildCsr(3, RunOnThreads);
+  ASSERT_TRUE(csr.IsValid());
+  EXPECT_EQ(csr.row_ptr, expected.row_ptr);
+  EXPECT_EQ(csr.col_idx, expected.col_idx);
+  EXPECT_EQ(csr.values, expected.values);
+
+  std::vector<std::complex<double>> out(dense.size());
+  builder.BuildCsc(3, RunOnThreads).ToDense(out.data(), kCols);
+  EXPECT_EQ(out, dense);
+}
+
+TEST(sparse_tests, split_product_matches_interleaved) {
+  using Complex = std::complex<double>;
+  std::mt19937 gen(46);
+  const std::vector<Complex> dense_a = RandomSparseDense<Complex>(45, 60, 0.2, gen);
+  const std::vector<Complex> dense_b = RandomSparseDense<Complex>(60, 50, 0.2, gen);
+  const auto a = ppc::core::CsrMatrix<Complex>::FromDense(45, 60, dense_a.data(), 60);
+  const auto b = ppc::core::CsrMatrix<Complex>::FromDense(60, 50, dense_b.data(), 50);
+
+  // B is also widened to 2^21 columns, so that the sparse rows of the product take the hash accumulator
+  ppc::core::CooMatrix<Complex> wide{.rows = 60, .cols = 1 << 21, .row_idx = {}, .col_idx = {}, .values = {}};
+  std::uniform_int_distribution<int> col(0, (1 << 21) - 1);
+  for (int k = 0; k < 60; ++k) {
+    for (int e = 0; e < 10; ++e) {
+      wide.row_idx.push_back(k);
+      wide.col_idx.push_back(col(gen));
+      wide.values.emplace_back(1.0 / (e + 1), -e);
+    }
+  }
+  const auto wide_b = wide.ToCsr();
+
+  for (const auto& rhs : {b, wide_b}) {
+    const auto expected = a.Multiply(rhs);
+    const auto expected_csc = a.ToCsc().Multiply(rhs.ToCsc());
+    const auto split_a = ppc::core::SplitCsrMatrix<double>::FromInterleaved(a);
+    const auto split_b = ppc::core::SplitCsrMatrix<double>::FromInterleaved(rhs);
+    const auto split_a_csc = ppc::core::SplitCscMatrix<double>::FromInterleaved(a.ToCsc());
+    const auto split_b_csc = ppc::core::SplitCscMatrix<double>::FromInterleaved(rhs.ToCsc());
+    for (const ppc::core::SparseKernel kernel : SplitKernels()) {
+      for (const std::size_t parts : {1, 3}) {
+        const auto c = split_a.Multiply(split_b, parts, RunOnThreads, kernel);
+        ASSERT_TRUE(c.IsValid());
+        EXPECT_EQ(c.row_ptr, expected.row_ptr);
+        EXPECT_EQ(c.col_idx, expected.col_idx);
+        ExpectSameValues(c, expected);
+
+        const auto c_csc = split_a_csc.Multiply(split_b_csc, parts, RunBackwards, kernel);
+        ASSERT_TRUE(c_csc.IsValid());
+        EXPECT_EQ(c_csc.col_ptr, expected_csc.col_ptr);
+        EXPECT_EQ(c_csc.row_idx, expected_csc.row_idx);
+        ExpectSameValues(c_csc, expected_csc);
+      }
+    }
+  }
+}
+
+TEST(sparse_tests, split_vector_product_matches_interleaved) {
+  using Complex = std::complex<double>;
+  constexpr int kRows = 70;
+  constexpr int kCols = 90;
+  std::mt19937 gen(47);
+  const std::vector<Complex> dense = RandomSparseDense<Complex>(kRows, kCols, 0.3, gen);
+  const std::vector<Complex> x = RandomSparseDense<Complex>(kCols, 1, 1.0, gen);
+  const auto a = ppc::core::CsrMatrix<Complex>::FromDense(kRows, kCols, dense.data(), kCols);
+  const std::vector<Complex> expected = DenseProduct(kRows, 1, kCols, dense, x);
+
+  std::vector<Complex> y(kRows);
+  a.MultiplyVector(x.data(), y.data(), 4, RunOnThreads);
+  for (int i = 0; i < kRows; ++i) {
+    ASSERT_LE(std::abs(y[i] - expected[i]), 1e-12) << i;
+  }
+
+  const auto split = ppc::core::SplitCsrMatrix<double>::FromInterleaved(a);
+  std::vector<double> x_real(kCols);
+  std::vector<double> x_imag(kCols);
+  for (int j = 0; j < kCols; ++j) {
+    x_real[j] = x[j].real();
+    x_imag[j] = x[j].imag();
+  }
+  for (const ppc::core::SparseKernel kernel : SplitKernels()) {
+    std::vector<double> y_real(kRows);
+    std::vector<double> y_imag(kRows);
+    split.MultiplyVector(x_real.data(), x_imag.data(), y_real.data(), y_imag.data(), 3, RunBackwards, kernel);
+    for (int i = 0; i < kRows; ++i) {
+      ASSERT_LE(std::abs(Complex(y_real[i], y_imag[i]) - expected[i]), 1e-12) << i;
+    }
+  }
+}
+
+TEST(sparse_tests, sell_vector_product_matches_csr) {
+  constexpr int kRows = 203;
+  constexpr int kCols = 150;
+  std::mt19937 gen(49);
+  std::vector<double> dense = RandomSparseDense<double>(kRows, kCols, 0.05, gen);
+  // A few long rows and an empty one, so that slices differ in width
+  for (int i = 0; i < kRows; i += 37) {
+    std::fill_n(dense.begin() + (i * kCols), kCols / 2, 1.5);
+  }
+  std::fill_n(dense.begin() + (5 * kCols), kCols, 0.0);
+  const std::vector<double> x = RandomSparseDense<double>(kCols, 1, 1.0, gen);
+  const auto a = ppc::core::CsrMatrix<double>::FromDense(kRows, kCols, dense.data(), kCols);
+  std::vector<double> expected(kRows);
+  a.MultiplyVector(x.data(), expected.data());
+
+  for (const int chunk : {1, 4, 8, 32}) {
+    for (const int sigma : {1, 32, 1000}) {
+      const auto sell = ppc::core::SellMatrix<double>::FromCsr(a, chunk, sigma, 3, RunOnThreads);
+      EXPECT_EQ(sell.NonZeros(), a.NonZeros());
+      EXPECT_GE(sell.StoredEntries(), a.NonZeros());
+      std::vector<double> y(kRows, -1.0);
+      sell.MultiplyVector(x.data(), y.data(), 4, RunBackwards);
+      EXPECT_EQ(y, expected) << chunk << " " << sigma;
+    }
+  }
+
+  // Sorting over the whole matrix leaves less padding than keeping the row order
+  const auto unsorted = ppc::core::SellMatrix<double>::FromCsr(a, 8, 1);
+  const auto sorted = ppc::core::SellMatrix<double>::FromCsr(a, 8, kRows);
+  EXPECT_LT(sorted.StoredEntries(), unsorted.StoredEntries());
+  EXPECT_THROW((void)ppc::core::SellMatrix<double>::FromCsr(a, 3, 8), std::invalid_argument);
+}
+
+TEST(sparse_tests, sell_handles_empty_and_complex_matrices) {
+  const ppc::core::CsrMatrix<double> empty;
+  const auto sell = ppc::core::SellMatrix<double>::FromCsr(empty);
+  sell.MultiplyVector(nullptr, nullptr, 4, RunOnThreads);
+  EXPECT_EQ(sell.StoredEntries(), 0U);
+
+  using Complex = std::complex<double>;
+  std::mt19937 gen(50);
+  const std::vector<Complex> dense = RandomSparseDense<Complex>(30, 20, 0.2, gen);
+  const std::vector<Complex> x = RandomSparseDense<Complex>(20, 1, 1.0, gen);
+  const auto a = ppc::core::CsrMatrix<Complex>::FromDense(30, 20, dense.data(), 20);
+  std::vector<Complex> expected(30);
+  std::vector<Complex> y(30);
+  a.MultiplyVector(x.data(), expected.data());
+  ppc::core::SellMatrix<Complex>::FromCsr(a, 4, 16).MultiplyVector(x.data(), y.data(), 2, RunOnThreads);
+  EXPECT_EQ(y, expected);
+}
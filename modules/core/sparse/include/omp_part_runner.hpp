@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ppc::core {
+
+// PartRunner of the OpenMP tasks: the parts are the iterations of a parallel loop, handed out one at a time since
+// parts of equal work can still take unequal time.
+struct OmpPartRunner {
+  void operator()(std::size_t parts, const std::function<void(std::size_t)>& part) const {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int p = 0; p < static_cast<int>(parts); ++p) {
+      part(static_cast<std::size_t>(p));
+    }
+  }
+};
+
+}  // namespace ppc::core
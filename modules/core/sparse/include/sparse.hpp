@@ -0,0 +1,269 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ppc::core {
+
+// Calls part(0) .. part(parts - 1), possibly concurrently, and returns once all of them are done. The conversions
+// below split their work into `parts` independent pieces and leave it to the caller how to run them, so the same
+// code serves the OpenMP, TBB and std::thread tasks.
+using PartRunner = std::function<void(std::size_t parts, const std::function<void(std::size_t)>& part)>;
+
+void RunPartsSequentially(std::size_t parts, const std::function<void(std::size_t)>& part);
+
+template <typename Value, typename Index>
+struct CscMatrix;
+
+template <typename Value, typename Index>
+struct CooMatrix;
+
+// Compressed sparse rows: the entries of row i are at positions [row_ptr[i], row_ptr[i + 1]) of col_idx and
+// values, ordered by column, each column at most once.
+template <typename Value, typename Index = int>
+struct CsrMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  std::vector<Index> row_ptr = std::vector<Index>(1, 0);
+  std::vector<Index> col_idx;
+  std::vector<Value> values;
+
+  // Entries of the row-major rows x cols matrix with leading dimension ld whose magnitude exceeds `tolerance`.
+  // Each part counts the entries of a range of rows, and after a prefix sum over the counts fills that range in.
+  static CsrMatrix FromDense(Index rows, Index cols, const Value* dense, std::size_t ld, double tolerance = 0.0,
+                             std::size_t parts = 1, const PartRunner& run = RunPartsSequentially);
+
+  // Writes every element, zeros included, to a row-major matrix with leading dimension ld.
+  void ToDense(Value* dense, std::size_t ld) const;
+
+  // The same matrix stored by columns, built by a counting sort on the column index: each part histograms the
+  // columns of a range of rows holding about nnz / parts entries, and then scatters those entries to the positions
+  // the histograms of the parts before it leave free. Entries stay ordered, so no sort is needed afterwards.
+  [[nodiscard]] CscMatrix<Value, Index> ToCsc(std::size_t parts = 1,
+                                              const PartRunner& run = RunPartsSequentially) const;
+
+  [[nodiscard]] CooMatrix<Value, Index> ToCoo() const;
+
+  // this * other by Gustavson's algorithm. A symbolic pass finds the exact number of entries of every row of the
+  // product, so the numeric pass fills preallocated arrays without locks. Each row is summed in a dense
+  // accumulator if that fits in L2 or the row's products may reach at least 1/16 of the columns, and in an
+  // open-addressing hash table sized by its product count otherwise. Parts take ranges of rows with about equal
+  // numbers of products. Entries that cancel out are kept as explicit zeros.
+  [[nodiscard]] CsrMatrix Multiply(const CsrMatrix& other, std::size_t parts = 1,
+                                   const PartRunner& run = RunPartsSequentially) const;
+
+  // y = this * x for dense vectors x of cols and y of rows entries. Parts take ranges of rows with about equal
+  // numbers of entries, and every row is summed in column order.
+  void MultiplyVector(const Value* x, Value* y, std::size_t parts = 1,
+                      const PartRunner& run = RunPartsSequentially) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+
+  // Whether the arrays have consistent sizes, row_ptr starts at zero and never decreases, and every row lists
+  // distinct in-range columns in increasing order.
+  [[nodiscard]] bool IsValid() const;
+};
+
+// Compressed sparse columns, the transpose of CsrMatrix: the entries of column j are at positions
+// [col_ptr[j], col_ptr[j + 1]) of row_idx and values, ordered by row.
+template <typename Value, typename Index = int>
+struct CscMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  std::vector<Index> col_ptr = std::vector<Index>(1, 0);
+  std::vector<Index> row_idx;
+  std::vector<Value> values;
+
+  // Compresses the rows as CsrMatrix::FromDense does and transposes the result with CsrMatrix::ToCsc, which reads
+  // the dense matrix along its rows instead of striding down its columns.
+  static CscMatrix FromDense(Index rows, Index cols, const Value* dense, std::size_t ld, double tolerance = 0.0,
+                             std::size_t parts = 1, const PartRunner& run = RunPartsSequentially);
+
+  void ToDense(Value* dense, std::size_t ld) const;
+
+  // Like CsrMatrix::ToCsc, with the roles of rows and columns swapped.
+  [[nodiscard]] CsrMatrix<Value, Index> ToCsr(std::size_t parts = 1,
+                                              const PartRunner& run = RunPartsSequentially) const;
+
+  // Like CsrMatrix::Multiply, with the columns of the product built one at a time.
+  [[nodiscard]] CscMatrix Multiply(const CscMatrix& other, std::size_t parts = 1,
+                                   const PartRunner& run = RunPartsSequentially) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+
+  [[nodiscard]] bool IsValid() const;
+};
+
+// Coordinate list: entry e is values[e] at (row_idx[e], col_idx[e]), in any order, possibly repeated.
+template <typename Value, typename Index = int>
+struct CooMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  std::vector<Index> row_idx;
+  std::vector<Index> col_idx;
+  std::vector<Value> values;
+
+  // Sorts the entries into rows with the same counting sort as CsrMatrix::ToCsc, the parts taking ranges of
+  // entries, then orders each row by column in parallel and adds up repeated entries in the order they were given.
+  [[nodiscard]] CsrMatrix<Value, Index> ToCsr(std::size_t parts = 1,
+                                              const PartRunner& run = RunPartsSequentially) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+
+  // Whether the three arrays have the same length and every index is in range.
+  [[nodiscard]] bool IsValid() const;
+};
+
+// Collects (row, col, value) triplets, possibly from several threads at once, and compresses them in one go. Each
+// thread appends to a buffer of its own, so adding an entry takes no lock and amortized O(1) time.
+template <typename Value, typename Index = int>
+class TripletBuilder {
+ public:
+  TripletBuilder(Index rows, Index cols, std::size_t buffers = 1);
+
+  // Appends to `buffer`, which only one thread may use at a time. Repeated positions are summed when building.
+  void Add(Index row, Index col, const Value& value, std::size_t buffer = 0) {
+    Buffer& b = buffers_[buffer];
+    b.rows.push_back(row);
+    b.cols.push_back(col);
+    b.values.push_back(value);
+  }
+
+  void Reserve(std::size_t buffer, std::size_t count);
+
+  // Triplets added so far, repeats included.
+  [[nodiscard]] std::size_t Size() const;
+
+  // Counting sort by row with a part per buffer, as CooMatrix::ToCsr does, then rows sorted and summed in parts.
+  // Repeats are summed buffer by buffer in the order they were added.
+  [[nodiscard]] CsrMatrix<Value, Index> BuildCsr(std::size_t parts = 1,
+                                                 const PartRunner& run = RunPartsSequentially) const;
+  [[nodiscard]] CscMatrix<Value, Index> BuildCsc(std::size_t parts = 1,
+                                                 const PartRunner& run = RunPartsSequentially) const;
+
+ private:
+  // Aligned to a cache line so that threads appending to neighbouring buffers do not share one
+  struct alignas(64) Buffer {
+    std::vector<Index> rows;
+    std::vector<Index> cols;
+    std::vector<Value> values;
+  };
+
+  Index rows_;
+  Index cols_;
+  std::vector<Buffer> buffers_;
+};
+
+// SELL-C-sigma storage for matrix-vector products. Rows are sorted by decreasing length within windows of `sigma`
+// rows and the sorted rows cut into slices of `chunk`. A slice is stored column by column and padded to its longest
+// row: entry k of its rows lies at [slice_ptr[s] + k * chunk, slice_ptr[s] + (k + 1) * chunk). The rows of a slice
+// are then summed in lockstep by a loop the compiler vectorizes over the chunk, where CSR rows of different lengths
+// leave SIMD lanes idle. Wider windows leave less padding but move rows further from their order, and with it the
+// reads of y.
+template <typename Value, typename Index = int>
+struct SellMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  Index chunk = 8;
+  Index sigma = 1;
+  // Row i of the sorted order is row perm[i] of the matrix.
+  std::vector<Index> perm;
+  std::vector<Index> slice_ptr = std::vector<Index>(1, 0);
+  // Padding repeats the last column of its row with value zero.
+  std::vector<Index> col_idx;
+  std::vector<Value> values;
+  std::size_t nonzeros = 0;
+
+  // `chunk` must be 1, 2, 4, 8, 16 or 32 and `sigma` positive; throws std::invalid_argument otherwise. Parts sort
+  // ranges of windows and then fill ranges of slices.
+  static SellMatrix FromCsr(const CsrMatrix<Value, Index>& matrix, Index chunk = 8, Index sigma = 256,
+                            std::size_t parts = 1, const PartRunner& run = RunPartsSequentially);
+
+  // y = this * x as CsrMatrix::MultiplyVector does, the parts taking ranges of slices with about equal numbers of
+  // stored entries. Rows are summed in column order with the padding last, so the results equal the CSR ones as
+  // long as x is finite.
+  void MultiplyVector(const Value* x, Value* y, std::size_t parts = 1,
+                      const PartRunner& run = RunPartsSequentially) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return nonzeros; }
+
+  // Entries stored, padding included.
+  [[nodiscard]] std::size_t StoredEntries() const { return values.size(); }
+};
+
+// Storage a task multiplies vectors with.
+enum class SpmvFormat : uint8_t { kCsr, kSell };
+
+// Kernels of the split complex products below. kAvx2 needs an x86 CPU with AVX2 and covers double values with int
+// indices; other element types take the scalar loops whatever the kernel.
+enum class SparseKernel : uint8_t { kScalar, kAvx2 };
+
+bool IsSparseKernelSupported(SparseKernel kernel);
+
+// Widest supported kernel; chosen once at the first call.
+SparseKernel BestSparseKernel();
+
+// How a task holds complex values: as std::complex pairs, or split into an array of real and one of imaginary parts.
+enum class ComplexStorage : uint8_t { kInterleaved, kSplit };
+
+// CsrMatrix<std::complex<Real>> with the values split into real and imag. A row of B then lies in two contiguous
+// arrays of Real, which a kernel multiplies four entries at a time, where std::complex products are formed one by
+// one.
+template <typename Real, typename Index = int>
+struct SplitCsrMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  std::vector<Index> row_ptr = std::vector<Index>(1, 0);
+  std::vector<Index> col_idx;
+  std::vector<Real> real;
+  std::vector<Real> imag;
+
+  static SplitCsrMatrix FromInterleaved(const CsrMatrix<std::complex<Real>, Index>& matrix);
+
+  [[nodiscard]] CsrMatrix<std::complex<Real>, Index> ToInterleaved() const;
+
+  // this * other by Gustavson's algorithm, with the passes, parts and accumulators of CsrMatrix::Multiply. Products
+  // are rounded and summed in the same order, so the entries equal those of the interleaved product unless the
+  // compiler contracts multiply-adds differently in the two.
+  [[nodiscard]] SplitCsrMatrix Multiply(const SplitCsrMatrix& other, std::size_t parts = 1,
+                                        const PartRunner& run = RunPartsSequentially,
+                                        SparseKernel kernel = BestSparseKernel()) const;
+
+  // y = this * x as CsrMatrix::MultiplyVector does. The AVX2 kernel keeps four partial sums per row, so its results
+  // differ from the interleaved ones by rounding.
+  void MultiplyVector(const Real* x_real, const Real* x_imag, Real* y_real, Real* y_imag, std::size_t parts = 1,
+                      const PartRunner& run = RunPartsSequentially, SparseKernel kernel = BestSparseKernel()) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return real.size(); }
+
+  [[nodiscard]] bool IsValid() const;
+};
+
+// CscMatrix<std::complex<Real>> with split values.
+template <typename Real, typename Index = int>
+struct SplitCscMatrix {
+  Index rows = 0;
+  Index cols = 0;
+  std::vector<Index> col_ptr = std::vector<Index>(1, 0);
+  std::vector<Index> row_idx;
+  std::vector<Real> real;
+  std::vector<Real> imag;
+
+  static SplitCscMatrix FromInterleaved(const CscMatrix<std::complex<Real>, Index>& matrix);
+
+  [[nodiscard]] CscMatrix<std::complex<Real>, Index> ToInterleaved() const;
+
+  // Like SplitCsrMatrix::Multiply, with the columns of the product built one at a time.
+  [[nodiscard]] SplitCscMatrix Multiply(const SplitCscMatrix& other, std::size_t parts = 1,
+                                        const PartRunner& run = RunPartsSequentially,
+                                        SparseKernel kernel = BestSparseKernel()) const;
+
+  [[nodiscard]] std::size_t NonZeros() const { return real.size(); }
+
+  [[nodiscard]] bool IsValid() const;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace ppc::core {
+
+// PartRunner of the std::thread tasks: a thread per part, all joined before returning.
+struct StlPartRunner {
+  void operator()(std::size_t parts, const std::function<void(std::size_t)>& part) const {
+    std::vector<std::thread> threads;
+    threads.reserve(parts);
+    for (std::size_t p = 0; p < parts; ++p) {
+      threads.emplace_back(part, p);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "oneapi/tbb/parallel_for.h"
+#include "oneapi/tbb/task_arena.h"
+
+namespace ppc::core {
+
+// PartRunner of the TBB tasks: a parallel_for over the parts, run inside `arena` when one is given so that the
+// task keeps to its thread count, and in the arena of the caller otherwise. The arena must outlive the runner.
+class TbbPartRunner {
+ public:
+  TbbPartRunner() = default;
+  explicit TbbPartRunner(oneapi::tbb::task_arena& arena) : arena_(&arena) {}
+
+  void operator()(std::size_t parts, const std::function<void(std::size_t)>& part) const {
+    if (arena_ == nullptr) {
+      oneapi::tbb::parallel_for(std::size_t{0}, parts, part);
+      return;
+    }
+    arena_->execute([&] { oneapi::tbb::parallel_for(std::size_t{0}, parts, part); });
+  }
+
+ private:
+  oneapi::tbb::task_arena* arena_ = nullptr;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,1233 @@
+#include "core/sparse/include/sparse.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/tuning/include/tuning.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PPC_SPARSE_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// [0, n) is split into `parts` near-equal ranges; range p is [EvenSplit(n, parts, p), EvenSplit(n, parts, p + 1)).
+std::size_t EvenSplit(std::size_t n, std::size_t parts, std::size_t p) { return (n * p) / parts; }
+
+// Parts worth running for n items: at least one, so that the sizes of empty matrices get written too.
+std::size_t UsefulParts(std::size_t parts, std::size_t n) { return std::max<std::size_t>(1, std::min(parts, n)); }
+
+template <typename Value>
+bool IsNonZero(const Value& value, double tolerance) {
+  return static_cast<double>(std::abs(value)) > tolerance;
+}
+
+// Splits the slices of a compressed matrix, or any items with the running totals `prefix` of their weights, into
+// `parts` ranges of about equal weight: part p takes [first[p], first[p + 1]).
+template <typename T>
+std::vector<std::size_t> BalancedStarts(const std::vector<T>& prefix, std::size_t parts) {
+  const std::size_t items = prefix.size() - 1;
+  const auto total = static_cast<std::size_t>(prefix.back());
+  std::vector<std::size_t> first(parts + 1, items);
+  for (std::size_t p = 0; p < parts; ++p) {
+    const auto target = static_cast<T>(EvenSplit(total, parts, p));
+    first[p] = static_cast<std::size_t>(std::ranges::lower_bound(prefix, target) - prefix.begin());
+  }
+  return first;
+}
+
+// counts[p * buckets + b] holds how many entries part p has for bucket b. Replaces it with the position of the
+// first of those entries among all entries of bucket b, and returns where each bucket starts, ending with the total.
+template <typename Index>
+std::vector<Index> BucketOffsets(std::size_t parts, std::size_t buckets, std::vector<std::size_t>& counts,
+                                 std::size_t run_parts, const ppc::core::PartRunner& run) {
+  std::vector<Index> bucket_ptr(buckets + 1, 0);
+  run_parts = UsefulParts(run_parts, buckets);
+  run(run_parts, [&](std::size_t part) {
+    for (std::size_t b = EvenSplit(buckets, run_parts, part); b < EvenSplit(buckets, run_parts, part + 1); ++b) {
+      std::size_t total = 0;
+      for (std::size_t p = 0; p < parts; ++p) {
+        const std::size_t count = counts[(p * buckets) + b];
+        counts[(p * buckets) + b] = total;
+        total += count;
+      }
+      bucket_ptr[b + 1] = static_cast<Index>(total);
+    }
+  });
+  std::inclusive_scan(bucket_ptr.begin(), bucket_ptr.end(), bucket_ptr.begin());
+  return bucket_ptr;
+}
+
+// Compresses the rows of a row-major dense matrix: counts per row, prefix sum, then fill.
+template <typename Value, typename Index>
+void CompressRows(std::size_t rows, std::size_t cols, const Value* dense, std::size_t ld, double tolerance,
+                  std::size_t parts, const ppc::core::PartRunner& run, std::vector<Index>& ptr,
+                  std::vector<Index>& idx, std::vector<Value>& values) {
+  parts = UsefulParts(parts, rows);
+  ptr.assign(rows + 1, 0);
+  run(parts, [&](std::size_t part) {
+    for (std::size_t i = EvenSplit(rows, parts, part); i < EvenSplit(rows, parts, part + 1); ++i) {
+      const Value* row = dense + (i * ld);
+      ptr[i + 1] = static_cast<Index>(std::count_if(row, row + cols, [&](const Value& v) {
+        return IsNonZero(v, tolerance);
+      }));
+    }
+  });
+  std::inclusive_scan(ptr.begin(), ptr.end(), ptr.begin());
+  idx.resize(static_cast<std::size_t>(ptr.back()));
+  values.resize(idx.size());
+  run(parts, [&](std::size_t part) {
+    for (std::size_t i = EvenSplit(rows, parts, part); i < EvenSplit(rows, parts, part + 1); ++i) {
+      const Value* row = dense + (i * ld);
+      auto pos = static_cast<std::size_t>(ptr[i]);
+      for (std::size_t j = 0; j < cols; ++j) {
+        if (IsNonZero(row[j], tolerance)) {
+          idx[pos] = static_cast<Index>(j);
+          values[pos] = row[j];
+          ++pos;
+        }
+      }
+    }
+  });
+}
+
+// Writes an outer x inner compressed matrix to dense memory, element (o, i) going to o * outer_stride +
+// i * inner_stride. Rows of the dense matrix are ld apart and are zeroed first.
+template <typename Value, typename Index>
+void Expand(std::size_t outer, const std::vector<Index>& ptr, const std::vector<Index>& idx,
+            const std::vector<Value>& values, std::size_t rows, std::size_t cols, Value* dense, std::size_t ld,
+            std::size_t outer_stride, std::size_t inner_stride) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    std::fill(dense + (i * ld), dense + (i * ld) + cols, Value{});
+  }
+  for (std::size_t o = 0; o < outer; ++o) {
+    for (auto e = static_cast<std::size_t>(ptr[o]); e < static_cast<std::size_t>(ptr[o + 1]); ++e) {
+      dense[(o * outer_stride) + (static_cast<std::size_t>(idx[e]) * inner_stride)] = values[e];
+    }
+  }
+}
+
+// Counting sort of the entries of an outer x inner compressed matrix by their inner index, which gives the same
+// matrix compressed along the other dimension. Entries are visited in order, so every new slice comes out sorted.
+template <typename Value, typename Index>
+void Transpose(std::size_t outer, std::size_t inner, const std::vector<Index>& ptr, const std::vector<Index>& idx,
+               const std::vector<Value>& values, std::size_t parts, const ppc::core::PartRunner& run,
+               std::vector<Index>& t_ptr, std::vector<Index>& t_idx, std::vector<Value>& t_values) {
+  const std::size_t nnz = values.size();
+  const std::size_t requested = parts;
+  parts = UsefulParts(parts, outer);
+  const std::vector<std::size_t> first = BalancedStarts(ptr, parts);
+
+  std::vector<std::size_t> offsets(parts * inner, 0);
+  run(parts, [&](std::size_t part) {
+    std::size_t* count = offsets.data() + (part * inner);
+    for (auto e = static_cast<std::size_t>(ptr[first[part]]); e < static_cast<std::size_t>(ptr[first[part + 1]]);
+         ++e) {
+      ++count[idx[e]];
+    }
+  });
+  t_ptr = BucketOffsets<Index>(parts, inner, offsets, requested, run);
+  t_idx.resize(nnz);
+  t_values.resize(nnz);
+  run(parts, [&](std::size_t part) {
+    std::size_t* next = offsets.data() + (part * inner);
+    for (std::size_t o = first[part]; o < first[part + 1]; ++o) {
+      for (auto e = static_cast<std::size_t>(ptr[o]); e < static_cast<std::size_t>(ptr[o + 1]); ++e) {
+        const auto i = static_cast<std::size_t>(idx[e]);
+        const std::size_t pos = static_cast<std::size_t>(t_ptr[i]) + next[i]++;
+        t_idx[pos] = static_cast<Index>(o);
+        t_values[pos] = values[e];
+      }
+    }
+  });
+}
+
+template <typename Value, typename Index>
+bool IsValidCompressed(Index outer, Index inner, const std::vector<Index>& ptr, const std::vector<Index>& idx,
+                       const std::vector<Value>& values) {
+  if (outer < 0 || inner < 0 || ptr.size() != static_cast<std::size_t>(outer) + 1 || ptr.front() != 0 ||
+      static_cast<std::size_t>(ptr.back()) != idx.size() || idx.size() != values.size()) {
+    return false;
+  }
+  for (std::size_t o = 0; o + 1 < ptr.size(); ++o) {
+    if (ptr[o + 1] < ptr[o]) {
+      return false;
+    }
+    for (auto e = static_cast<std::size_t>(ptr[o]); e < static_cast<std::size_t>(ptr[o + 1]); ++e) {
+      if (idx[e] < 0 || idx[e] >= inner || (e > static_cast<std::size_t>(ptr[o]) && idx[e] <= idx[e - 1])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Sums the products that make up one row of C, indexed by column. The dense form keeps a slot per column of C and
+// the stamp of the row that last wrote it, so starting a row costs nothing.
+template <typename Value, typename Index>
+class DenseAccumulator {
+ public:
+  explicit DenseAccumulator(std::size_t cols) : stamps_(cols, 0), sums_(cols) {}
+
+  void Start(std::size_t /*flops*/) { ++stamp_; }
+
+  // Whether the column had no entry yet in this row
+  bool Add(Index col, const Value& value) {
+    const auto c = static_cast<std::size_t>(col);
+    if (stamps_[c] != stamp_) {
+      stamps_[c] = stamp_;
+      sums_[c] = value;
+      return true;
+    }
+    sums_[c] += value;
+    return false;
+  }
+
+  const Value& Sum(Index col) const { return sums_[static_cast<std::size_t>(col)]; }
+
+ private:
+  std::size_t stamp_ = 0;
+  std::vector<std::size_t> stamps_;
+  std::vector<Value> sums_;
+};
+
+// Open addressing with linear probing in a power-of-two table of at least twice the row's products, which holds
+// only as many slots as the row can fill. The table grows, but is never reallocated for a row that fits.
+template <typename Value, typename Index>
+class HashAccumulator {
+ public:
+  void Start(std::size_t flops) {
+    const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(2 * flops, 2));
+    if (keys_.size() < capacity) {
+      keys_.resize(capacity);
+      sums_.resize(capacity);
+    }
+    std::fill_n(keys_.begin(), capacity, kEmpty);
+    shift_ = 64 - std::countr_zero(capacity);
+    mask_ = capacity - 1;
+  }
+
+  bool Add(Index col, const Value& value) {
+    const std::size_t slot = Find(col);
+    if (keys_[slot] == kEmpty) {
+      keys_[slot] = col;
+      sums_[slot] = value;
+      return true;
+    }
+    sums_[slot] += value;
+    return false;
+  }
+
+  const Value& Sum(Index col) const { return sums_[Find(col)]; }
+
+ private:
+  static constexpr Index kEmpty = -1;
+
+  // Slot holding col, or the empty slot where it goes
+  [[nodiscard]] std::size_t Find(Index col) const {
+    // Fibonacci hashing: the top bits of the product spread consecutive columns over the table
+    auto slot = static_cast<std::size_t>((static_cast<std::uint64_t>(col) * 0x9E3779B97F4A7C15ULL) >> shift_);
+    while (keys_[slot] != kEmpty && keys_[slot] != col) {
+      slot = (slot + 1) & mask_;
+    }
+    return slot;
+  }
+
+  int shift_ = 63;
+  std::size_t mask_ = 0;
+  std::vector<Index> keys_;
+  std::vector<Value> sums_;
+};
+
+// Rows whose products may touch at least 1 / kDenseRatio of the columns of C use the dense accumulator, and so do
+// all rows when its arrays fit in L2: then a random access costs less than hashing and probing.
+constexpr std::size_t kDenseRatio = 16;
+
+template <typename Value>
+bool DenseAccumulatorFitsL2(std::size_t cols) {
+  return cols * (sizeof(Value) + sizeof(std::size_t)) <= ppc::core::HostCacheSizes().l2;
+}
+
+// flops[i + 1] - flops[i] is the number of products in row i of A * B for compressed-row A (m rows) and B.
+template <typename Index>
+std::vector<std::size_t> ProductFlops(std::size_t m, const std::vector<Index>& a_ptr, const std::vector<Index>& a_idx,
+                                      const std::vector<Index>& b_ptr, std::size_t row_parts,
+                                      const ppc::core::PartRunner& run) {
+  std::vector<std::size_t> flops(m + 1, 0);
+  run(row_parts, [&](std::size_t part) {
+    for (std::size_t i = EvenSplit(m, row_parts, part); i < EvenSplit(m, row_parts, part + 1); ++i) {
+      for (auto k = static_cast<std::size_t>(a_ptr[i]); k < static_cast<std::size_t>(a_ptr[i + 1]); ++k) {
+        flops[i + 1] += static_cast<std::size_t>(b_ptr[a_idx[k] + 1] - b_ptr[a_idx[k]]);
+      }
+    }
+  });
+  std::inclusive_scan(flops.begin(), flops.end(), flops.begin());
+  return flops;
+}
+
+// C = A * B for compressed-row A (m rows) and B (n columns) by Gustavson's algorithm: row i of C is the sum of the
+// rows of B picked by the entries of row i of A. A symbolic pass counts the distinct columns of every row, so that
+// after a prefix sum the numeric pass writes each row straight to its final place. Rows are split into parts of
+// about equal numbers of products, and each part keeps one accumulator of each kind for all its rows.
+template <typename Value, typename Index>
+void Gustavson(std::size_t m, std::size_t n, const std::vector<Index>& a_ptr, const std::vector<Index>& a_idx,
+               const std::vector<Value>& a_values, const std::vector<Index>& b_ptr, const std::vector<Index>& b_idx,
+               const std::vector<Value>& b_values, std::size_t parts, const ppc::core::PartRunner& run,
+               std::vector<Index>& c_ptr, std::vector<Index>& c_idx, std::vector<Value>& c_values) {
+  const std::size_t row_parts = UsefulParts(parts, m);
+  const std::vector<std::size_t> flops = ProductFlops(m, a_ptr, a_idx, b_ptr, row_parts, run);
+  const std::vector<std::size_t> first = BalancedStarts(flops, row_parts);
+  const bool always_dense = DenseAccumulatorFitsL2<Value>(n);
+
+  // Runs row(accumulator, i) for the rows of a part, each with the accumulator that suits it
+  const auto for_each_row = [&](std::size_t part, const auto& row) {
+    std::optional<DenseAccumulator<Value, Index>> dense;
+    HashAccumulator<Value, Index> hash;
+    for (std::size_t i = first[part]; i < first[part + 1]; ++i) {
+      const std::size_t row_flops = flops[i + 1] - flops[i];
+      if (row_flops == 0) {
+        continue;
+      }
+      if (always_dense || row_flops * kDenseRatio >= n) {
+        if (!dense) {
+          dense.emplace(n);
+        }
+        dense->Start(row_flops);
+        row(*dense, i);
+      } else {
+        hash.Start(row_flops);
+        row(hash, i);
+      }
+    }
+  };
+  const auto accumulate = [&](auto& accumulator, std::size_t i, const auto& on_new) {
+    for (auto k = static_cast<std::size_t>(a_ptr[i]); k < static_cast<std::size_t>(a_ptr[i + 1]); ++k) {
+      const Value& a = a_values[k];
+      const auto b_row = static_cast<std::size_t>(a_idx[k]);
+      for (auto e = static_cast<std::size_t>(b_ptr[b_row]); e < static_cast<std::size_t>(b_ptr[b_row + 1]); ++e) {
+        if (accumulator.Add(b_idx[e], a * b_values[e])) {
+          on_new(b_idx[e]);
+        }
+      }
+    }
+  };
+
+  c_ptr.assign(m + 1, 0);
+  run(row_parts, [&](std::size_t part) {
+    for_each_row(part, [&](auto& accumulator, std::size_t i) {
+      Index count = 0;
+      accumulate(accumulator, i, [&](Index) { ++count; });
+      c_ptr[i + 1] = count;
+    });
+  });
+  std::inclusive_scan(c_ptr.begin(), c_ptr.end(), c_ptr.begin());
+
+  c_idx.resize(static_cast<std::size_t>(c_ptr.back()));
+  c_values.resize(c_idx.size());
+  run(row_parts, [&](std::size_t part) {
+    for_each_row(part, [&](auto& accumulator, std::size_t i) {
+      const auto begin = c_idx.begin() + c_ptr[i];
+      auto next = begin;
+      accumulate(accumulator, i, [&](Index col) { *next++ = col; });
+      std::sort(begin, next);
+      for (auto e = static_cast<std::size_t>(c_ptr[i]); e < static_cast<std::size_t>(c_ptr[i + 1]); ++e) {
+        c_values[e] = accumulator.Sum(c_idx[e]);
+      }
+    });
+  });
+}
+
+// Sums of one split complex row of C: real and imaginary parts in separate arrays, which the kernels below add runs
+// of products to. Stamps mark the columns the current row has touched, as in DenseAccumulator.
+template <typename Real>
+class SplitDenseAccumulator {
+ public:
+  explicit SplitDenseAccumulator(std::size_t cols) : stamps_(cols, 0), real_(cols), imag_(cols) {}
+
+  void Start() { ++stamp_; }
+
+  // Whether the column had no entry yet in this row; its sums then start from zero
+  template <typename Index>
+  bool Mark(Index col) {
+    const auto c = static_cast<std::size_t>(col);
+    if (stamps_[c] == stamp_) {
+      return false;
+    }
+    stamps_[c] = stamp_;
+    real_[c] = Real{0};
+    imag_[c] = Real{0};
+    return true;
+  }
+
+  Real* RealSums() { return real_.data(); }
+  Real* ImagSums() { return imag_.data(); }
+
+ private:
+  std::size_t stamp_ = 0;
+  std::vector<std::size_t> stamps_;
+  std::vector<Real> real_;
+  std::vector<Real> imag_;
+};
+
+// sum[idx[e]] += a * b[e] for e < count, the columns idx distinct. The product is formed as std::complex forms it,
+// (ar * br - ai * bi) + (ar * bi + ai * br)i, so the sums match those of the interleaved Gustavson kernel.
+template <typename Real, typename Index>
+using SplitAxpyFn = void (*)(Real a_real, Real a_imag, const Index* idx, const Real* b_real, const Real* b_imag,
+                             std::size_t count, Real* sum_real, Real* sum_imag);
+
+// Dot product of one row of A with x: y = sum of a[e] * x[idx[e]] for e < count.
+template <typename Real, typename Index>
+using SplitDotFn = void (*)(const Index* idx, const Real* a_real, const Real* a_imag, std::size_t count,
+                            const Real* x_real, const Real* x_imag, Real& y_real, Real& y_imag);
+
+template <typename Real, typename Index>
+void SplitAxpyScalar(Real a_real, Real a_imag, const Index* idx, const Real* b_real, const Real* b_imag,
+                     std::size_t count, Real* sum_real, Real* sum_imag) {
+  for (std::size_t e = 0; e < count; ++e) {
+    const auto c = static_cast<std::size_t>(idx[e]);
+    sum_real[c] += (a_real * b_real[e]) - (a_imag * b_imag[e]);
+    sum_imag[c] += (a_real * b_imag[e]) + (a_imag * b_real[e]);
+  }
+}
+
+template <typename Real, typename Index>
+void SplitDotScalar(const Index* idx, const Real* a_real, const Real* a_imag, std::size_t count, const Real* x_real,
+                    const Real* x_imag, Real& y_real, Real& y_imag) {
+  Real sum_real{0};
+  Real sum_imag{0};
+  for (std::size_t e = 0; e < count; ++e) {
+    const auto c = static_cast<std::size_t>(idx[e]);
+    sum_real += (a_real[e] * x_real[c]) - (a_imag[e] * x_imag[c]);
+    sum_imag += (a_real[e] * x_imag[c]) + (a_imag[e] * x_real[c]);
+  }
+  y_real = sum_real;
+  y_imag = sum_imag;
+}
+
+#ifdef PPC_SPARSE_X86
+
+// base[idx[lane]] for the four lanes, from scalar loads: hardware gathers are slower than that on many CPUs, and
+// much slower where microcode mitigates gather data sampling.
+__attribute__((target("avx2"))) __m256d GatherAvx2(const double* base, const int* idx) {
+  return _mm256_set_pd(base[idx[3]], base[idx[2]], base[idx[1]], base[idx[0]]);
+}
+
+// Four products at a time from contiguous loads of the B row; the sums are gathered, added to and written back
+// lane by lane, as AVX2 has no scatter. No FMA, so that every product rounds as in the scalar loop. The tails stay
+// in these functions: calling the scalar loops with the upper halves of the ymm registers dirty would stall every
+// SSE instruction after them.
+__attribute__((target("avx2"))) void SplitAxpyAvx2(double a_real, double a_imag, const int* idx, const double* b_real,
+                                                   const double* b_imag, std::size_t count, double* sum_real,
+                                                   double* sum_imag) {
+  const __m256d ar = _mm256_set1_pd(a_real);
+  const __m256d ai = _mm256_set1_pd(a_imag);
+  std::size_t e = 0;
+  for (; e + 4 <= count; e += 4) {
+    const __m256d br = _mm256_loadu_pd(b_real + e);
+    const __m256d bi = _mm256_loadu_pd(b_imag + e);
+    const __m256d pr = _mm256_sub_pd(_mm256_mul_pd(ar, br), _mm256_mul_pd(ai, bi));
+    const __m256d pi = _mm256_add_pd(_mm256_mul_pd(ar, bi), _mm256_mul_pd(ai, br));
+    alignas(32) double re[4];
+    alignas(32) double im[4];
+    _mm256_store_pd(re, _mm256_add_pd(GatherAvx2(sum_real, idx + e), pr));
+    _mm256_store_pd(im, _mm256_add_pd(GatherAvx2(sum_imag, idx + e), pi));
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      sum_real[idx[e + lane]] = re[lane];
+      sum_imag[idx[e + lane]] = im[lane];
+    }
+  }
+  for (; e < count; ++e) {
+    sum_real[idx[e]] += (a_real * b_real[e]) - (a_imag * b_imag[e]);
+    sum_imag[idx[e]] += (a_real * b_imag[e]) + (a_imag * b_real[e]);
+  }
+}
+
+// Four lanes of partial sums, added up at the end of the row; the result differs from the scalar loop by rounding.
+__attribute__((target("avx2"))) void SplitDotAvx2(const int* idx, const double* a_real, const double* a_imag,
+                                                  std::size_t count, const double* x_real, const double* x_imag,
+                                                  double& y_real, double& y_imag) {
+  __m256d sum_real = _mm256_setzero_pd();
+  __m256d sum_imag = _mm256_setzero_pd();
+  std::size_t e = 0;
+  for (; e + 4 <= count; e += 4) {
+    const __m256d ar = _mm256_loadu_pd(a_real + e);
+    const __m256d ai = _mm256_loadu_pd(a_imag + e);
+    const __m256d xr = GatherAvx2(x_real, idx + e);
+    const __m256d xi = GatherAvx2(x_imag, idx + e);
+    sum_real = _mm256_add_pd(sum_real, _mm256_sub_pd(_mm256_mul_pd(ar, xr), _mm256_mul_pd(ai, xi)));
+    sum_imag = _mm256_add_pd(sum_imag, _mm256_add_pd(_mm256_mul_pd(ar, xi), _mm256_mul_pd(ai, xr)));
+  }
+  alignas(32) double re[4];
+  alignas(32) double im[4];
+  _mm256_store_pd(re, sum_real);
+  _mm256_store_pd(im, sum_imag);
+  double tail_real = 0.0;
+  double tail_imag = 0.0;
+  for (; e < count; ++e) {
+    tail_real += (a_real[e] * x_real[idx[e]]) - (a_imag[e] * x_imag[idx[e]]);
+    tail_imag += (a_real[e] * x_imag[idx[e]]) + (a_imag[e] * x_real[idx[e]]);
+  }
+  y_real = ((re[0] + re[1]) + (re[2] + re[3])) + tail_real;
+  y_imag = ((im[0] + im[1]) + (im[2] + im[3])) + tail_imag;
+}
+
+#endif  // PPC_SPARSE_X86
+
+template <typename Real, typename Index>
+struct SplitKernels {
+  SplitAxpyFn<Real, Index> axpy;
+  SplitDotFn<Real, Index> dot;
+};
+
+template <typename Real, typename Index>
+SplitKernels<Real, Index> GetSplitKernels(ppc::core::SparseKernel kernel) {
+#ifdef PPC_SPARSE_X86
+  if constexpr (std::is_same_v<Real, double> && std::is_same_v<Index, int>) {
+    if (kernel == ppc::core::SparseKernel::kAvx2) {
+      return {.axpy = &SplitAxpyAvx2, .dot = &SplitDotAvx2};
+    }
+  }
+#endif
+  return {.axpy = &SplitAxpyScalar<Real, Index>, .dot = &SplitDotScalar<Real, Index>};
+}
+
+// The arrays of a compressed matrix with split complex values.
+template <typename Real, typename Index>
+struct SplitArrays {
+  const std::vector<Index>& ptr;
+  const std::vector<Index>& idx;
+  const std::vector<Real>& real;
+  const std::vector<Real>& imag;
+};
+
+// Gustavson's algorithm as above for split complex values, with the same passes, parts and choice of accumulator.
+// Rows summed densely go through the kernel one row of B at a time; rows summed in the hash table take their
+// products one by one, as they would with interleaved values.
+template <typename Real, typename Index>
+void SplitGustavson(std::size_t m, std::size_t n, const SplitArrays<Real, Index>& a, const SplitArrays<Real, Index>& b,
+                    std::size_t parts, const ppc::core::PartRunner& run, ppc::core::SparseKernel kernel,
+                    std::vector<Index>& c_ptr, std::vector<Index>& c_idx, std::vector<Real>& c_real,
+                    std::vector<Real>& c_imag) {
+  using Complex = std::complex<Real>;
+  const std::size_t row_parts = UsefulParts(parts, m);
+  const std::vector<std::size_t> flops = ProductFlops(m, a.ptr, a.idx, b.ptr, row_parts, run);
+  const std::vector<std::size_t> first = BalancedStarts(flops, row_parts);
+  const bool always_dense = DenseAccumulatorFitsL2<Complex>(n);
+  const SplitAxpyFn<Real, Index> axpy = GetSplitKernels<Real, Index>(kernel).axpy;
+
+  // Runs dense_row(accumulator, i) or hash_row(accumulator, i) for the rows of a part
+  const auto for_each_row = [&](std::size_t part, const auto& dense_row, const auto& hash_row) {
+    std::optional<SplitDenseAccumulator<Real>> dense;
+    HashAccumulator<Complex, Index> hash;
+    for (std::size_t i = first[part]; i < first[part + 1]; ++i) {
+      const std::size_t row_flops = flops[i + 1] - flops[i];
+      if (row_flops == 0) {
+        continue;
+      }
+      if (always_dense || row_flops * kDenseRatio >= n) {
+        if (!dense) {
+          dense.emplace(n);
+        }
+        dense->Start();
+        dense_row(*dense, i);
+      } else {
+        hash.Start(row_flops);
+        hash_row(hash, i);
+      }
+    }
+  };
+  // Calls entry(k, e) for every product a[k] * b[e] of row i
+  const auto for_each_product = [&](std::size_t i, const auto& entry) {
+    for (auto k = static_cast<std::size_t>(a.ptr[i]); k < static_cast<std::size_t>(a.ptr[i + 1]); ++k) {
+      const auto b_row = static_cast<std::size_t>(a.idx[k]);
+      for (auto e = static_cast<std::size_t>(b.ptr[b_row]); e < static_cast<std::size_t>(b.ptr[b_row + 1]); ++e) {
+        entry(k, e);
+      }
+    }
+  };
+  const auto product = [&](std::size_t k, std::size_t e) {
+    return Complex((a.real[k] * b.real[e]) - (a.imag[k] * b.imag[e]),
+                   (a.real[k] * b.imag[e]) + (a.imag[k] * b.real[e]));
+  };
+
+  c_ptr.assign(m + 1, 0);
+  run(row_parts, [&](std::size_t part) {
+    for_each_row(
+        part,
+        [&](SplitDenseAccumulator<Real>& accumulator, std::size_t i) {
+          Index count = 0;
+          for_each_product(i, [&](std::size_t, std::size_t e) { count += accumulator.Mark(b.idx[e]) ? 1 : 0; });
+          c_ptr[i + 1] = count;
+        },
+        [&](HashAccumulator<Complex, Index>& accumulator, std::size_t i) {
+          Index count = 0;
+          for_each_product(i, [&](std::size_t, std::size_t e) { count += accumulator.Add(b.idx[e], {}) ? 1 : 0; });
+          c_ptr[i + 1] = count;
+        });
+  });
+  std::inclusive_scan(c_ptr.begin(), c_ptr.end(), c_ptr.begin());
+
+  c_idx.resize(static_cast<std::size_t>(c_ptr.back()));
+  c_real.resize(c_idx.size());
+  c_imag.resize(c_idx.size());
+  run(row_parts, [&](std::size_t part) {
+    for_each_row(
+        part,
+        [&](SplitDenseAccumulator<Real>& accumulator, std::size_t i) {
+          const auto begin = c_idx.begin() + c_ptr[i];
+          auto next = begin;
+          for_each_product(i, [&](std::size_t, std::size_t e) {
+            if (accumulator.Mark(b.idx[e])) {
+              *next++ = b.idx[e];
+            }
+          });
+          std::sort(begin, next);
+          for (auto k = static_cast<std::size_t>(a.ptr[i]); k < static_cast<std::size_t>(a.ptr[i + 1]); ++k) {
+            const auto b_begin = static_cast<std::size_t>(b.ptr[a.idx[k]]);
+            const auto b_end = static_cast<std::size_t>(b.ptr[a.idx[k] + 1]);
+            axpy(a.real[k], a.imag[k], b.idx.data() + b_begin, b.real.data() + b_begin, b.imag.data() + b_begin,
+                 b_end - b_begin, accumulator.RealSums(), accumulator.ImagSums());
+          }
+          for (auto e = static_cast<std::size_t>(c_ptr[i]); e < static_cast<std::size_t>(c_ptr[i + 1]); ++e) {
+            c_real[e] = accumulator.RealSums()[c_idx[e]];
+            c_imag[e] = accumulator.ImagSums()[c_idx[e]];
+          }
+        },
+        [&](HashAccumulator<Complex, Index>& accumulator, std::size_t i) {
+          const auto begin = c_idx.begin() + c_ptr[i];
+          auto next = begin;
+          for_each_product(i, [&](std::size_t k, std::size_t e) {
+            if (accumulator.Add(b.idx[e], product(k, e))) {
+              *next++ = b.idx[e];
+            }
+          });
+          std::sort(begin, next);
+          for (auto e = static_cast<std::size_t>(c_ptr[i]); e < static_cast<std::size_t>(c_ptr[i + 1]); ++e) {
+            c_real[e] = accumulator.Sum(c_idx[e]).real();
+            c_imag[e] = accumulator.Sum(c_idx[e]).imag();
+          }
+        });
+  });
+}
+
+// A run of (row, col, value) triplets in three parallel arrays.
+template <typename Value, typename Index>
+struct Triplets {
+  const Index* rows;
+  const Index* cols;
+  const Value* values;
+  std::size_t size;
+};
+
+// Compressed rows of the n x width matrix the triplets in `ranges` add up to. A counting sort by row, with a part per
+// range, groups the entries; then repeated columns of every row are summed in the order they come in the ranges.
+template <typename Value, typename Index>
+void AssembleRows(std::size_t n, std::size_t width, const std::vector<Triplets<Value, Index>>& ranges,
+                  std::size_t parts, const ppc::core::PartRunner& run, std::vector<Index>& ptr, std::vector<Index>& idx,
+                  std::vector<Value>& values) {
+  const std::size_t entry_parts = ranges.size();
+  const std::size_t row_parts = UsefulParts(parts, n);
+  std::size_t nnz = 0;
+  for (const auto& range : ranges) {
+    nnz += range.size;
+  }
+
+  std::vector<std::size_t> offsets(entry_parts * n, 0);
+  run(entry_parts, [&](std::size_t part) {
+    std::size_t* count = offsets.data() + (part * n);
+    for (std::size_t e = 0; e < ranges[part].size; ++e) {
+      ++count[ranges[part].rows[e]];
+    }
+  });
+  const std::vector<Index> row_begin = BucketOffsets<Index>(entry_parts, n, offsets, parts, run);
+  std::vector<Index> sorted_idx(nnz);
+  std::vector<Value> sorted_values(nnz);
+  run(entry_parts, [&](std::size_t part) {
+    std::size_t* next = offsets.data() + (part * n);
+    const Triplets<Value, Index>& range = ranges[part];
+    for (std::size_t e = 0; e < range.size; ++e) {
+      const auto i = static_cast<std::size_t>(range.rows[e]);
+      const std::size_t pos = static_cast<std::size_t>(row_begin[i]) + next[i]++;
+      sorted_idx[pos] = range.cols[e];
+      sorted_values[pos] = range.values[e];
+    }
+  });
+
+  // Repeated columns are merged with the accumulators of Gustavson's algorithm, which add them in the order they came
+  // in, and only the distinct columns of a row are sorted; a row that is already strictly ordered is left alone
+  const bool always_dense = DenseAccumulatorFitsL2<Value>(width);
+  ptr.assign(n + 1, 0);
+  run(row_parts, [&](std::size_t part) {
+    std::optional<DenseAccumulator<Value, Index>> dense;
+    HashAccumulator<Value, Index> hash;
+    const auto merge = [&](auto& accumulator, std::size_t begin, std::size_t end) {
+      accumulator.Start(end - begin);
+      std::size_t pos = begin;
+      for (std::size_t e = begin; e < end; ++e) {
+        if (accumulator.Add(sorted_idx[e], sorted_values[e])) {
+          sorted_idx[pos++] = sorted_idx[e];
+        }
+      }
+      std::sort(sorted_idx.begin() + static_cast<std::ptrdiff_t>(begin),
+                sorted_idx.begin() + static_cast<std::ptrdiff_t>(pos));
+      for (std::size_t e = begin; e < pos; ++e) {
+        sorted_values[e] = accumulator.Sum(sorted_idx[e]);
+      }
+      return pos - begin;
+    };
+    for (std::size_t i = EvenSplit(n, row_parts, part); i < EvenSplit(n, row_parts, part + 1); ++i) {
+      const auto begin = static_cast<std::size_t>(row_begin[i]);
+      const auto end = static_cast<std::size_t>(row_begin[i + 1]);
+      std::size_t length = end - begin;
+      if (std::is_sorted(sorted_idx.begin() + begin, sorted_idx.begin() + end, std::less_equal<>())) {
+        ptr[i + 1] = static_cast<Index>(length);
+        continue;
+      }
+      if (always_dense || length * kDenseRatio >= width) {
+        if (!dense) {
+          dense.emplace(width);
+        }
+        length = merge(*dense, begin, end);
+      } else {
+        length = merge(hash, begin, end);
+      }
+      ptr[i + 1] = static_cast<Index>(length);
+    }
+  });
+  std::inclusive_scan(ptr.begin(), ptr.end(), ptr.begin());
+
+  if (static_cast<std::size_t>(ptr.back()) == nnz) {
+    idx = std::move(sorted_idx);
+    values = std::move(sorted_values);
+    return;
+  }
+  idx.resize(static_cast<std::size_t>(ptr.back()));
+  values.resize(idx.size());
+  run(row_parts, [&](std::size_t part) {
+    for (std::size_t i = EvenSplit(n, row_parts, part); i < EvenSplit(n, row_parts, part + 1); ++i) {
+      const auto length = static_cast<std::ptrdiff_t>(ptr[i + 1] - ptr[i]);
+      std::copy_n(sorted_idx.begin() + row_begin[i], length, idx.begin() + ptr[i]);
+      std::copy_n(sorted_values.begin() + row_begin[i], length, values.begin() + ptr[i]);
+    }
+  });
+}
+
+template <typename Value, typename Index>
+using SellKernelFn = void (*)(const ppc::core::SellMatrix<Value, Index>& matrix, const Value* x, Value* y,
+                              std::size_t first, std::size_t last);
+
+// y rows of slices [first, last), with the chunk known at compile time so that the lane loop vectorizes
+template <int kChunk, typename Value, typename Index>
+void MultiplySlices(const ppc::core::SellMatrix<Value, Index>& matrix, const Value* x, Value* y, std::size_t first,
+                    std::size_t last) {
+  const auto rows = static_cast<std::size_t>(matrix.rows);
+  for (std::size_t s = first; s < last; ++s) {
+    const auto begin = static_cast<std::size_t>(matrix.slice_ptr[s]);
+    const std::size_t width = (static_cast<std::size_t>(matrix.slice_ptr[s + 1]) - begin) / kChunk;
+    const Index* idx = matrix.col_idx.data() + begin;
+    const Value* val = matrix.values.data() + begin;
+    std::array<Value, kChunk> sum{};
+    for (std::size_t k = 0; k < width; ++k) {
+      for (std::size_t lane = 0; lane < kChunk; ++lane) {
+        sum[lane] += val[(k * kChunk) + lane] * x[idx[(k * kChunk) + lane]];
+      }
+    }
+    for (std::size_t lane = 0; lane < kChunk && (s * kChunk) + lane < rows; ++lane) {
+      y[matrix.perm[(s * kChunk) + lane]] = sum[lane];
+    }
+  }
+}
+
+template <typename Value, typename Index>
+SellKernelFn<Value, Index> GetSellKernel(Index chunk) {
+  switch (chunk) {
+    case 1:
+      return MultiplySlices<1, Value, Index>;
+    case 2:
+      return MultiplySlices<2, Value, Index>;
+    case 4:
+      return MultiplySlices<4, Value, Index>;
+    case 8:
+      return MultiplySlices<8, Value, Index>;
+    case 16:
+      return MultiplySlices<16, Value, Index>;
+    case 32:
+      return MultiplySlices<32, Value, Index>;
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace
+
+void ppc::core::RunPartsSequentially(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  for (std::size_t p = 0; p < parts; ++p) {
+    part(p);
+  }
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::CsrMatrix<Value, Index>::FromDense(Index rows, Index cols,
+                                                                                 const Value* dense, std::size_t ld,
+                                                                                 double tolerance, std::size_t parts,
+                                                                                 const PartRunner& run) {
+  CsrMatrix matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  CompressRows(static_cast<std::size_t>(rows), static_cast<std::size_t>(cols), dense, ld, tolerance, parts, run,
+               matrix.row_ptr, matrix.col_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+void ppc::core::CsrMatrix<Value, Index>::ToDense(Value* dense, std::size_t ld) const {
+  Expand(static_cast<std::size_t>(rows), row_ptr, col_idx, values, static_cast<std::size_t>(rows),
+         static_cast<std::size_t>(cols), dense, ld, ld, 1);
+}
+
+template <typename Value, typename Index>
+ppc::core::CscMatrix<Value, Index> ppc::core::CsrMatrix<Value, Index>::ToCsc(std::size_t parts,
+                                                                             const PartRunner& run) const {
+  CscMatrix<Value, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  Transpose(static_cast<std::size_t>(rows), static_cast<std::size_t>(cols), row_ptr, col_idx, values, parts, run,
+            matrix.col_ptr, matrix.row_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::CsrMatrix<Value, Index>::Multiply(const CsrMatrix& other,
+                                                                                std::size_t parts,
+                                                                                const PartRunner& run) const {
+  CsrMatrix product;
+  product.rows = rows;
+  product.cols = other.cols;
+  Gustavson(static_cast<std::size_t>(rows), static_cast<std::size_t>(other.cols), row_ptr, col_idx, values,
+            other.row_ptr, other.col_idx, other.values, parts, run, product.row_ptr, product.col_idx, product.values);
+  return product;
+}
+
+template <typename Value, typename Index>
+void ppc::core::CsrMatrix<Value, Index>::MultiplyVector(const Value* x, Value* y, std::size_t parts,
+                                                        const PartRunner& run) const {
+  const std::vector<std::size_t> first = BalancedStarts(row_ptr, UsefulParts(parts, static_cast<std::size_t>(rows)));
+  run(first.size() - 1, [&](std::size_t part) {
+    for (std::size_t i = first[part]; i < first[part + 1]; ++i) {
+      Value sum{};
+      for (auto e = static_cast<std::size_t>(row_ptr[i]); e < static_cast<std::size_t>(row_ptr[i + 1]); ++e) {
+        sum += values[e] * x[col_idx[e]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> ppc::core::CsrMatrix<Value, Index>::ToCoo() const {
+  CooMatrix<Value, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  matrix.row_idx.reserve(values.size());
+  for (Index i = 0; i < rows; ++i) {
+    matrix.row_idx.insert(matrix.row_idx.end(), static_cast<std::size_t>(row_ptr[i + 1] - row_ptr[i]), i);
+  }
+  matrix.col_idx = col_idx;
+  matrix.values = values;
+  return matrix;
+}
+
+template <typename Value, typename Index>
+bool ppc::core::CsrMatrix<Value, Index>::IsValid() const {
+  return IsValidCompressed(rows, cols, row_ptr, col_idx, values);
+}
+
+template <typename Value, typename Index>
+ppc::core::CscMatrix<Value, Index> ppc::core::CscMatrix<Value, Index>::FromDense(Index rows, Index cols,
+                                                                                 const Value* dense, std::size_t ld,
+                                                                                 double tolerance, std::size_t parts,
+                                                                                 const PartRunner& run) {
+  return CsrMatrix<Value, Index>::FromDense(rows, cols, dense, ld, tolerance, parts, run).ToCsc(parts, run);
+}
+
+template <typename Value, typename Index>
+void ppc::core::CscMatrix<Value, Index>::ToDense(Value* dense, std::size_t ld) const {
+  Expand(static_cast<std::size_t>(cols), col_ptr, row_idx, values, static_cast<std::size_t>(rows),
+         static_cast<std::size_t>(cols), dense, ld, 1, ld);
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::CscMatrix<Value, Index>::ToCsr(std::size_t parts,
+                                                                             const PartRunner& run) const {
+  CsrMatrix<Value, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  Transpose(static_cast<std::size_t>(cols), static_cast<std::size_t>(rows), col_ptr, row_idx, values, parts, run,
+            matrix.row_ptr, matrix.col_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+ppc::core::CscMatrix<Value, Index> ppc::core::CscMatrix<Value, Index>::Multiply(const CscMatrix& other,
+                                                                                std::size_t parts,
+                                                                                const PartRunner& run) const {
+  // The arrays of a CSC matrix are those of its transpose in CSR, and C^T = B^T * A^T
+  CscMatrix product;
+  product.rows = rows;
+  product.cols = other.cols;
+  Gustavson(static_cast<std::size_t>(other.cols), static_cast<std::size_t>(rows), other.col_ptr, other.row_idx,
+            other.values, col_ptr, row_idx, values, parts, run, product.col_ptr, product.row_idx, product.values);
+  return product;
+}
+
+template <typename Value, typename Index>
+bool ppc::core::CscMatrix<Value, Index>::IsValid() const {
+  return IsValidCompressed(cols, rows, col_ptr, row_idx, values);
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::CooMatrix<Value, Index>::ToCsr(std::size_t parts,
+                                                                             const PartRunner& run) const {
+  const std::size_t nnz = values.size();
+  const std::size_t entry_parts = UsefulParts(parts, nnz);
+  std::vector<Triplets<Value, Index>> ranges;
+  for (std::size_t p = 0; p < entry_parts; ++p) {
+    const std::size_t first = EvenSplit(nnz, entry_parts, p);
+    ranges.push_back({.rows = row_idx.data() + first,
+                      .cols = col_idx.data() + first,
+                      .values = values.data() + first,
+                      .size = EvenSplit(nnz, entry_parts, p + 1) - first});
+  }
+  CsrMatrix<Value, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  AssembleRows(static_cast<std::size_t>(rows), static_cast<std::size_t>(cols), ranges, parts, run, matrix.row_ptr,
+               matrix.col_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+bool ppc::core::CooMatrix<Value, Index>::IsValid() const {
+  if (rows < 0 || cols < 0 || row_idx.size() != values.size() || col_idx.size() != values.size()) {
+    return false;
+  }
+  const auto in_range = [](Index i, Index n) { return i >= 0 && i < n; };
+  for (std::size_t e = 0; e < values.size(); ++e) {
+    if (!in_range(row_idx[e], rows) || !in_range(col_idx[e], cols)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ppc::core::IsSparseKernelSupported(SparseKernel kernel) {
+  switch (kernel) {
+    case SparseKernel::kScalar:
+      return true;
+    case SparseKernel::kAvx2:
+#ifdef PPC_SPARSE_X86
+      return __builtin_cpu_supports("avx2");
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+ppc::core::SparseKernel ppc::core::BestSparseKernel() {
+  static const SparseKernel kBest =
+      IsSparseKernelSupported(SparseKernel::kAvx2) ? SparseKernel::kAvx2 : SparseKernel::kScalar;
+  return kBest;
+}
+
+template <typename Real, typename Index>
+ppc::core::SplitCsrMatrix<Real, Index> ppc::core::SplitCsrMatrix<Real, Index>::FromInterleaved(
+    const CsrMatrix<std::complex<Real>, Index>& matrix) {
+  SplitCsrMatrix split;
+  split.rows = matrix.rows;
+  split.cols = matrix.cols;
+  split.row_ptr = matrix.row_ptr;
+  split.col_idx = matrix.col_idx;
+  split.real.resize(matrix.values.size());
+  split.imag.resize(matrix.values.size());
+  for (std::size_t e = 0; e < matrix.values.size(); ++e) {
+    split.real[e] = matrix.values[e].real();
+    split.imag[e] = matrix.values[e].imag();
+  }
+  return split;
+}
+
+template <typename Real, typename Index>
+ppc::core::CsrMatrix<std::complex<Real>, Index> ppc::core::SplitCsrMatrix<Real, Index>::ToInterleaved() const {
+  CsrMatrix<std::complex<Real>, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  matrix.row_ptr = row_ptr;
+  matrix.col_idx = col_idx;
+  matrix.values.resize(real.size());
+  for (std::size_t e = 0; e < real.size(); ++e) {
+    matrix.values[e] = {real[e], imag[e]};
+  }
+  return matrix;
+}
+
+template <typename Real, typename Index>
+ppc::core::SplitCsrMatrix<Real, Index> ppc::core::SplitCsrMatrix<Real, Index>::Multiply(const SplitCsrMatrix& other,
+                                                                                        std::size_t parts,
+                                                                                        const PartRunner& run,
+                                                                                        SparseKernel kernel) const {
+  SplitCsrMatrix product;
+  product.rows = rows;
+  product.cols = other.cols;
+  SplitGustavson<Real, Index>(static_cast<std::size_t>(rows), static_cast<std::size_t>(other.cols),
+                              {.ptr = row_ptr, .idx = col_idx, .real = real, .imag = imag},
+                              {.ptr = other.row_ptr, .idx = other.col_idx, .real = other.real, .imag = other.imag},
+                              parts, run, kernel, product.row_ptr, product.col_idx, product.real, product.imag);
+  return product;
+}
+
+template <typename Real, typename Index>
+void ppc::core::SplitCsrMatrix<Real, Index>::MultiplyVector(const Real* x_real, const Real* x_imag, Real* y_real,
+                                                            Real* y_imag, std::size_t parts, const PartRunner& run,
+                                                            SparseKernel kernel) const {
+  const SplitDotFn<Real, Index> dot = GetSplitKernels<Real, Index>(kernel).dot;
+  const std::vector<std::size_t> first = BalancedStarts(row_ptr, UsefulParts(parts, static_cast<std::size_t>(rows)));
+  run(first.size() - 1, [&](std::size_t part) {
+    for (std::size_t i = first[part]; i < first[part + 1]; ++i) {
+      const auto begin = static_cast<std::size_t>(row_ptr[i]);
+      dot(col_idx.data() + begin, real.data() + begin, imag.data() + begin,
+          static_cast<std::size_t>(row_ptr[i + 1]) - begin, x_real, x_imag, y_real[i], y_imag[i]);
+    }
+  });
+}
+
+template <typename Real, typename Index>
+bool ppc::core::SplitCsrMatrix<Real, Index>::IsValid() const {
+  return imag.size() == real.size() && IsValidCompressed(rows, cols, row_ptr, col_idx, real);
+}
+
+template <typename Real, typename Index>
+ppc::core::SplitCscMatrix<Real, Index> ppc::core::SplitCscMatrix<Real, Index>::FromInterleaved(
+    const CscMatrix<std::complex<Real>, Index>& matrix) {
+  // The arrays of a CSC matrix are those of its transpose in CSR
+  CsrMatrix<std::complex<Real>, Index> transpose;
+  transpose.row_ptr = matrix.col_ptr;
+  transpose.col_idx = matrix.row_idx;
+  transpose.values = matrix.values;
+  SplitCsrMatrix<Real, Index> split = SplitCsrMatrix<Real, Index>::FromInterleaved(transpose);
+  SplitCscMatrix result;
+  result.rows = matrix.rows;
+  result.cols = matrix.cols;
+  result.col_ptr = std::move(split.row_ptr);
+  result.row_idx = std::move(split.col_idx);
+  result.real = std::move(split.real);
+  result.imag = std::move(split.imag);
+  return result;
+}
+
+template <typename Real, typename Index>
+ppc::core::CscMatrix<std::complex<Real>, Index> ppc::core::SplitCscMatrix<Real, Index>::ToInterleaved() const {
+  CscMatrix<std::complex<Real>, Index> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  matrix.col_ptr = col_ptr;
+  matrix.row_idx = row_idx;
+  matrix.values.resize(real.size());
+  for (std::size_t e = 0; e < real.size(); ++e) {
+    matrix.values[e] = {real[e], imag[e]};
+  }
+  return matrix;
+}
+
+template <typename Real, typename Index>
+ppc::core::SplitCscMatrix<Real, Index> ppc::core::SplitCscMatrix<Real, Index>::Multiply(const SplitCscMatrix& other,
+                                                                                        std::size_t parts,
+                                                                                        const PartRunner& run,
+                                                                                        SparseKernel kernel) const {
+  // C^T = B^T * A^T, as in CscMatrix::Multiply; complex products commute exactly, so the order of the factors
+  // does not change the result
+  SplitCscMatrix product;
+  product.rows = rows;
+  product.cols = other.cols;
+  SplitGustavson<Real, Index>(static_cast<std::size_t>(other.cols), static_cast<std::size_t>(rows),
+                              {.ptr = other.col_ptr, .idx = other.row_idx, .real = other.real, .imag = other.imag},
+                              {.ptr = col_ptr, .idx = row_idx, .real = real, .imag = imag}, parts, run, kernel,
+                              product.col_ptr, product.row_idx, product.real, product.imag);
+  return product;
+}
+
+template <typename Real, typename Index>
+bool ppc::core::SplitCscMatrix<Real, Index>::IsValid() const {
+  return imag.size() == real.size() && IsValidCompressed(cols, rows, col_ptr, row_idx, real);
+}
+
+template <typename Value, typename Index>
+ppc::core::TripletBuilder<Value, Index>::TripletBuilder(Index rows, Index cols, std::size_t buffers)
+    : rows_(rows), cols_(cols), buffers_(std::max<std::size_t>(1, buffers)) {}
+
+template <typename Value, typename Index>
+void ppc::core::TripletBuilder<Value, Index>::Reserve(std::size_t buffer, std::size_t count) {
+  buffers_[buffer].rows.reserve(count);
+  buffers_[buffer].cols.reserve(count);
+  buffers_[buffer].values.reserve(count);
+}
+
+template <typename Value, typename Index>
+std::size_t ppc::core::TripletBuilder<Value, Index>::Size() const {
+  std::size_t size = 0;
+  for (const Buffer& buffer : buffers_) {
+    size += buffer.values.size();
+  }
+  return size;
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::TripletBuilder<Value, Index>::BuildCsr(std::size_t parts,
+                                                                                     const PartRunner& run) const {
+  std::vector<Triplets<Value, Index>> ranges;
+  for (const Buffer& buffer : buffers_) {
+    ranges.push_back({.rows = buffer.rows.data(),
+                      .cols = buffer.cols.data(),
+                      .values = buffer.values.data(),
+                      .size = buffer.values.size()});
+  }
+  CsrMatrix<Value, Index> matrix;
+  matrix.rows = rows_;
+  matrix.cols = cols_;
+  AssembleRows(static_cast<std::size_t>(rows_), static_cast<std::size_t>(cols_), ranges, parts, run, matrix.row_ptr,
+               matrix.col_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+ppc::core::CscMatrix<Value, Index> ppc::core::TripletBuilder<Value, Index>::BuildCsc(std::size_t parts,
+                                                                                     const PartRunner& run) const {
+  // The columns of A are the rows of A^T
+  std::vector<Triplets<Value, Index>> ranges;
+  for (const Buffer& buffer : buffers_) {
+    ranges.push_back({.rows = buffer.cols.data(),
+                      .cols = buffer.rows.data(),
+                      .values = buffer.values.data(),
+                      .size = buffer.values.size()});
+  }
+  CscMatrix<Value, Index> matrix;
+  matrix.rows = rows_;
+  matrix.cols = cols_;
+  AssembleRows(static_cast<std::size_t>(cols_), static_cast<std::size_t>(rows_), ranges, parts, run, matrix.col_ptr,
+               matrix.row_idx, matrix.values);
+  return matrix;
+}
+
+template <typename Value, typename Index>
+ppc::core::SellMatrix<Value, Index> ppc::core::SellMatrix<Value, Index>::FromCsr(const CsrMatrix<Value, Index>& matrix,
+                                                                                 Index chunk, Index sigma,
+                                                                                 std::size_t parts,
+                                                                                 const PartRunner& run) {
+  if (GetSellKernel<Value, Index>(chunk) == nullptr || sigma < 1) {
+    throw std::invalid_argument("SELL-C-sigma: chunk must be 1, 2, 4, 8, 16 or 32 and sigma positive");
+  }
+  SellMatrix sell;
+  sell.rows = matrix.rows;
+  sell.cols = matrix.cols;
+  sell.chunk = chunk;
+  sell.sigma = sigma;
+  sell.nonzeros = matrix.NonZeros();
+  const auto n = static_cast<std::size_t>(matrix.rows);
+  const auto c = static_cast<std::size_t>(chunk);
+  const auto window = static_cast<std::size_t>(sigma);
+  const std::size_t slices = (n + c - 1) / c;
+  const std::size_t windows = (n + window - 1) / window;
+  const auto length = [&](Index row) { return matrix.row_ptr[row + 1] - matrix.row_ptr[row]; };
+
+  sell.perm.resize(n);
+  std::iota(sell.perm.begin(), sell.perm.end(), Index{0});
+  const std::size_t sort_parts = UsefulParts(parts, windows);
+  run(sort_parts, [&](std::size_t part) {
+    for (std::size_t w = EvenSplit(windows, sort_parts, part); w < EvenSplit(windows, sort_parts, part + 1); ++w) {
+      const auto begin = sell.perm.begin() + static_cast<std::ptrdiff_t>(w * window);
+      const auto end = sell.perm.begin() + static_cast<std::ptrdiff_t>(std::min(n, (w + 1) * window));
+      std::stable_sort(begin, end, [&](Index a, Index b) { return length(a) > length(b); });
+    }
+  });
+
+  // A slice is as wide as its longest row
+  sell.slice_ptr.assign(slices + 1, 0);
+  for (std::size_t s = 0; s < slices; ++s) {
+    Index width = 0;
+    for (std::size_t i = s * c; i < std::min(n, (s + 1) * c); ++i) {
+      width = std::max(width, length(sell.perm[i]));
+    }
+    sell.slice_ptr[s + 1] = sell.slice_ptr[s] + (width * chunk);
+  }
+
+  sell.col_idx.resize(static_cast<std::size_t>(sell.slice_ptr.back()));
+  sell.values.resize(static_cast<std::size_t>(sell.slice_ptr.back()));
+  const std::size_t fill_parts = UsefulParts(parts, slices);
+  run(fill_parts, [&](std::size_t part) {
+    for (std::size_t s = EvenSplit(slices, fill_parts, part); s < EvenSplit(slices, fill_parts, part + 1); ++s) {
+      const auto begin = static_cast<std::size_t>(sell.slice_ptr[s]);
+      const std::size_t width = (static_cast<std::size_t>(sell.slice_ptr[s + 1]) - begin) / c;
+      for (std::size_t lane = 0; lane < c; ++lane) {
+        const std::size_t i = (s * c) + lane;
+        const Index row = i < n ? sell.perm[i] : Index{0};
+        const auto row_begin = i < n ? static_cast<std::size_t>(matrix.row_ptr[row]) : 0;
+        const auto row_length = i < n ? static_cast<std::size_t>(length(row)) : 0;
+        const Index pad = row_length > 0 ? matrix.col_idx[row_begin + row_length - 1] : Index{0};
+        for (std::size_t k = 0; k < width; ++k) {
+          const std::size_t pos = begin + (k * c) + lane;
+          sell.col_idx[pos] = k < row_length ? matrix.col_idx[row_begin + k] : pad;
+          sell.values[pos] = k < row_length ? matrix.values[row_begin + k] : Value{};
+        }
+      }
+    }
+  });
+  return sell;
+}
+
+template <typename Value, typename Index>
+void ppc::core::SellMatrix<Value, Index>::MultiplyVector(const Value* x, Value* y, std::size_t parts,
+                                                         const PartRunner& run) const {
+  const SellKernelFn<Value, Index> kernel = GetSellKernel<Value, Index>(chunk);
+  const std::size_t slices = slice_ptr.size() - 1;
+  const std::vector<std::size_t> first = BalancedStarts(slice_ptr, UsefulParts(parts, slices));
+  run(first.size() - 1, [&](std::size_t part) { kernel(*this, x, y, first[part], first[part + 1]); });
+}
+
+template struct ppc::core::CsrMatrix<double>;
+template struct ppc::core::CsrMatrix<float>;
+template struct ppc::core::CsrMatrix<std::complex<double>>;
+template struct ppc::core::CsrMatrix<double, std::int64_t>;
+template struct ppc::core::CscMatrix<double>;
+template struct ppc::core::CscMatrix<float>;
+template struct ppc::core::CscMatrix<std::complex<double>>;
+template struct ppc::core::CscMatrix<double, std::int64_t>;
+template struct ppc::core::CooMatrix<double>;
+template struct ppc::core::CooMatrix<float>;
+template struct ppc::core::CooMatrix<std::complex<double>>;
+template struct ppc::core::CooMatrix<double, std::int64_t>;
+template class ppc::core::TripletBuilder<double>;
+template class ppc::core::TripletBuilder<float>;
+template class ppc::core::TripletBuilder<std::complex<double>>;
+template class ppc::core::TripletBuilder<double, std::int64_t>;
+template struct ppc::core::SplitCsrMatrix<double>;
+template struct ppc::core::SplitCsrMatrix<float>;
+template struct ppc::core::SplitCsrMatrix<double, std::int64_t>;
+template struct ppc::core::SplitCscMatrix<double>;
+template struct ppc::core::SplitCscMatrix<float>;
+template struct ppc::core::SplitCscMatrix<double, std::int64_t>;
+template struct ppc::core::SellMatrix<double>;
+template struct ppc::core::SellMatrix<float>;
+template struct ppc::core::SellMatrix<std::complex<double>>;
+template struct ppc::core::SellMatrix<double, std::int64_t>;
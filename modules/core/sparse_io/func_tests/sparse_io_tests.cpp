@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+
+namespace {
+
+template <typename Value, typename Index = int>
+ppc::core::CsrMatrix<Value, Index> RandomCsr(Index rows, Index cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::bernoulli_distribution nonzero(density);
+  std::vector<Value> dense(static_cast<std::size_t>(rows) * static_cast<std::size_t>(cols));
+  for (auto& value : dense) {
+    if (nonzero(gen)) {
+      if constexpr (std::is_same_v<Value, std::complex<double>>) {
+        value = {dist(gen), dist(gen)};
+      } else {
+        value = static_cast<Value>(dist(gen));
+      }
+    }
+  }
+  return ppc::core::CsrMatrix<Value, Index>::FromDense(rows, cols, dense.data(), static_cast<std::size_t>(cols));
+}
+
+template <typename Value, typename Index>
+void ExpectSame(const ppc::core::CsrMatrix<Value, Index>& a, const ppc::core::CsrMatrix<Value, Index>& b) {
+  EXPECT_EQ(a.rows, b.rows);
+  EXPECT_EQ(a.cols, b.cols);
+  EXPECT_EQ(a.row_ptr, b.row_ptr);
+  EXPECT_EQ(a.col_idx, b.col_idx);
+  EXPECT_EQ(a.values, b.values);
+}
+
+template <typename Value, typename Index = int>
+void CheckRoundTrip(ppc::core::SparseIndexCoding coding) {
+  const auto matrix = RandomCsr<Value, Index>(37, 300, 0.05, 7);
+  const std::vector<std::byte> bytes = ppc::core::EncodeSparse(matrix, coding);
+  const ppc::core::SparseFileView<Value, Index> view(bytes.data(), bytes.size());
+  EXPECT_EQ(view.Layout(), ppc::core::SparseLayout::kCsr);
+  EXPECT_EQ(view.NonZeros(), matrix.NonZeros());
+  const std::byte* values_begin = bytes.data() + (bytes.size() - (view.NonZeros() * sizeof(Value)));
+  EXPECT_EQ(reinterpret_cast<const std::byte*>(view.Values().data()), values_begin);
+  ExpectSame(view.ToCsr(), matrix);
+}
+
+}  // namespace
+
+TEST(sparse_io_tests, csr_round_trips_in_place) {
+  CheckRoundTrip<double>(ppc::core::SparseIndexCoding::kPlain);
+  CheckRoundTrip<float>(ppc::core::SparseIndexCoding::kPlain);
+  CheckRoundTrip<std::complex<double>>(ppc::core::SparseIndexCoding::kPlain);
+  CheckRoundTrip<double, std::int64_t>(ppc::core::SparseIndexCoding::kPlain);
+}
+
+TEST(sparse_io_tests, compressed_indices_round_trip) {
+  CheckRoundTrip<double>(ppc::core::SparseIndexCoding::kDeltaVarint);
+  CheckRoundTrip<std::complex<double>>(ppc::core::SparseIndexCoding::kDeltaVarint);
+  CheckRoundTrip<double, std::int64_t>(ppc::core::SparseIndexCoding::kDeltaVarint);
+}
+
+TEST(sparse_io_tests, compressed_indices_are_smaller) {
+  const auto matrix = RandomCsr<double, std::int64_t>(200, 400, 0.05, 3);
+  const auto plain = ppc::core::EncodeSparse(matrix);
+  const auto compressed = ppc::core::EncodeSparse(matrix, ppc::core::SparseIndexCoding::kDeltaVarint);
+  const auto plain_header = ppc::core::ReadSparseHeader(plain.data(), plain.size());
+  const auto compressed_header = ppc::core::ReadSparseHeader(compressed.data(), compressed.size());
+  ASSERT_TRUE(plain_header.has_value());
+  ASSERT_TRUE(compressed_header.has_value());
+  EXPECT_EQ(plain_header->index_section_bytes, matrix.NonZeros() * sizeof(std::int64_t));
+  EXPECT_LE(compressed_header->index_section_bytes * 4, plain_header->index_section_bytes);
+}
+
+TEST(sparse_io_tests, csc_round_trips) {
+  const auto csc = RandomCsr<double>(50, 20, 0.2, 11).ToCsc();
+  const auto bytes = ppc::core::EncodeSparse(csc, ppc::core::SparseIndexCoding::kDeltaVarint);
+  const ppc::core::SparseFileView<double> view(bytes.data(), bytes.size());
+  EXPECT_EQ(view.Layout(), ppc::core::SparseLayout::kCsc);
+  EXPECT_THROW((void)view.ToCsr(), std::runtime_error);
+  const auto copy = view.ToCsc();
+  EXPECT_EQ(copy.col_ptr, csc.col_ptr);
+  EXPECT_EQ(copy.row_idx, csc.row_idx);
+  EXPECT_EQ(copy.values, csc.values);
+}
+
+TEST(sparse_io_tests, empty_matrices_round_trip) {
+  const ppc::core::CsrMatrix<double> empty;
+  auto bytes = ppc::core::EncodeSparse(empty);
+  ExpectSame(ppc::core::SparseFileView<double>(bytes.data(), bytes.size()).ToCsr(), empty);
+
+  const auto zero = RandomCsr<double>(5, 8, 0.0, 1);
+  bytes = ppc::core::EncodeSparse(zero, ppc::core::SparseIndexCoding::kDeltaVarint);
+  ExpectSame(ppc::core::SparseFileView<double>(bytes.data(), bytes.size()).ToCsr(), zero);
+}
+
+TEST(sparse_io_tests, broken_encodings_are_rejected) {
+  const auto matrix = RandomCsr<double>(10, 10, 0.3, 5);
+  auto bytes = ppc::core::EncodeSparse(matrix);
+  EXPECT_FALSE(ppc::core::ReadSparseHeader(bytes.data(), bytes.size() - 1).has_value());
+  EXPECT_THROW((ppc::core::SparseFileView<double>(bytes.data(), bytes.size() - 1)), std::runtime_error);
+  EXPECT_THROW((ppc::core::SparseFileView<float>(bytes.data(), bytes.size())), std::runtime_error);
+  EXPECT_THROW((ppc::core::SparseFileView<double, std::int64_t>(bytes.data(), bytes.size())), std::runtime_error);
+
+  auto corrupt = bytes;
+  corrupt[0] = std::byte{'X'};
+  EXPECT_FALSE(ppc::core::ReadSparseHeader(corrupt.data(), corrupt.size()).has_value());
+
+  ppc::core::CsrMatrix<double> inconsistent = matrix;
+  inconsistent.values.pop_back();
+  EXPECT_THROW((void)ppc::core::EncodeSparse(inconsistent), std::invalid_argument);
+}
+
+TEST(sparse_io_tests, corrupt_arrays_are_rejected) {
+  const auto matrix = RandomCsr<double>(10, 10, 0.3, 5);
+  for (const auto coding : {ppc::core::SparseIndexCoding::kPlain, ppc::core::SparseIndexCoding::kDeltaVarint}) {
+    const auto bytes = ppc::core::EncodeSparse(matrix, coding);
+    ppc::core::SparseFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    // A decreasing pointer would make a row reach past the stored entries
+    auto decreasing = bytes;
+    const int past = static_cast<int>(matrix.NonZeros()) + 1000;
+    std::memcpy(decreasing.data() + sizeof(header) + sizeof(int), &past, sizeof(past));
+    EXPECT_THROW((ppc::core::SparseFileView<double>(decreasing.data(), decreasing.size())), std::runtime_error);
+
+    // The same indices are out of range once the matrix claims fewer columns
+    auto narrow = bytes;
+    header.cols = 3;
+    std::memcpy(narrow.data(), &header, sizeof(header));
+    ASSERT_TRUE(ppc::core::ReadSparseHeader(narrow.data(), narrow.size()).has_value());
+    EXPECT_THROW((ppc::core::SparseFileView<double>(narrow.data(), narrow.size())), std::runtime_error);
+  }
+
+  const std::string path = (std::filesystem::temp_directory_path() / "sparse_io_tests_corrupt.pspm").string();
+  auto bytes = ppc::core::EncodeSparse(matrix);
+  // The index section follows the header and the 11 row pointers, padded to 64 bytes
+  const std::size_t indices = 128;
+  const int negative = -1;
+  std::memcpy(bytes.data() + indices, &negative, sizeof(negative));
+  ppc::core::WriteBinaryFile(path, bytes);
+  {
+    const ppc::core::MappedFile file(path);
+    EXPECT_THROW((ppc::core::SparseFileView<double>(file.Data(), file.Size())), std::runtime_error);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(sparse_io_tests, mapped_file_is_viewed_in_place) {
+  const auto matrix = RandomCsr<std::complex<double>>(64, 48, 0.1, 9);
+  const std::string path = (std::filesystem::temp_directory_path() / "sparse_io_tests.pspm").string();
+  ppc::core::WriteBinaryFile(path, ppc::core::EncodeSparse(matrix));
+  {
+    const ppc::core::MappedFile file(path);
+    const ppc::core::SparseFileView<std::complex<double>> view(file.Data(), file.Size());
+    EXPECT_EQ(reinterpret_cast<const std::byte*>(view.Pointers().data()), file.Data() + 64);
+    ExpectSame(view.ToCsr(), matrix);
+  }
+  std::filesystem::remove(path);
+  EXPECT_THROW(ppc::core::MappedFile{path}, std::runtime_error);
+}
+
+namespace {
+
+void RunOnThreads(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < parts; ++p) {
+    threads.emplace_back(part, p);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename Value, typename Index>
+std::vector<Value> ToDense(const ppc::core::CooMatrix<Value, Index>& coo) {
+  std::vector<Value> dense(static_cast<std::size_t>(coo.rows) * static_cast<std::size_t>(coo.cols));
+  coo.ToCsr().ToDense(dense.data(), static_cast<std::size_t>(coo.cols));
+  return dense;
+}
+
+}  // namespace
+
+TEST(sparse_io_tests, matrix_market_coordinate_general) {
+  const std::string text =
+      "%%MatrixMarket matrix coordinate real general\n"
+      "% a comment\n"
+      "\n"
+      "3 4 4\n"
+      "1 1 1.5\n"
+      "3 4 -2e1\n"
+      "% a comment between entries\n"
+      "2 2 3\r\n"
+      "1 1 0.5\n";
+  const auto info = ppc::core::ReadMatrixMarketInfo(text);
+  EXPECT_EQ(info.format, ppc::core::MatrixMarketFormat::kCoordinate);
+  EXPECT_EQ(info.entries, 4U);
+  const auto coo = ppc::core::ParseMatrixMarket<double>(text);
+  EXPECT_EQ(coo.rows, 3);
+  EXPECT_EQ(coo.cols, 4);
+  EXPECT_EQ(coo.NonZeros(), 4U);
+  EXPECT_EQ(ToDense(coo), (std::vector<double>{2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, -20}));
+}
+
+TEST(sparse_io_tests, matrix_market_symmetric_kinds_are_expanded) {
+  const std::string symmetric =
+      "%%MatrixMarket matrix coordinate integer symmetric\n3 3 3\n1 1 4\n3 1 2\n3 2 5\n";
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<double>(symmetric)),
+            (std::vector<double>{4, 0, 2, 0, 0, 5, 2, 5, 0}));
+
+  const std::string skew = "%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n2 1 3\n";
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<double>(skew)), (std::vector<double>{0, -3, 3, 0}));
+
+  const std::string hermitian = "%%MatrixMarket matrix coordinate complex hermitian\n2 2 2\n1 1 1 0\n2 1 1 2\n";
+  using Complex = std::complex<double>;
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<Complex>(hermitian)),
+            (std::vector<Complex>{{1, 0}, {1, -2}, {1, 2}, {0, 0}}));
+
+  const std::string pattern = "%%MatrixMarket matrix coordinate pattern symmetric\n2 2 2\n1 1\n2 1\n";
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<float>(pattern)), (std::vector<float>{1, 1, 1, 0}));
+}
+
+TEST(sparse_io_tests, matrix_market_array_files) {
+  const std::string general = "%%MatrixMarket matrix array real general\n2 3\n1\n0\n0\n4\n5\n6\n";
+  const auto coo = ppc::core::ParseMatrixMarket<double>(general);
+  EXPECT_EQ(coo.NonZeros(), 4U);
+  EXPECT_EQ(ToDense(coo), (std::vector<double>{1, 0, 5, 0, 4, 6}));
+
+  const std::string symmetric = "%%MatrixMarket matrix array real symmetric\n3 3\n1\n2\n3\n4\n5\n6\n";
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<double>(symmetric, 3, RunOnThreads)),
+            (std::vector<double>{1, 2, 3, 2, 4, 5, 3, 5, 6}));
+
+  const std::string skew = "%%MatrixMarket matrix array real skew-symmetric\n3 3\n1\n2\n3\n";
+  EXPECT_EQ(ToDense(ppc::core::ParseMatrixMarket<double>(skew, 2, RunOnThreads)),
+            (std::vector<double>{0, -1, -2, 1, 0, -3, 2, 3, 0}));
+}
+
+TEST(sparse_io_tests, matrix_market_parts_match_one_part) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> row(1, 500);
+  std::uniform_int_distribution<int> col(1, 300);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::string text = "%%MatrixMarket matrix coordinate real general\n500 300 20000\n";
+  for (int e = 0; e < 20000; ++e) {
+    text += std::to_string(row(gen)) + " " + std::to_string(col(gen)) + " " + std::to_string(value(gen)) + "\n";
+  }
+  const auto expected = ppc::core::ParseMatrixMarket<double, std::int64_t>(text);
+  for (std::size_t parts : {2U, 7U, 64U}) {
+    const auto coo = ppc::core::ParseMatrixMarket<double, std::int64_t>(text, parts, RunOnThreads);
+    EXPECT_EQ(coo.row_idx, expected.row_idx);
+    EXPECT_EQ(coo.col_idx, expected.col_idx);
+    EXPECT_EQ(coo.values, expected.values);
+  }
+}
+
+TEST(sparse_io_tests, matrix_market_errors) {
+  const auto parse = [](const std::string& text) {
+    return ppc::core::ParseMatrixMarket<double>(text, 2, RunOnThreads);
+  };
+  EXPECT_THROW(parse("3 3 0\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix coordinate real general\n2 2 1\n1 x 1\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix coordinate complex general\n2 2 1\n1 1 1 1\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix coordinate real symmetric\n2 3 0\n"), std::runtime_error);
+  EXPECT_THROW(parse("%%MatrixMarket matrix array real general\n1 2\n1\n2\n3\n"), std::runtime_error);
+  EXPECT_THROW(ppc::core::ReadMatrixMarket<double>("/nonexistent/matrix.mtx"), std::runtime_error);
+}
+
+TEST(sparse_io_tests, matrix_market_file_is_read_mapped) {
+  const std::string path = (std::filesystem::temp_directory_path() / "sparse_io_tests.mtx").string();
+  const std::string text = "%%MatrixMarket matrix coordinate complex general\n2 2 2\n1 2 1 -1\n2 1 0 3\n";
+  ppc::core::WriteBinaryFile(path, std::as_bytes(std::span(text)));
+  const auto coo = ppc::core::ReadMatrixMarket<std::complex<double>>(path, 2, RunOnThreads);
+  std::filesystem::remove(path);
+  EXPECT_EQ(ToDense(coo), (std::vector<std::complex<double>>{{0, 0}, {1, -1}, {0, 3}, {0, 0}}));
+}
+
+TEST(sparse_io_tests, edge_lists) {
+  const std::string text = "# directed graph\n0 1\n1 2 2.5\n% another comment\n3 3\n";
+  const auto directed = ppc::core::ParseEdgeList<double>(text, false, 3, RunOnThreads);
+  EXPECT_EQ(directed.rows, 4);
+  EXPECT_EQ(ToDense(directed), (std::vector<double>{0, 1, 0, 0, 0, 0, 2.5, 0, 0, 0, 0, 0, 0, 0, 0, 1}));
+
+  const auto undirected = ppc::core::ParseEdgeList<double>(text, true);
+  EXPECT_EQ(undirected.NonZeros(), 5U);
+  EXPECT_EQ(ToDense(undirected), (std::vector<double>{0, 1, 0, 0, 1, 0, 2.5, 0, 0, 2.5, 0, 0, 0, 0, 0, 1}));
+
+  EXPECT_EQ(ppc::core::ParseEdgeList<double>("# empty\n").rows, 0);
+  EXPECT_THROW(ppc::core::ParseEdgeList<double>("0 -1\n"), std::runtime_error);
+}
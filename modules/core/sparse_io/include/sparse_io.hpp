@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core {
+
+// Binary interchange format for CsrMatrix and CscMatrix. A 64-byte little-endian SparseFileHeader is followed by
+// three sections, each starting at a multiple of 64 bytes from the header:
+//   pointers  outer + 1 indices (row_ptr of a CSR matrix, col_ptr of a CSC one), always stored plainly;
+//   indices   the nnz inner indices (col_idx or row_idx), plain or compressed;
+//   values    the nnz values.
+// Indices are stored with the width of the Index type and values as they lie in memory, so a file mapped into memory
+// or received in a buffer is read in place: SparseFileView hands out spans into it without copying or converting.
+enum class SparseLayout : uint8_t { kCsr, kCsc };
+
+enum class SparseValueType : uint8_t { kFloat32 = 1, kFloat64, kComplex64, kComplex128 };
+
+// kDeltaVarint stores each inner index as its distance to the previous one of its row (column), minus one and
+// zigzag-encoded, in LEB128 bytes. Sorted indices of a row a few hundred columns apart take one or two bytes instead
+// of four or eight, at the price of a decoding pass when the file is opened.
+enum class SparseIndexCoding : uint8_t { kPlain, kDeltaVarint };
+
+struct SparseFileHeader {
+  std::array<char, 4> magic;  // "PSPM"
+  uint16_t version;
+  SparseLayout layout;
+  SparseValueType value_type;
+  uint8_t index_bytes;
+  SparseIndexCoding index_coding;
+  uint16_t reserved;
+  uint32_t reserved2;
+  uint64_t rows;
+  uint64_t cols;
+  uint64_t nnz;
+  // Length of the index section, which is nnz * index_bytes unless the indices are compressed.
+  uint64_t index_section_bytes;
+  // Length of the whole encoding, header included, so that encodings can be stored one after another.
+  uint64_t total_bytes;
+  uint64_t reserved3;
+};
+
+static_assert(sizeof(SparseFileHeader) == 64);
+
+// The header at `data` if it is one of a supported version whose encoding fits in `size` bytes.
+std::optional<SparseFileHeader> ReadSparseHeader(const std::byte* data, std::size_t size);
+
+template <typename Value, typename Index = int>
+std::vector<std::byte> EncodeSparse(const CsrMatrix<Value, Index>& matrix,
+                                    SparseIndexCoding coding = SparseIndexCoding::kPlain);
+
+template <typename Value, typename Index = int>
+std::vector<std::byte> EncodeSparse(const CscMatrix<Value, Index>& matrix,
+                                    SparseIndexCoding coding = SparseIndexCoding::kPlain);
+
+// Read-only view of an encoded matrix. Pointers() and Values() always point into the encoding, and so does
+// Indices() unless they were compressed, in which case they are decoded once when the view is made. The encoding
+// must outlive the view and start at an address aligned for Value and Index.
+template <typename Value, typename Index = int>
+class SparseFileView {
+ public:
+  SparseFileView() = default;
+
+  // Throws std::runtime_error if the data is not an encoding of Value and Index, is truncated, or holds pointers
+  // that decrease or indices outside the inner dimension.
+  SparseFileView(const std::byte* data, std::size_t size);
+
+  [[nodiscard]] SparseLayout Layout() const { return layout_; }
+  [[nodiscard]] Index Rows() const { return rows_; }
+  [[nodiscard]] Index Cols() const { return cols_; }
+  [[nodiscard]] std::size_t NonZeros() const { return values_.size(); }
+
+  [[nodiscard]] std::span<const Index> Pointers() const { return pointers_; }
+  [[nodiscard]] std::span<const Index> Indices() const {
+    return decoded_.empty() ? indices_ : std::span<const Index>(decoded_);
+  }
+  [[nodiscard]] std::span<const Value> Values() const { return values_; }
+
+  // Copies of the matrix in the stored layout; throw std::runtime_error if it is the other one.
+  [[nodiscard]] CsrMatrix<Value, Index> ToCsr() const;
+  [[nodiscard]] CscMatrix<Value, Index> ToCsc() const;
+
+ private:
+  SparseLayout layout_ = SparseLayout::kCsr;
+  Index rows_ = 0;
+  Index cols_ = 0;
+  std::span<const Index> pointers_;
+  std::span<const Index> indices_;
+  std::span<const Value> values_;
+  std::vector<Index> decoded_;
+};
+
+// A whole file mapped read-only into memory where the platform allows it, and read into a buffer elsewhere. Pages
+// are only loaded as they are touched, so opening a large matrix costs nothing until its arrays are read.
+class MappedFile {
+ public:
+  // Throws std::runtime_error if the file cannot be opened.
+  explicit MappedFile(const std::string& path);
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  ~MappedFile();
+
+  [[nodiscard]] const std::byte* Data() const { return data_; }
+  [[nodiscard]] std::size_t Size() const { return size_; }
+
+ private:
+  void Release();
+
+  const std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<std::byte> buffer_;
+};
+
+// Writes `bytes` to `path`, replacing the file; throws std::runtime_error on failure.
+void WriteBinaryFile(const std::string& path, std::span<const std::byte> bytes);
+
+// Matrix Market exchange files (.mtx), as distributed by the SuiteSparse collection. Coordinate files list one entry
+// per line with 1-based indices; array files list every value of a dense matrix column by column.
+enum class MatrixMarketFormat : uint8_t { kCoordinate, kArray };
+
+enum class MatrixMarketField : uint8_t { kReal, kInteger, kComplex, kPattern };
+
+// Files of a symmetric kind only list the lower triangle; the readers add the mirrored entries.
+enum class MatrixMarketSymmetry : uint8_t { kGeneral, kSymmetric, kSkewSymmetric, kHermitian };
+
+struct MatrixMarketInfo {
+  MatrixMarketFormat format = MatrixMarketFormat::kCoordinate;
+  MatrixMarketField field = MatrixMarketField::kReal;
+  MatrixMarketSymmetry symmetry = MatrixMarketSymmetry::kGeneral;
+  std::uint64_t rows = 0;
+  std::uint64_t cols = 0;
+  // Entries listed in the file, before symmetric expansion.
+  std::uint64_t entries = 0;
+  // Offset of the first line after the size line.
+  std::size_t data_offset = 0;
+};
+
+// Parses the banner and the size line; throws std::runtime_error if they are malformed or unsupported.
+MatrixMarketInfo ReadMatrixMarketInfo(std::string_view text);
+
+// The matrix in `text`, entries in file order with mirrored ones right after theirs. The lines are cut into `parts`
+// chunks of about equal length, each parsed by a part of its own, so a mapped file of several gigabytes is read by
+// all threads at once; array files take an extra pass counting the lines of every chunk to place its values. Zeros
+// of array files are dropped. Throws std::runtime_error on malformed lines, out-of-range indices, a wrong number of
+// entries, or complex entries for a real Value.
+template <typename Value, typename Index = int>
+CooMatrix<Value, Index> ParseMatrixMarket(std::string_view text, std::size_t parts = 1,
+                                          const PartRunner& run = RunPartsSequentially);
+
+// ParseMatrixMarket over the file mapped into memory.
+template <typename Value, typename Index = int>
+CooMatrix<Value, Index> ReadMatrixMarket(const std::string& path, std::size_t parts = 1,
+                                         const PartRunner& run = RunPartsSequentially);
+
+// Edge lists as distributed by SNAP and most graph collections: a "source target [weight]" line per edge with
+// 0-based vertices, and comment lines starting with # or %. The matrix is square with a row per vertex up to the
+// largest one listed; an edge without a weight is 1. If `undirected`, every edge also goes the other way. Parsed in
+// chunks like ParseMatrixMarket.
+template <typename Value, typename Index = int>
+CooMatrix<Value, Index> ParseEdgeList(std::string_view text, bool undirected = false, std::size_t parts = 1,
+                                      const PartRunner& run = RunPartsSequentially);
+
+template <typename Value, typename Index = int>
+CooMatrix<Value, Index> ReadEdgeList(const std::string& path, bool undirected = false, std::size_t parts = 1,
+                                     const PartRunner& run = RunPartsSequentially);
+
+}  // namespace ppc::core
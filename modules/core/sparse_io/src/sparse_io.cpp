@@ -0,0 +1,816 @@
+#include "core/sparse_io/include/sparse_io.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::array<char, 4> kMagic = {'P', 'S', 'P', 'M'};
+constexpr uint16_t kVersion = 1;
+constexpr std::size_t kSectionAlignment = 64;
+
+std::size_t AlignSection(std::size_t offset) {
+  return (offset + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+}
+
+template <typename Value>
+constexpr ppc::core::SparseValueType ValueTypeOf() {
+  if constexpr (std::is_same_v<Value, float>) {
+    return ppc::core::SparseValueType::kFloat32;
+  } else if constexpr (std::is_same_v<Value, double>) {
+    return ppc::core::SparseValueType::kFloat64;
+  } else if constexpr (std::is_same_v<Value, std::complex<float>>) {
+    return ppc::core::SparseValueType::kComplex64;
+  } else {
+    static_assert(std::is_same_v<Value, std::complex<double>>, "unsupported value type");
+    return ppc::core::SparseValueType::kComplex128;
+  }
+}
+
+// Bytes per value of a stored type, or 0 for an unknown tag
+std::size_t ValueBytes(ppc::core::SparseValueType type) {
+  switch (type) {
+    case ppc::core::SparseValueType::kFloat32:
+      return 4;
+    case ppc::core::SparseValueType::kFloat64:
+    case ppc::core::SparseValueType::kComplex64:
+      return 8;
+    case ppc::core::SparseValueType::kComplex128:
+      return 16;
+  }
+  return 0;
+}
+
+struct Sections {
+  std::size_t pointers;
+  std::size_t indices;
+  std::size_t values;
+  std::size_t end;
+};
+
+std::uint64_t OuterSize(const ppc::core::SparseFileHeader& header) {
+  return header.layout == ppc::core::SparseLayout::kCsr ? header.rows : header.cols;
+}
+
+Sections Locate(const ppc::core::SparseFileHeader& header) {
+  Sections sections{};
+  sections.pointers = sizeof(ppc::core::SparseFileHeader);
+  sections.indices = AlignSection(sections.pointers + ((OuterSize(header) + 1) * header.index_bytes));
+  sections.values = AlignSection(sections.indices + header.index_section_bytes);
+  sections.end = sections.values + (header.nnz * ValueBytes(header.value_type));
+  return sections;
+}
+
+void AppendVarint(std::uint64_t value, std::vector<std::byte>& out) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<std::byte>(value));
+}
+
+// Appends the inner indices of every outer position as zigzagged gaps to the previous one
+template <typename Index>
+std::vector<std::byte> CompressIndices(const std::vector<Index>& ptr, const std::vector<Index>& idx) {
+  std::vector<std::byte> out;
+  out.reserve(idx.size() * 2);
+  for (std::size_t o = 0; o + 1 < ptr.size(); ++o) {
+    std::int64_t prev = -1;
+    for (auto e = ptr[o]; e < ptr[o + 1]; ++e) {
+      const std::int64_t gap = static_cast<std::int64_t>(idx[e]) - prev - 1;
+      AppendVarint((static_cast<std::uint64_t>(gap) << 1) ^ static_cast<std::uint64_t>(gap >> 63), out);
+      prev = idx[e];
+    }
+  }
+  return out;
+}
+
+// Expects pointers already checked to be nondecreasing and bounded by nnz; every decoded index must lie in
+// [0, inner)
+template <typename Index>
+std::vector<Index> DecompressIndices(std::span<const Index> ptr, std::span<const std::byte> bytes, std::size_t nnz,
+                                     Index inner) {
+  std::vector<Index> idx(nnz);
+  std::size_t pos = 0;
+  for (std::size_t o = 0; o + 1 < ptr.size(); ++o) {
+    std::int64_t prev = -1;
+    for (auto e = ptr[o]; e < ptr[o + 1]; ++e) {
+      std::uint64_t zigzag = 0;
+      for (int shift = 0;; shift += 7) {
+        if (pos == bytes.size() || shift > 63) {
+          throw std::runtime_error("sparse file: truncated or malformed index section");
+        }
+        const auto byte = std::to_integer<std::uint64_t>(bytes[pos++]);
+        zigzag |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+          break;
+        }
+      }
+      const auto gap = static_cast<std::int64_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+      prev += gap + 1;
+      if (prev < 0 || prev >= static_cast<std::int64_t>(inner)) {
+        throw std::runtime_error("sparse file: index out of range");
+      }
+      idx[e] = static_cast<Index>(prev);
+    }
+  }
+  return idx;
+}
+
+template <typename Value, typename Index>
+std::vector<std::byte> Encode(ppc::core::SparseLayout layout, Index rows, Index cols, const std::vector<Index>& ptr,
+                              const std::vector<Index>& idx, const std::vector<Value>& values,
+                              ppc::core::SparseIndexCoding coding) {
+  if constexpr (std::endian::native != std::endian::little) {
+    throw std::runtime_error("sparse file: only little-endian hosts are supported");
+  }
+  const auto outer = static_cast<std::size_t>(layout == ppc::core::SparseLayout::kCsr ? rows : cols);
+  if (ptr.size() != outer + 1 || ptr.front() != 0 || static_cast<std::size_t>(ptr.back()) != idx.size() ||
+      idx.size() != values.size()) {
+    throw std::invalid_argument("sparse file: inconsistent array sizes");
+  }
+
+  std::vector<std::byte> compressed;
+  if (coding == ppc::core::SparseIndexCoding::kDeltaVarint) {
+    compressed = CompressIndices(ptr, idx);
+  }
+  ppc::core::SparseFileHeader header{};
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.layout = layout;
+  header.value_type = ValueTypeOf<Value>();
+  header.index_bytes = sizeof(Index);
+  header.index_coding = coding;
+  header.rows = static_cast<std::uint64_t>(rows);
+  header.cols = static_cast<std::uint64_t>(cols);
+  header.nnz = values.size();
+  header.index_section_bytes =
+      coding == ppc::core::SparseIndexCoding::kPlain ? idx.size() * sizeof(Index) : compressed.size();
+  const Sections sections = Locate(header);
+  header.total_bytes = sections.end;
+
+  // Zero-initialized, so the padding between sections is deterministic
+  std::vector<std::byte> bytes(sections.end);
+  std::memcpy(bytes.data(), &header, sizeof(header));
+  std::memcpy(bytes.data() + sections.pointers, ptr.data(), ptr.size() * sizeof(Index));
+  if (coding == ppc::core::SparseIndexCoding::kPlain) {
+    std::memcpy(bytes.data() + sections.indices, idx.data(), idx.size() * sizeof(Index));
+  } else {
+    std::ranges::copy(compressed, bytes.begin() + static_cast<std::ptrdiff_t>(sections.indices));
+  }
+  std::memcpy(bytes.data() + sections.values, values.data(), values.size() * sizeof(Value));
+  return bytes;
+}
+
+}  // namespace
+
+std::optional<ppc::core::SparseFileHeader> ppc::core::ReadSparseHeader(const std::byte* data, std::size_t size) {
+  if (std::endian::native != std::endian::little || data == nullptr || size < sizeof(SparseFileHeader)) {
+    return std::nullopt;
+  }
+  SparseFileHeader header{};
+  std::memcpy(&header, data, sizeof(header));
+  const bool known = header.magic == kMagic && header.version == kVersion &&
+                     (header.layout == SparseLayout::kCsr || header.layout == SparseLayout::kCsc) &&
+                     ValueBytes(header.value_type) != 0 && (header.index_bytes == 4 || header.index_bytes == 8) &&
+                     (header.index_coding == SparseIndexCoding::kPlain ||
+                      header.index_coding == SparseIndexCoding::kDeltaVarint);
+  // Every count is bounded by the size before the section offsets are computed from them, so nothing overflows
+  if (!known || OuterSize(header) >= size || header.nnz >= size || header.index_section_bytes > size) {
+    return std::nullopt;
+  }
+  if (header.index_coding == SparseIndexCoding::kPlain &&
+      header.index_section_bytes != header.nnz * header.index_bytes) {
+    return std::nullopt;
+  }
+  if (header.total_bytes != Locate(header).end || header.total_bytes > size) {
+    return std::nullopt;
+  }
+  return header;
+}
+
+template <typename Value, typename Index>
+std::vector<std::byte> ppc::core::EncodeSparse(const CsrMatrix<Value, Index>& matrix, SparseIndexCoding coding) {
+  return Encode(SparseLayout::kCsr, matrix.rows, matrix.cols, matrix.row_ptr, matrix.col_idx, matrix.values, coding);
+}
+
+template <typename Value, typename Index>
+std::vector<std::byte> ppc::core::EncodeSparse(const CscMatrix<Value, Index>& matrix, SparseIndexCoding coding) {
+  return Encode(SparseLayout::kCsc, matrix.rows, matrix.cols, matrix.col_ptr, matrix.row_idx, matrix.values, coding);
+}
+
+template <typename Value, typename Index>
+ppc::core::SparseFileView<Value, Index>::SparseFileView(const std::byte* data, std::size_t size) {
+  const std::optional<SparseFileHeader> header = ReadSparseHeader(data, size);
+  if (!header) {
+    throw std::runtime_error("sparse file: not an encoded sparse matrix, or truncated");
+  }
+  if (header->value_type != ValueTypeOf<Value>() || header->index_bytes != sizeof(Index)) {
+    throw std::runtime_error("sparse file: stored value or index type differs from the requested one");
+  }
+  if (header->rows > static_cast<std::uint64_t>(std::numeric_limits<Index>::max()) ||
+      header->cols > static_cast<std::uint64_t>(std::numeric_limits<Index>::max())) {
+    throw std::runtime_error("sparse file: dimensions exceed the index type");
+  }
+  if (reinterpret_cast<std::uintptr_t>(data) % std::max(alignof(Value), alignof(Index)) != 0) {
+    throw std::runtime_error("sparse file: data is not aligned for the value and index types");
+  }
+  const Sections sections = Locate(*header);
+  layout_ = header->layout;
+  rows_ = static_cast<Index>(header->rows);
+  cols_ = static_cast<Index>(header->cols);
+  pointers_ = {reinterpret_cast<const Index*>(data + sections.pointers), OuterSize(*header) + 1};
+  values_ = {reinterpret_cast<const Value*>(data + sections.values), header->nnz};
+  if (pointers_.front() != 0 || static_cast<std::uint64_t>(pointers_.back()) != header->nnz) {
+    throw std::runtime_error("sparse file: pointers do not span the stored entries");
+  }
+  // Every pointer is used as an offset into the index and value sections, so they must not decrease
+  for (std::size_t o = 0; o + 1 < pointers_.size(); ++o) {
+    if (pointers_[o] > pointers_[o + 1]) {
+      throw std::runtime_error("sparse file: pointers are not nondecreasing");
+    }
+  }
+  const Index inner = layout_ == SparseLayout::kCsr ? cols_ : rows_;
+  if (header->index_coding == SparseIndexCoding::kPlain) {
+    indices_ = {reinterpret_cast<const Index*>(data + sections.indices), header->nnz};
+    if (std::ranges::any_of(indices_, [inner](Index i) { return i < 0 || i >= inner; })) {
+      throw std::runtime_error("sparse file: index out of range");
+    }
+  } else {
+    decoded_ = DecompressIndices(pointers_, std::span(data + sections.indices, header->index_section_bytes),
+                                 header->nnz, inner);
+  }
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::SparseFileView<Value, Index>::ToCsr() const {
+  if (layout_ != SparseLayout::kCsr) {
+    throw std::runtime_error("sparse file: the matrix is stored by columns");
+  }
+  const std::span<const Index> indices = Indices();
+  return {.rows = rows_,
+          .cols = cols_,
+          .row_ptr = std::vector<Index>(pointers_.begin(), pointers_.end()),
+          .col_idx = std::vector<Index>(indices.begin(), indices.end()),
+          .values = std::vector<Value>(values_.begin(), values_.end())};
+}
+
+template <typename Value, typename Index>
+ppc::core::CscMatrix<Value, Index> ppc::core::SparseFileView<Value, Index>::ToCsc() const {
+  if (layout_ != SparseLayout::kCsc) {
+    throw std::runtime_error("sparse file: the matrix is stored by rows");
+  }
+  const std::span<const Index> indices = Indices();
+  return {.rows = rows_,
+          .cols = cols_,
+          .col_ptr = std::vector<Index>(pointers_.begin(), pointers_.end()),
+          .row_idx = std::vector<Index>(indices.begin(), indices.end()),
+          .values = std::vector<Value>(values_.begin(), values_.end())};
+}
+
+ppc::core::MappedFile::MappedFile(const std::string& path) {
+#ifndef _WIN32
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  struct stat info {};
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw std::runtime_error("cannot stat " + path);
+  }
+  size_ = static_cast<std::size_t>(info.st_size);
+  if (size_ > 0) {
+    void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("cannot map " + path);
+    }
+    data_ = static_cast<const std::byte*>(mapping);
+    mapped_ = true;
+  }
+  close(fd);
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  buffer_.resize(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+}
+
+ppc::core::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      buffer_(std::move(other.buffer_)) {}
+
+ppc::core::MappedFile& ppc::core::MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Release();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+ppc::core::MappedFile::~MappedFile() { Release(); }
+
+void ppc::core::MappedFile::Release() {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(const_cast<std::byte*>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+  buffer_.clear();
+}
+
+void ppc::core::WriteBinaryFile(const std::string& path, std::span<const std::byte> bytes) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  if (!file) {
+    throw std::runtime_error("cannot write " + path);
+  }
+}
+
+namespace {
+
+constexpr std::string_view kBlanks = " \t\r";
+
+template <typename T>
+struct IsComplex : std::false_type {};
+
+template <typename T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+// Removes and returns the first whitespace-separated field of `line`, or an empty view if there is none
+std::string_view NextField(std::string_view& line) {
+  const std::size_t begin = std::min(line.find_first_not_of(kBlanks), line.size());
+  const std::size_t end = std::min(line.find_first_of(kBlanks, begin), line.size());
+  const std::string_view field = line.substr(begin, end - begin);
+  line.remove_prefix(end);
+  return field;
+}
+
+std::uint64_t ParseCount(std::string_view field) {
+  std::uint64_t value = 0;
+  const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+  if (field.empty() || error != std::errc() || end != field.data() + field.size()) {
+    throw std::runtime_error("expected a nonnegative integer, got '" + std::string(field) + "'");
+  }
+  return value;
+}
+
+double ParseReal(std::string_view field) {
+  // strtod needs a terminated string, which a mapped file does not provide
+  std::array<char, 64> buffer{};
+  if (field.empty() || field.size() >= buffer.size()) {
+    throw std::runtime_error("expected a number, got '" + std::string(field) + "'");
+  }
+  std::ranges::copy(field, buffer.begin());
+  char* end = nullptr;
+  const double value = std::strtod(buffer.data(), &end);
+  if (end != buffer.data() + field.size()) {
+    throw std::runtime_error("expected a number, got '" + std::string(field) + "'");
+  }
+  return value;
+}
+
+// The line starting at `pos`, without its end of line, and moves `pos` past it
+std::string_view NextLine(std::string_view text, std::size_t& pos) {
+  const std::size_t end = std::min(text.find('\n', pos), text.size());
+  const std::string_view line = text.substr(pos, end - pos);
+  pos = std::min(end + 1, text.size());
+  return line;
+}
+
+// Offsets cutting `text` into `parts` chunks of about equal length, each but the first starting after a line break
+std::vector<std::size_t> LineChunks(std::string_view text, std::size_t parts) {
+  std::vector<std::size_t> bounds = {0};
+  for (std::size_t p = 1; p < parts; ++p) {
+    std::size_t pos = std::max(bounds.back(), text.size() * p / parts);
+    if (pos > 0 && pos < text.size() && text[pos - 1] != '\n') {
+      pos = std::min(text.find('\n', pos), text.size() - 1) + 1;
+    }
+    bounds.push_back(pos);
+  }
+  bounds.push_back(text.size());
+  return bounds;
+}
+
+// Calls `line` with every line of text[begin, end) that is neither blank nor starts with one of `comments`
+template <typename Fn>
+void ForEachDataLine(std::string_view text, std::size_t begin, std::size_t end, std::string_view comments, Fn&& line) {
+  const std::string_view chunk = text.substr(begin, end - begin);
+  std::size_t pos = 0;
+  while (pos < chunk.size()) {
+    const std::string_view current = NextLine(chunk, pos);
+    const std::size_t first = current.find_first_not_of(kBlanks);
+    if (first != std::string_view::npos && comments.find(current[first]) == std::string_view::npos) {
+      line(current);
+    }
+  }
+}
+
+// Entries read by one part, with the first error it ran into
+template <typename Value, typename Index>
+struct PartEntries {
+  std::vector<Index> rows;
+  std::vector<Index> cols;
+  std::vector<Value> values;
+  std::uint64_t lines = 0;
+  std::uint64_t max_index = 0;
+  std::string error;
+
+  void Add(std::uint64_t row, std::uint64_t col, const Value& value) {
+    rows.push_back(static_cast<Index>(row));
+    cols.push_back(static_cast<Index>(col));
+    values.push_back(value);
+  }
+};
+
+// The entries of all parts one after another; rethrows the first error of a part.
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> Concatenate(std::vector<PartEntries<Value, Index>>& entries, std::uint64_t rows,
+                                               std::uint64_t cols, const ppc::core::PartRunner& run) {
+  std::vector<std::size_t> offsets(entries.size() + 1, 0);
+  for (std::size_t p = 0; p < entries.size(); ++p) {
+    if (!entries[p].error.empty()) {
+      throw std::runtime_error("matrix file: " + entries[p].error);
+    }
+    offsets[p + 1] = offsets[p] + entries[p].values.size();
+  }
+  ppc::core::CooMatrix<Value, Index> coo;
+  coo.rows = static_cast<Index>(rows);
+  coo.cols = static_cast<Index>(cols);
+  coo.row_idx.resize(offsets.back());
+  coo.col_idx.resize(offsets.back());
+  coo.values.resize(offsets.back());
+  run(entries.size(), [&](std::size_t p) {
+    const auto offset = static_cast<std::ptrdiff_t>(offsets[p]);
+    std::ranges::copy(entries[p].rows, coo.row_idx.begin() + offset);
+    std::ranges::copy(entries[p].cols, coo.col_idx.begin() + offset);
+    std::ranges::copy(entries[p].values, coo.values.begin() + offset);
+    entries[p] = {};
+  });
+  return coo;
+}
+
+template <typename Value>
+Value ParseValue(ppc::core::MatrixMarketField field, std::string_view& line) {
+  if (field == ppc::core::MatrixMarketField::kPattern) {
+    return Value(1);
+  }
+  const double real = ParseReal(NextField(line));
+  if constexpr (IsComplex<Value>::value) {
+    if (field == ppc::core::MatrixMarketField::kComplex) {
+      return Value(real, ParseReal(NextField(line)));
+    }
+  }
+  return Value(real);
+}
+
+// The transposed entry a symmetric file leaves out
+template <typename Value>
+Value Mirror(ppc::core::MatrixMarketSymmetry symmetry, const Value& value) {
+  if (symmetry == ppc::core::MatrixMarketSymmetry::kSkewSymmetric) {
+    return -value;
+  }
+  if constexpr (IsComplex<Value>::value) {
+    if (symmetry == ppc::core::MatrixMarketSymmetry::kHermitian) {
+      return std::conj(value);
+    }
+  }
+  return value;
+}
+
+// First row an array file lists for a column: the lower triangle of symmetric matrices, without the diagonal if
+// skew-symmetric
+std::uint64_t FirstArrayRow(const ppc::core::MatrixMarketInfo& info, std::uint64_t col) {
+  switch (info.symmetry) {
+    case ppc::core::MatrixMarketSymmetry::kGeneral:
+      return 0;
+    case ppc::core::MatrixMarketSymmetry::kSymmetric:
+    case ppc::core::MatrixMarketSymmetry::kHermitian:
+      return col;
+    case ppc::core::MatrixMarketSymmetry::kSkewSymmetric:
+      return col + 1;
+  }
+  return 0;
+}
+
+// Walks the positions of an array file column by column
+class ArrayCursor {
+ public:
+  ArrayCursor(const ppc::core::MatrixMarketInfo& info, std::uint64_t ordinal) : info_(info) {
+    row_ = FirstArrayRow(info_, 0);
+    while (col_ < info_.cols && ordinal >= info_.rows - std::min(info_.rows, FirstArrayRow(info_, col_))) {
+      ordinal -= info_.rows - std::min(info_.rows, FirstArrayRow(info_, col_));
+      row_ = FirstArrayRow(info_, ++col_);
+    }
+    row_ += ordinal;
+  }
+
+  [[nodiscard]] std::uint64_t Row() const { return row_; }
+  [[nodiscard]] std::uint64_t Col() const { return col_; }
+
+  void Advance() {
+    ++row_;
+    while (row_ >= info_.rows && col_ < info_.cols) {
+      row_ = FirstArrayRow(info_, ++col_);
+    }
+  }
+
+ private:
+  const ppc::core::MatrixMarketInfo& info_;
+  std::uint64_t row_ = 0;
+  std::uint64_t col_ = 0;
+};
+
+template <typename Index>
+void CheckFitsIndex(std::uint64_t rows, std::uint64_t cols) {
+  if (rows > static_cast<std::uint64_t>(std::numeric_limits<Index>::max()) ||
+      cols > static_cast<std::uint64_t>(std::numeric_limits<Index>::max())) {
+    throw std::runtime_error("matrix file: dimensions exceed the index type");
+  }
+}
+
+std::string_view FileText(const ppc::core::MappedFile& file) {
+  return {reinterpret_cast<const char*>(file.Data()), file.Size()};
+}
+
+}  // namespace
+
+ppc::core::MatrixMarketInfo ppc::core::ReadMatrixMarketInfo(std::string_view text) {
+  std::size_t pos = 0;
+  std::string_view banner = NextLine(text, pos);
+  std::array<std::string, 5> words;
+  for (auto& word : words) {
+    const std::string_view field = NextField(banner);
+    std::ranges::transform(field, std::back_inserter(word), [](char c) {
+      return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+  }
+  if (words[0] != "%%matrixmarket" || words[1] != "matrix") {
+    throw std::runtime_error("matrix file: missing %%MatrixMarket matrix banner");
+  }
+
+  MatrixMarketInfo info;
+  if (words[2] == "coordinate") {
+    info.format = MatrixMarketFormat::kCoordinate;
+  } else if (words[2] == "array") {
+    info.format = MatrixMarketFormat::kArray;
+  } else {
+    throw std::runtime_error("matrix file: unsupported format '" + words[2] + "'");
+  }
+  if (words[3] == "real" || words[3] == "double") {
+    info.field = MatrixMarketField::kReal;
+  } else if (words[3] == "integer") {
+    info.field = MatrixMarketField::kInteger;
+  } else if (words[3] == "complex") {
+    info.field = MatrixMarketField::kComplex;
+  } else if (words[3] == "pattern" && info.format == MatrixMarketFormat::kCoordinate) {
+    info.field = MatrixMarketField::kPattern;
+  } else {
+    throw std::runtime_error("matrix file: unsupported field '" + words[3] + "'");
+  }
+  if (words[4] == "general") {
+    info.symmetry = MatrixMarketSymmetry::kGeneral;
+  } else if (words[4] == "symmetric") {
+    info.symmetry = MatrixMarketSymmetry::kSymmetric;
+  } else if (words[4] == "skew-symmetric") {
+    info.symmetry = MatrixMarketSymmetry::kSkewSymmetric;
+  } else if (words[4] == "hermitian" && info.field == MatrixMarketField::kComplex) {
+    info.symmetry = MatrixMarketSymmetry::kHermitian;
+  } else {
+    throw std::runtime_error("matrix file: unsupported symmetry '" + words[4] + "'");
+  }
+
+  std::string_view size_line;
+  while (pos < text.size() && size_line.empty()) {
+    size_line = NextLine(text, pos);
+    const std::size_t first = size_line.find_first_not_of(kBlanks);
+    if (first == std::string_view::npos || size_line[first] == '%') {
+      size_line = {};
+    }
+  }
+  info.rows = ParseCount(NextField(size_line));
+  info.cols = ParseCount(NextField(size_line));
+  if (info.format == MatrixMarketFormat::kCoordinate) {
+    info.entries = ParseCount(NextField(size_line));
+  } else if (info.symmetry == MatrixMarketSymmetry::kGeneral) {
+    info.entries = info.rows * info.cols;
+  } else if (info.symmetry == MatrixMarketSymmetry::kSkewSymmetric) {
+    info.entries = info.rows * (info.rows - std::min<std::uint64_t>(info.rows, 1)) / 2;
+  } else {
+    info.entries = info.rows * (info.rows + 1) / 2;
+  }
+  if (info.symmetry != MatrixMarketSymmetry::kGeneral && info.rows != info.cols) {
+    throw std::runtime_error("matrix file: a symmetric matrix must be square");
+  }
+  info.data_offset = pos;
+  return info;
+}
+
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> ppc::core::ParseMatrixMarket(std::string_view text, std::size_t parts,
+                                                                const PartRunner& run) {
+  const MatrixMarketInfo info = ReadMatrixMarketInfo(text);
+  if (info.field == MatrixMarketField::kComplex && !IsComplex<Value>::value) {
+    throw std::runtime_error("matrix file: complex entries need a complex value type");
+  }
+  CheckFitsIndex<Index>(info.rows, info.cols);
+  const std::string_view body = text.substr(info.data_offset);
+  const std::vector<std::size_t> bounds = LineChunks(body, std::max<std::size_t>(parts, 1));
+  std::vector<PartEntries<Value, Index>> entries(bounds.size() - 1);
+
+  // Values of an array file are placed by their ordinal, so each part first needs the lines of the ones before it
+  std::vector<std::uint64_t> first_line(entries.size(), 0);
+  if (info.format == MatrixMarketFormat::kArray) {
+    run(entries.size(), [&](std::size_t p) {
+      ForEachDataLine(body, bounds[p], bounds[p + 1], "%", [&](std::string_view) { ++first_line[p]; });
+    });
+    std::exclusive_scan(first_line.begin(), first_line.end(), first_line.begin(), std::uint64_t{0});
+  }
+
+  run(entries.size(), [&](std::size_t p) {
+    PartEntries<Value, Index>& out = entries[p];
+    out.rows.reserve((bounds[p + 1] - bounds[p]) / 16);
+    out.cols.reserve((bounds[p + 1] - bounds[p]) / 16);
+    out.values.reserve((bounds[p + 1] - bounds[p]) / 16);
+    try {
+      ArrayCursor cursor(info, first_line[p]);
+      ForEachDataLine(body, bounds[p], bounds[p + 1], "%", [&](std::string_view line) {
+        std::uint64_t row = 0;
+        std::uint64_t col = 0;
+        if (info.format == MatrixMarketFormat::kCoordinate) {
+          row = ParseCount(NextField(line));
+          col = ParseCount(NextField(line));
+          if (row == 0 || row > info.rows || col == 0 || col > info.cols) {
+            throw std::runtime_error("entry (" + std::to_string(row) + ", " + std::to_string(col) + ") out of range");
+          }
+          --row;
+          --col;
+        } else {
+          if (cursor.Col() >= info.cols) {
+            throw std::runtime_error("more values than the array holds");
+          }
+          row = cursor.Row();
+          col = cursor.Col();
+          cursor.Advance();
+        }
+        const auto value = ParseValue<Value>(info.field, line);
+        ++out.lines;
+        if (info.format == MatrixMarketFormat::kArray && value == Value(0)) {
+          return;
+        }
+        out.Add(row, col, value);
+        if (info.symmetry != MatrixMarketSymmetry::kGeneral && row != col) {
+          out.Add(col, row, Mirror(info.symmetry, value));
+        }
+      });
+    } catch (const std::exception& e) {
+      out.error = e.what();
+    }
+  });
+
+  std::uint64_t lines = 0;
+  for (const auto& part : entries) {
+    lines += part.lines;
+  }
+  if (lines != info.entries && std::ranges::all_of(entries, [](const auto& part) { return part.error.empty(); })) {
+    throw std::runtime_error("matrix file: " + std::to_string(lines) + " entries listed, " +
+                             std::to_string(info.entries) + " declared");
+  }
+  return Concatenate(entries, info.rows, info.cols, run);
+}
+
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> ppc::core::ReadMatrixMarket(const std::string& path, std::size_t parts,
+                                                               const PartRunner& run) {
+  const MappedFile file(path);
+  return ParseMatrixMarket<Value, Index>(FileText(file), parts, run);
+}
+
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> ppc::core::ParseEdgeList(std::string_view text, bool undirected,
+                                                            std::size_t parts, const PartRunner& run) {
+  const std::vector<std::size_t> bounds = LineChunks(text, std::max<std::size_t>(parts, 1));
+  std::vector<PartEntries<Value, Index>> entries(bounds.size() - 1);
+  run(entries.size(), [&](std::size_t p) {
+    PartEntries<Value, Index>& out = entries[p];
+    try {
+      ForEachDataLine(text, bounds[p], bounds[p + 1], "#%", [&](std::string_view line) {
+        const std::uint64_t source = ParseCount(NextField(line));
+        const std::uint64_t target = ParseCount(NextField(line));
+        const std::string_view weight = NextField(line);
+        const Value value = weight.empty() ? Value(1) : Value(ParseReal(weight));
+        out.max_index = std::max({out.max_index, source + 1, target + 1});
+        out.Add(source, target, value);
+        if (undirected && source != target) {
+          out.Add(target, source, value);
+        }
+      });
+    } catch (const std::exception& e) {
+      out.error = e.what();
+    }
+  });
+
+  std::uint64_t vertices = 0;
+  for (const auto& part : entries) {
+    vertices = std::max(vertices, part.max_index);
+  }
+  CheckFitsIndex<Index>(vertices, vertices);
+  return Concatenate(entries, vertices, vertices, run);
+}
+
+template <typename Value, typename Index>
+ppc::core::CooMatrix<Value, Index> ppc::core::ReadEdgeList(const std::string& path, bool undirected,
+                                                           std::size_t parts, const PartRunner& run) {
+  const MappedFile file(path);
+  return ParseEdgeList<Value, Index>(FileText(file), undirected, parts, run);
+}
+
+template std::vector<std::byte> ppc::core::EncodeSparse(const CsrMatrix<double>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CsrMatrix<float>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CsrMatrix<std::complex<double>>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CsrMatrix<double, std::int64_t>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CscMatrix<double>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CscMatrix<float>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CscMatrix<std::complex<double>>&, SparseIndexCoding);
+template std::vector<std::byte> ppc::core::EncodeSparse(const CscMatrix<double, std::int64_t>&, SparseIndexCoding);
+template class ppc::core::SparseFileView<double>;
+template class ppc::core::SparseFileView<float>;
+template class ppc::core::SparseFileView<std::complex<double>>;
+template class ppc::core::SparseFileView<double, std::int64_t>;
+template ppc::core::CooMatrix<double> ppc::core::ParseMatrixMarket<double>(std::string_view, std::size_t,
+                                                                           const PartRunner&);
+template ppc::core::CooMatrix<double> ppc::core::ReadMatrixMarket<double>(const std::string&, std::size_t,
+                                                                          const PartRunner&);
+template ppc::core::CooMatrix<double> ppc::core::ParseEdgeList<double>(std::string_view, bool, std::size_t,
+                                                                       const PartRunner&);
+template ppc::core::CooMatrix<double> ppc::core::ReadEdgeList<double>(const std::string&, bool, std::size_t,
+                                                                      const PartRunner&);
+template ppc::core::CooMatrix<float> ppc::core::ParseMatrixMarket<float>(std::string_view, std::size_t,
+                                                                         const PartRunner&);
+template ppc::core::CooMatrix<float> ppc::core::ReadMatrixMarket<float>(const std::string&, std::size_t,
+                                                                        const PartRunner&);
+template ppc::core::CooMatrix<float> ppc::core::ParseEdgeList<float>(std::string_view, bool, std::size_t,
+                                                                     const PartRunner&);
+template ppc::core::CooMatrix<float> ppc::core::ReadEdgeList<float>(const std::string&, bool, std::size_t,
+                                                                    const PartRunner&);
+template ppc::core::CooMatrix<std::complex<double>> ppc::core::ParseMatrixMarket<std::complex<double>>(
+    std::string_view, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<std::complex<double>> ppc::core::ReadMatrixMarket<std::complex<double>>(
+    const std::string&, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<std::complex<double>> ppc::core::ParseEdgeList<std::complex<double>>(
+    std::string_view, bool, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<std::complex<double>> ppc::core::ReadEdgeList<std::complex<double>>(
+    const std::string&, bool, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<double, std::int64_t> ppc::core::ParseMatrixMarket<double, std::int64_t>(
+    std::string_view, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<double, std::int64_t> ppc::core::ReadMatrixMarket<double, std::int64_t>(
+    const std::string&, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<double, std::int64_t> ppc::core::ParseEdgeList<double, std::int64_t>(
+    std::string_view, bool, std::size_t, const PartRunner&);
+template ppc::core::CooMatrix<double, std::int64_t> ppc::core::ReadEdgeList<double, std::int64_t>(
+    const std::string&, bool, std::size_t, const PartRunner&);
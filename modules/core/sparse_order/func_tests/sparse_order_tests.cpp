@@ -0,0 +1,239 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_order/include/sparse_order.hpp"
+
+namespace {
+
+void RunOnThreads(std::size_t parts, const std::function<void(std::size_t)>& part) {
+  std::vector<std::thread> threads;
+  for (std::size_t p = 0; p < parts; ++p) {
+    threads.emplace_back(part, p);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+template <typename Index = int>
+ppc::core::CsrMatrix<double, Index> FromEntries(Index rows, Index cols, std::vector<Index> row_idx,
+                                                std::vector<Index> col_idx) {
+  ppc::core::CooMatrix<double, Index> coo{.rows = rows,
+                                          .cols = cols,
+                                          .row_idx = std::move(row_idx),
+                                          .col_idx = std::move(col_idx),
+                                          .values = {}};
+  coo.values.resize(coo.row_idx.size());
+  std::iota(coo.values.begin(), coo.values.end(), 1.0);
+  return coo.ToCsr();
+}
+
+// Pattern of the 5-point Laplacian of a side x side grid, the vertex of (x, y) numbered
+// first + (y * side + x) * stride.
+void AddGrid(int side, int first, std::vector<int>& row_idx, std::vector<int>& col_idx, int stride = 1) {
+  const auto vertex = [&](int x, int y) { return first + ((y * side + x) * stride); };
+  for (int y = 0; y < side; ++y) {
+    for (int x = 0; x < side; ++x) {
+      row_idx.push_back(vertex(x, y));
+      col_idx.push_back(vertex(x, y));
+      if (x + 1 < side) {
+        row_idx.insert(row_idx.end(), {vertex(x, y), vertex(x + 1, y)});
+        col_idx.insert(col_idx.end(), {vertex(x + 1, y), vertex(x, y)});
+      }
+      if (y + 1 < side) {
+        row_idx.insert(row_idx.end(), {vertex(x, y), vertex(x, y + 1)});
+        col_idx.insert(col_idx.end(), {vertex(x, y + 1), vertex(x, y)});
+      }
+    }
+  }
+}
+
+std::vector<int> RandomPermutation(int n, unsigned seed) {
+  std::vector<int> perm(n);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::ranges::shuffle(perm, std::mt19937(seed));
+  return perm;
+}
+
+bool IsPermutation(std::vector<int> perm, std::size_t n) {
+  std::ranges::sort(perm);
+  std::vector<int> identity(n);
+  std::iota(identity.begin(), identity.end(), 0);
+  return perm == identity;
+}
+
+// The grid with its vertices numbered at random, so that its bandwidth is about the order of the matrix.
+ppc::core::CsrMatrix<double> ScrambledGrid(int side) {
+  std::vector<int> row_idx;
+  std::vector<int> col_idx;
+  AddGrid(side, 0, row_idx, col_idx);
+  const auto grid = FromEntries(side * side, side * side, row_idx, col_idx);
+  const std::vector<int> perm = RandomPermutation(side * side, 7);
+  return ppc::core::Permute(grid, perm, perm);
+}
+
+}  // namespace
+
+TEST(sparse_order_tests, permute_moves_entries_and_inverse_undoes_it) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> row(0, 29);
+  std::uniform_int_distribution<int> col(0, 44);
+  std::vector<int> row_idx;
+  std::vector<int> col_idx;
+  for (int e = 0; e < 300; ++e) {
+    row_idx.push_back(row(gen));
+    col_idx.push_back(col(gen));
+  }
+  const auto matrix = FromEntries(30, 45, row_idx, col_idx);
+  const std::vector<int> row_perm = RandomPermutation(30, 1);
+  const std::vector<int> col_perm = RandomPermutation(45, 2);
+
+  for (const std::size_t parts : {1, 4}) {
+    const auto permuted = ppc::core::Permute(matrix, row_perm, col_perm, parts, RunOnThreads);
+    ASSERT_TRUE(permuted.IsValid());
+    std::vector<double> dense(30 * 45);
+    std::vector<double> permuted_dense(30 * 45);
+    matrix.ToDense(dense.data(), 45);
+    permuted.ToDense(permuted_dense.data(), 45);
+    for (int i = 0; i < 30; ++i) {
+      for (int j = 0; j < 45; ++j) {
+        EXPECT_EQ(permuted_dense[(i * 45) + j], dense[(row_perm[i] * 45) + col_perm[j]]);
+      }
+    }
+
+    const auto restored = ppc::core::Permute(permuted, ppc::core::InvertPermutation(row_perm),
+                                             ppc::core::InvertPermutation(col_perm), parts, RunOnThreads);
+    EXPECT_EQ(restored.row_ptr, matrix.row_ptr);
+    EXPECT_EQ(restored.col_idx, matrix.col_idx);
+    EXPECT_EQ(restored.values, matrix.values);
+
+    // Rows only: the columns stay in place
+    const auto rows_only = ppc::core::Permute(matrix, row_perm, {}, parts, RunOnThreads);
+    EXPECT_EQ(ppc::core::Permute(rows_only, ppc::core::InvertPermutation(row_perm), {}).values, matrix.values);
+  }
+}
+
+TEST(sparse_order_tests, invalid_permutations_are_rejected) {
+  EXPECT_THROW(ppc::core::InvertPermutation(std::vector<int>{0, 2, 2}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::InvertPermutation(std::vector<int>{0, 3, 1}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::InvertPermutation(std::vector<int>{-1, 0}), std::invalid_argument);
+  EXPECT_EQ(ppc::core::InvertPermutation(std::vector<int>{2, 0, 1}), (std::vector<int>{1, 2, 0}));
+
+  const auto matrix = FromEntries(3, 2, {0, 2}, {1, 0});
+  EXPECT_THROW(ppc::core::Permute(matrix, {0, 1}, {}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::Permute(matrix, {}, {1, 1}), std::invalid_argument);
+  EXPECT_THROW(ppc::core::ReverseCuthillMcKee(matrix), std::invalid_argument);
+  EXPECT_THROW(ppc::core::NestedDissection(matrix), std::invalid_argument);
+  const auto square = FromEntries(2, 2, {0, 1}, {1, 0});
+  EXPECT_THROW(ppc::core::NestedDissection(square, 0), std::invalid_argument);
+}
+
+TEST(sparse_order_tests, band_profile_of_small_matrix) {
+  // Row 0: (0, 0), (0, 3); row 1: empty; row 2: (2, 0), (2, 2); row 3: (3, 1)
+  const auto matrix = FromEntries(4, 4, {0, 0, 2, 2, 3}, {0, 3, 0, 2, 1});
+  const ppc::core::BandProfile band = ppc::core::MeasureBandProfile(matrix, 3, RunOnThreads);
+  EXPECT_EQ(band.bandwidth, 3U);
+  EXPECT_EQ(band.profile, 4U);
+
+  const ppc::core::BandProfile empty = ppc::core::MeasureBandProfile(ppc::core::CsrMatrix<double>{});
+  EXPECT_EQ(empty.bandwidth, 0U);
+  EXPECT_EQ(empty.profile, 0U);
+}
+
+TEST(sparse_order_tests, reverse_cuthill_mckee_narrows_a_scrambled_grid) {
+  constexpr int kSide = 40;
+  const auto matrix = ScrambledGrid(kSide);
+  const ppc::core::BandProfile before = ppc::core::MeasureBandProfile(matrix);
+
+  const std::vector<int> perm = ppc::core::ReverseCuthillMcKee(matrix);
+  ASSERT_TRUE(IsPermutation(perm, kSide * kSide));
+  const auto reordered = ppc::core::Permute(matrix, perm, perm);
+  ASSERT_TRUE(reordered.IsValid());
+  const ppc::core::BandProfile after = ppc::core::MeasureBandProfile(reordered);
+  // Level sets of a grid are its anti-diagonals, at most kSide vertices wide
+  EXPECT_LE(after.bandwidth, static_cast<std::size_t>(2 * kSide));
+  EXPECT_LT(after.profile * 10, before.profile);
+}
+
+TEST(sparse_order_tests, reverse_cuthill_mckee_covers_components_and_unsymmetric_patterns) {
+  // A path given by its upper triangle only, two isolated vertices and a separate grid
+  std::vector<int> row_idx{0, 1, 2, 3};
+  std::vector<int> col_idx{1, 2, 3, 4};
+  AddGrid(5, 7, row_idx, col_idx);
+  const auto matrix = FromEntries(32, 32, row_idx, col_idx);
+  const std::vector<int> perm = ppc::core::ReverseCuthillMcKee(matrix);
+  ASSERT_TRUE(IsPermutation(perm, 32));
+  const auto reordered = ppc::core::Permute(matrix, perm, perm);
+  EXPECT_LE(ppc::core::MeasureBandProfile(reordered).bandwidth, 10U);
+}
+
+TEST(sparse_order_tests, parts_do_not_change_the_orderings) {
+  // Random graph whose middle levels are wide enough to be expanded in parallel
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> vertex(0, 19999);
+  std::vector<int> row_idx;
+  std::vector<int> col_idx;
+  for (int e = 0; e < 100000; ++e) {
+    row_idx.push_back(vertex(gen));
+    col_idx.push_back(vertex(gen));
+  }
+  const auto matrix = FromEntries(20000, 20000, row_idx, col_idx);
+
+  const std::vector<int> rcm = ppc::core::ReverseCuthillMcKee(matrix);
+  ASSERT_TRUE(IsPermutation(rcm, 20000));
+  EXPECT_EQ(ppc::core::ReverseCuthillMcKee(matrix, 4, RunOnThreads), rcm);
+
+  const std::vector<int> nd = ppc::core::NestedDissection(matrix, 64);
+  ASSERT_TRUE(IsPermutation(nd, 20000));
+  EXPECT_EQ(ppc::core::NestedDissection(matrix, 64, 4, RunOnThreads), nd);
+  EXPECT_EQ(ppc::core::ComputeOrdering(matrix, ppc::core::SparseOrdering::kNestedDissection, 3, RunOnThreads), nd);
+}
+
+TEST(sparse_order_tests, nested_dissection_separates_components_and_halves) {
+  // Two grids with interleaved numbering: vertex 2k belongs to the first and 2k + 1 to the second
+  constexpr int kSide = 30;
+  constexpr int kVertices = 2 * kSide * kSide;
+  std::vector<int> row_idx;
+  std::vector<int> col_idx;
+  AddGrid(kSide, 0, row_idx, col_idx, 2);
+  AddGrid(kSide, 1, row_idx, col_idx, 2);
+  const auto matrix = FromEntries(kVertices, kVertices, row_idx, col_idx);
+
+  const std::vector<int> perm = ppc::core::NestedDissection(matrix, 16, 2, RunOnThreads);
+  ASSERT_TRUE(IsPermutation(perm, kVertices));
+  // The components are numbered one after the other, with no separator
+  const int first_parity = perm[0] % 2;
+  for (int i = 0; i < kVertices; ++i) {
+    EXPECT_EQ(perm[i] % 2, i < kVertices / 2 ? first_parity : 1 - first_parity);
+  }
+}
+
+TEST(sparse_order_tests, nested_dissection_cuts_a_path_at_its_middle_level) {
+  // Searching from the end 0, each vertex is a level of its own. The separator is the level that reaches half of
+  // the vertices; both halves are leaves and keep their search order.
+  const auto path = FromEntries(9, 9, {0, 1, 2, 3, 4, 5, 6, 7}, {1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_EQ(ppc::core::NestedDissection(path, 8), (std::vector<int>{0, 1, 2, 4, 5, 6, 7, 8, 3}));
+  EXPECT_EQ(ppc::core::NestedDissection(path, 9), (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+}
+
+TEST(sparse_order_tests, natural_ordering_is_the_identity) {
+  const auto matrix = ScrambledGrid(5);
+  const std::vector<int> perm = ppc::core::ComputeOrdering(matrix, ppc::core::SparseOrdering::kNatural);
+  std::vector<int> identity(25);
+  std::iota(identity.begin(), identity.end(), 0);
+  EXPECT_EQ(perm, identity);
+
+  const auto wide = FromEntries<std::int64_t>(2, 2, {0, 1}, {1, 0});
+  EXPECT_EQ(ppc::core::ReverseCuthillMcKee(wide).size(), 2U);
+}
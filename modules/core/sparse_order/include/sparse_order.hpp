@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace ppc::core {
+
+// Symmetric reorderings of square sparse matrices. A permutation perm lists the rows of the reordered matrix: its row
+// i is row perm[i] of the original. The orderings only look at the pattern of A + A^T, so they also apply to
+// matrices whose pattern is not symmetric.
+//   kReverseCuthillMcKee  breadth-first from a pseudo-peripheral vertex, neighbours by increasing degree, reversed.
+//                         Gathers the entries of a mesh or band matrix around the diagonal, so that the rows a row
+//                         refers to were touched shortly before.
+//   kNestedDissection     recursive bisection of the graph by a separator level of a breadth-first search, each
+//                         half numbered before its separator. Keeps the rows of a subdomain together, and the
+//                         halves of every bisection never refer to each other.
+enum class SparseOrdering : uint8_t { kNatural, kReverseCuthillMcKee, kNestedDissection };
+
+struct BandProfile {
+  // Largest |i - j| over the entries.
+  std::size_t bandwidth = 0;
+  // Sum over the rows of the distance from the first entry of the row to the diagonal, zero if there is none left
+  // of it: the size of the lower envelope a skyline factorization fills.
+  std::size_t profile = 0;
+};
+
+// Each part measures a range of rows.
+template <typename Value, typename Index = int>
+BandProfile MeasureBandProfile(const CsrMatrix<Value, Index>& matrix, std::size_t parts = 1,
+                               const PartRunner& run = RunPartsSequentially);
+
+// The permutation undoing `perm`; throws std::invalid_argument if perm is not a permutation of 0 .. size - 1.
+template <typename Index>
+std::vector<Index> InvertPermutation(const std::vector<Index>& perm);
+
+// The matrix B with B(i, j) = A(row_perm[i], col_perm[j]); an empty permutation leaves its dimension in place.
+// Permute(B, InvertPermutation(row_perm), InvertPermutation(col_perm)) gives A back. Parts fill ranges of rows, and
+// sort their entries by column again if the columns moved. Throws std::invalid_argument if a permutation does not
+// match its dimension.
+template <typename Value, typename Index = int>
+CsrMatrix<Value, Index> Permute(const CsrMatrix<Value, Index>& matrix, const std::vector<Index>& row_perm,
+                                const std::vector<Index>& col_perm, std::size_t parts = 1,
+                                const PartRunner& run = RunPartsSequentially);
+
+// Reverse Cuthill-McKee ordering, one connected component after another. The breadth-first search is inherently
+// level by level, but the parts expand the vertices of a wide level together, and they also build the graph of
+// A + A^T. The result does not depend on the number of parts. Throws std::invalid_argument unless A is square.
+template <typename Value, typename Index = int>
+std::vector<Index> ReverseCuthillMcKee(const CsrMatrix<Value, Index>& matrix, std::size_t parts = 1,
+                                       const PartRunner& run = RunPartsSequentially);
+
+// Nested dissection ordering that stops bisecting at `leaf_size` vertices. The subgraphs of one level of the
+// recursion are independent: the parts take ranges of them once there are enough, and expand the levels of the
+// searches together before. Throws std::invalid_argument unless A is square and leaf_size positive.
+template <typename Value, typename Index = int>
+std::vector<Index> NestedDissection(const CsrMatrix<Value, Index>& matrix, Index leaf_size = 64,
+                                    std::size_t parts = 1, const PartRunner& run = RunPartsSequentially);
+
+// The permutation of `ordering`, the identity for kNatural.
+template <typename Value, typename Index = int>
+std::vector<Index> ComputeOrdering(const CsrMatrix<Value, Index>& matrix, SparseOrdering ordering,
+                                   std::size_t parts = 1, const PartRunner& run = RunPartsSequentially);
+
+}  // namespace ppc::core
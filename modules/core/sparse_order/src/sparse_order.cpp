@@ -0,0 +1,500 @@
+#include "core/sparse_order/include/sparse_order.hpp"
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+// Neighbours a level must have before its vertices are expanded by several parts. Most levels of a band matrix are
+// far narrower, and cost less to expand than to hand out.
+constexpr std::size_t kParallelLevelEdges = std::size_t{1} << 14;
+
+// [0, n) is split into `parts` near-equal ranges; range p is [EvenSplit(n, parts, p), EvenSplit(n, parts, p + 1)).
+std::size_t EvenSplit(std::size_t n, std::size_t parts, std::size_t p) { return (n * p) / parts; }
+
+std::size_t UsefulParts(std::size_t parts, std::size_t n) { return std::max<std::size_t>(1, std::min(parts, n)); }
+
+template <typename Value, typename Index>
+void RequireSquare(const ppc::core::CsrMatrix<Value, Index>& matrix) {
+  if (matrix.rows != matrix.cols) {
+    throw std::invalid_argument("sparse ordering: the matrix is not square");
+  }
+}
+
+// Adjacency lists of the graph of A + A^T without self-loops, each sorted.
+template <typename Index>
+struct Graph {
+  std::vector<Index> ptr;
+  std::vector<Index> adj;
+
+  [[nodiscard]] std::size_t Degree(Index v) const { return static_cast<std::size_t>(ptr[v + 1] - ptr[v]); }
+
+  // Orders vertices by degree, then by index.
+  [[nodiscard]] bool Before(Index a, Index b) const { return std::pair(Degree(a), a) < std::pair(Degree(b), b); }
+};
+
+// Merges the sorted columns [a, a_end) of row i of A with [t, t_end) of row i of A^T, without i itself. Writes them
+// to out unless it is null, and returns how many there are.
+template <typename Index>
+std::size_t MergeRow(Index i, const Index* a, const Index* a_end, const Index* t, const Index* t_end, Index* out) {
+  std::size_t count = 0;
+  while (a != a_end || t != t_end) {
+    Index j = 0;
+    if (t == t_end || (a != a_end && *a < *t)) {
+      j = *a++;
+    } else if (a == a_end || *t < *a) {
+      j = *t++;
+    } else {
+      j = *a++;
+      ++t;
+    }
+    if (j != i) {
+      if (out != nullptr) {
+        out[count] = j;
+      }
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Each part counts and then fills the lists of a range of vertices.
+template <typename Value, typename Index>
+Graph<Index> SymmetricGraph(const ppc::core::CsrMatrix<Value, Index>& matrix, std::size_t parts,
+                            const ppc::core::PartRunner& run) {
+  const auto n = static_cast<std::size_t>(matrix.rows);
+  const ppc::core::CscMatrix<Value, Index> transpose = matrix.ToCsc(parts, run);
+  const auto merge = [&](std::size_t i, Index* out) {
+    return MergeRow(static_cast<Index>(i), matrix.col_idx.data() + matrix.row_ptr[i],
+                    matrix.col_idx.data() + matrix.row_ptr[i + 1], transpose.row_idx.data() + transpose.col_ptr[i],
+                    transpose.row_idx.data() + transpose.col_ptr[i + 1], out);
+  };
+
+  Graph<Index> graph;
+  graph.ptr.assign(n + 1, 0);
+  const std::size_t used = UsefulParts(parts, n);
+  run(used, [&](std::size_t p) {
+    for (std::size_t i = EvenSplit(n, used, p); i < EvenSplit(n, used, p + 1); ++i) {
+      graph.ptr[i + 1] = static_cast<Index>(merge(i, nullptr));
+    }
+  });
+  std::partial_sum(graph.ptr.begin(), graph.ptr.end(), graph.ptr.begin());
+  graph.adj.resize(static_cast<std::size_t>(graph.ptr[n]));
+  run(used, [&](std::size_t p) {
+    for (std::size_t i = EvenSplit(n, used, p); i < EvenSplit(n, used, p + 1); ++i) {
+      merge(i, graph.adj.data() + graph.ptr[i]);
+    }
+  });
+  return graph;
+}
+
+// The vertices a breadth-first search reaches, in the order it reaches them: level l is [starts[l], starts[l + 1]).
+template <typename Index>
+struct Levels {
+  std::vector<Index> order;
+  std::vector<std::size_t> starts;
+
+  [[nodiscard]] std::size_t Depth() const { return starts.size() - 1; }
+};
+
+// Searches from root through the vertices v with inside(v) whose mark is not `stamp`, marking them with it. With
+// by_degree the new neighbours of every vertex follow it by increasing degree, which is the Cuthill-McKee order. The
+// parts collect the neighbours of ranges of a wide level, which are then appended in the order of the vertices they
+// came from, so the search takes the same course with any number of parts. Marks outside are never read.
+template <typename Index, typename Inside>
+Levels<Index> VisitLevels(const Graph<Index>& graph, Index root, bool by_degree, const Inside& inside,
+                          std::vector<std::size_t>& mark, std::size_t stamp, std::size_t parts,
+                          const ppc::core::PartRunner& run) {
+  Levels<Index> levels;
+  levels.order.push_back(root);
+  levels.starts.push_back(0);
+  mark[root] = stamp;
+  std::vector<std::vector<Index>> found(std::max<std::size_t>(parts, 1));
+  while (levels.starts.back() < levels.order.size()) {
+    const std::size_t begin = levels.starts.back();
+    const std::size_t end = levels.order.size();
+    levels.starts.push_back(end);
+    std::size_t edges = 0;
+    for (std::size_t k = begin; k < end; ++k) {
+      edges += graph.Degree(levels.order[k]);
+    }
+
+    const std::size_t used = edges >= kParallelLevelEdges ? UsefulParts(parts, end - begin) : 1;
+    const auto collect = [&](std::size_t p) {
+      std::vector<Index>& out = found[p];
+      out.clear();
+      for (std::size_t k = begin + EvenSplit(end - begin, used, p); k < begin + EvenSplit(end - begin, used, p + 1);
+           ++k) {
+        const Index v = levels.order[k];
+        const std::size_t first = out.size();
+        for (auto e = static_cast<std::size_t>(graph.ptr[v]); e < static_cast<std::size_t>(graph.ptr[v + 1]); ++e) {
+          const Index w = graph.adj[e];
+          if (inside(w) && mark[w] != stamp) {
+            out.push_back(w);
+          }
+        }
+        if (by_degree) {
+          std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(),
+                    [&](Index a, Index b) { return graph.Before(a, b); });
+        }
+      }
+    };
+    if (used == 1) {
+      collect(0);
+    } else {
+      run(used, collect);
+    }
+    for (std::size_t p = 0; p < used; ++p) {
+      for (const Index w : found[p]) {
+        if (mark[w] != stamp) {
+          mark[w] = stamp;
+          levels.order.push_back(w);
+        }
+      }
+    }
+  }
+  return levels;
+}
+
+// George and Liu's pseudo-peripheral vertex: searches again from a vertex of least degree in the last level for as
+// long as that makes the level structure deeper, and returns the deepest one, whose root is the vertex.
+// fresh_stamp() gives a mark no vertex of the component holds.
+template <typename Index, typename Inside, typename FreshStamp>
+Levels<Index> PeripheralLevels(const Graph<Index>& graph, Index start, const Inside& inside,
+                               std::vector<std::size_t>& mark, const FreshStamp& fresh_stamp, std::size_t parts,
+                               const ppc::core::PartRunner& run) {
+  Levels<Index> levels = VisitLevels(graph, start, false, inside, mark, fresh_stamp(), parts, run);
+  while (true) {
+    const auto last = levels.order.begin() + static_cast<std::ptrdiff_t>(levels.starts[levels.Depth() - 1]);
+    const Index candidate =
+        *std::min_element(last, levels.order.end(), [&](Index a, Index b) { return graph.Before(a, b); });
+    Levels<Index> next = VisitLevels(graph, candidate, false, inside, mark, fresh_stamp(), parts, run);
+    if (next.Depth() <= levels.Depth()) {
+      return levels;
+    }
+    levels = std::move(next);
+  }
+}
+
+template <typename Index>
+struct Subgraph {
+  std::vector<Index> vertices;
+  // Position of its first vertex in the ordering.
+  std::size_t offset = 0;
+};
+
+// Cuts subgraph s into halves[s], or orders it if it is a leaf, placing a separator between the halves at the end
+// of its positions in perm. The vertices of s are those labelled s; the search only ever reads and writes their
+// marks, so the subgraphs of a level may be cut concurrently.
+template <typename Index>
+void Bisect(const Graph<Index>& graph, std::size_t s, std::vector<Subgraph<Index>>& current,
+            std::vector<std::array<Subgraph<Index>, 2>>& halves, const std::vector<std::size_t>& label,
+            std::vector<std::size_t>& mark, std::vector<Index>& perm, std::size_t leaf_size, std::size_t parts,
+            const ppc::core::PartRunner& run) {
+  const std::vector<Index>& vertices = current[s].vertices;
+  const std::size_t offset = current[s].offset;
+  if (vertices.size() <= leaf_size) {
+    std::ranges::copy(vertices, perm.begin() + static_cast<std::ptrdiff_t>(offset));
+    return;
+  }
+
+  const auto inside = [&](Index w) { return label[w] == s; };
+  const auto fresh_stamp = [&] {
+    for (const Index v : vertices) {
+      mark[v] = 0;
+    }
+    return std::size_t{1};
+  };
+  Levels<Index> levels = PeripheralLevels(graph, vertices.front(), inside, mark, fresh_stamp, parts, run);
+
+  std::array<std::vector<Index>, 2> sides;
+  std::vector<Index> separator;
+  if (levels.order.size() < vertices.size()) {
+    // Disconnected: the component searched and the rest need no separator
+    sides[0] = std::move(levels.order);
+    for (const Index v : vertices) {
+      if (mark[v] == 0) {
+        sides[1].push_back(v);
+      }
+    }
+  } else if (levels.Depth() < 3) {
+    // Too dense to cut
+    std::ranges::copy(vertices, perm.begin() + static_cast<std::ptrdiff_t>(offset));
+    return;
+  } else {
+    // The level where half of the vertices have been reached, but neither the first nor the last
+    std::size_t m = 1;
+    while (m + 2 < levels.Depth() && levels.starts[m + 1] < vertices.size() / 2) {
+      ++m;
+    }
+    const auto level = [&](std::size_t l) {
+      return levels.order.begin() + static_cast<std::ptrdiff_t>(levels.starts[l]);
+    };
+    sides[0].assign(levels.order.begin(), level(m));
+    separator.assign(level(m), level(m + 1));
+    sides[1].assign(level(m + 1), levels.order.end());
+  }
+  const std::size_t separator_offset = offset + sides[0].size() + sides[1].size();
+  std::ranges::copy(separator, perm.begin() + static_cast<std::ptrdiff_t>(separator_offset));
+  halves[s][1] = {.vertices = std::move(sides[1]), .offset = offset + sides[0].size()};
+  halves[s][0] = {.vertices = std::move(sides[0]), .offset = offset};
+}
+
+}  // namespace
+
+template <typename Value, typename Index>
+ppc::core::BandProfile ppc::core::MeasureBandProfile(const CsrMatrix<Value, Index>& matrix, std::size_t parts,
+                                                     const PartRunner& run) {
+  const auto rows = static_cast<std::size_t>(matrix.rows);
+  const std::size_t used = UsefulParts(parts, rows);
+  std::vector<BandProfile> partial(used);
+  run(used, [&](std::size_t p) {
+    BandProfile& local = partial[p];
+    for (std::size_t i = EvenSplit(rows, used, p); i < EvenSplit(rows, used, p + 1); ++i) {
+      if (matrix.row_ptr[i] == matrix.row_ptr[i + 1]) {
+        continue;
+      }
+      const auto first = static_cast<std::size_t>(matrix.col_idx[matrix.row_ptr[i]]);
+      const auto last = static_cast<std::size_t>(matrix.col_idx[matrix.row_ptr[i + 1] - 1]);
+      const std::size_t left = first < i ? i - first : 0;
+      const std::size_t right = last > i ? last - i : 0;
+      local.bandwidth = std::max({local.bandwidth, left, right});
+      local.profile += left;
+    }
+  });
+  BandProfile total;
+  for (const BandProfile& local : partial) {
+    total.bandwidth = std::max(total.bandwidth, local.bandwidth);
+    total.profile += local.profile;
+  }
+  return total;
+}
+
+template <typename Index>
+std::vector<Index> ppc::core::InvertPermutation(const std::vector<Index>& perm) {
+  std::vector<Index> inverse(perm.size(), -1);
+  for (std::size_t i = 0; i < perm.size(); ++i) {
+    const Index p = perm[i];
+    if (p < 0 || static_cast<std::size_t>(p) >= perm.size() || inverse[p] != -1) {
+      throw std::invalid_argument("sparse ordering: not a permutation");
+    }
+    inverse[p] = static_cast<Index>(i);
+  }
+  return inverse;
+}
+
+template <typename Value, typename Index>
+ppc::core::CsrMatrix<Value, Index> ppc::core::Permute(const CsrMatrix<Value, Index>& matrix,
+                                                      const std::vector<Index>& row_perm,
+                                                      const std::vector<Index>& col_perm, std::size_t parts,
+                                                      const PartRunner& run) {
+  const auto rows = static_cast<std::size_t>(matrix.rows);
+  if ((!row_perm.empty() && row_perm.size() != rows) ||
+      (!col_perm.empty() && col_perm.size() != static_cast<std::size_t>(matrix.cols))) {
+    throw std::invalid_argument("sparse ordering: permutation size differs from the matrix");
+  }
+  if (!row_perm.empty()) {
+    // Only checks that it is a permutation
+    InvertPermutation(row_perm);
+  }
+  const std::vector<Index> new_col = col_perm.empty() ? std::vector<Index>() : InvertPermutation(col_perm);
+  const auto source = [&](std::size_t i) { return row_perm.empty() ? i : static_cast<std::size_t>(row_perm[i]); };
+
+  CsrMatrix<Value, Index> result;
+  result.rows = matrix.rows;
+  result.cols = matrix.cols;
+  result.row_ptr.assign(rows + 1, 0);
+  for (std::size_t i = 0; i < rows; ++i) {
+    const std::size_t r = source(i);
+    result.row_ptr[i + 1] = result.row_ptr[i] + (matrix.row_ptr[r + 1] - matrix.row_ptr[r]);
+  }
+  result.col_idx.resize(matrix.col_idx.size());
+  result.values.resize(matrix.values.size());
+
+  const std::size_t used = UsefulParts(parts, rows);
+  run(used, [&](std::size_t p) {
+    std::vector<std::pair<Index, Value>> row;
+    for (std::size_t i = EvenSplit(rows, used, p); i < EvenSplit(rows, used, p + 1); ++i) {
+      const std::size_t r = source(i);
+      const auto begin = static_cast<std::size_t>(matrix.row_ptr[r]);
+      const auto end = static_cast<std::size_t>(matrix.row_ptr[r + 1]);
+      const auto out = static_cast<std::size_t>(result.row_ptr[i]);
+      if (new_col.empty()) {
+        std::copy(matrix.col_idx.begin() + begin, matrix.col_idx.begin() + end, result.col_idx.begin() + out);
+        std::copy(matrix.values.begin() + begin, matrix.values.begin() + end, result.values.begin() + out);
+        continue;
+      }
+      row.clear();
+      for (std::size_t e = begin; e < end; ++e) {
+        row.emplace_back(new_col[matrix.col_idx[e]], matrix.values[e]);
+      }
+      std::ranges::sort(row, {}, &std::pair<Index, Value>::first);
+      for (std::size_t k = 0; k < row.size(); ++k) {
+        result.col_idx[out + k] = row[k].first;
+        result.values[out + k] = row[k].second;
+      }
+    }
+  });
+  return result;
+}
+
+template <typename Value, typename Index>
+std::vector<Index> ppc::core::ReverseCuthillMcKee(const CsrMatrix<Value, Index>& matrix, std::size_t parts,
+                                                  const PartRunner& run) {
+  RequireSquare(matrix);
+  const Graph<Index> graph = SymmetricGraph(matrix, parts, run);
+  const auto n = static_cast<std::size_t>(matrix.rows);
+
+  // Components are searched one after another, each with marks of its own, so a vertex is unmarked until the
+  // search of its component
+  std::vector<std::size_t> mark(n, 0);
+  std::size_t stamp = 0;
+  const auto fresh_stamp = [&stamp] { return ++stamp; };
+  const auto everywhere = [](Index) { return true; };
+
+  std::vector<Index> order;
+  order.reserve(n);
+  for (std::size_t v = 0; v < n; ++v) {
+    if (mark[v] != 0) {
+      continue;
+    }
+    const Index root =
+        PeripheralLevels(graph, static_cast<Index>(v), everywhere, mark, fresh_stamp, parts, run).order.front();
+    const Levels<Index> component = VisitLevels(graph, root, true, everywhere, mark, fresh_stamp(), parts, run);
+    order.insert(order.end(), component.order.begin(), component.order.end());
+  }
+  std::ranges::reverse(order);
+  return order;
+}
+
+template <typename Value, typename Index>
+std::vector<Index> ppc::core::NestedDissection(const CsrMatrix<Value, Index>& matrix, Index leaf_size,
+                                               std::size_t parts, const PartRunner& run) {
+  RequireSquare(matrix);
+  if (leaf_size <= 0) {
+    throw std::invalid_argument("sparse ordering: leaf size must be positive");
+  }
+  const Graph<Index> graph = SymmetricGraph(matrix, parts, run);
+  const auto n = static_cast<std::size_t>(matrix.rows);
+  constexpr std::size_t kPlaced = std::numeric_limits<std::size_t>::max();
+
+  std::vector<Index> perm(n);
+  std::vector<std::size_t> label(n, 0);
+  std::vector<std::size_t> mark(n, 0);
+  std::vector<Subgraph<Index>> current(1);
+  current[0].vertices.resize(n);
+  std::iota(current[0].vertices.begin(), current[0].vertices.end(), Index{0});
+
+  while (!current.empty()) {
+    // Fewer subgraphs than parts are cut one after another, each search expanding its levels in parallel
+    std::vector<std::array<Subgraph<Index>, 2>> halves(current.size());
+    const auto bisect = [&](std::size_t s, std::size_t search_parts) {
+      Bisect(graph, s, current, halves, label, mark, perm, static_cast<std::size_t>(leaf_size), search_parts, run);
+    };
+    if (current.size() < parts) {
+      for (std::size_t s = 0; s < current.size(); ++s) {
+        bisect(s, parts);
+      }
+    } else {
+      const std::size_t used = UsefulParts(parts, current.size());
+      run(used, [&](std::size_t p) {
+        for (std::size_t s = EvenSplit(current.size(), used, p); s < EvenSplit(current.size(), used, p + 1); ++s) {
+          bisect(s, 1);
+        }
+      });
+    }
+
+    std::vector<Subgraph<Index>> next;
+    for (const Subgraph<Index>& subgraph : current) {
+      for (const Index v : subgraph.vertices) {
+        label[v] = kPlaced;
+      }
+    }
+    for (auto& pair : halves) {
+      for (Subgraph<Index>& half : pair) {
+        if (half.vertices.empty()) {
+          continue;
+        }
+        for (const Index v : half.vertices) {
+          label[v] = next.size();
+        }
+        next.push_back(std::move(half));
+      }
+    }
+    current = std::move(next);
+  }
+  return perm;
+}
+
+template <typename Value, typename Index>
+std::vector<Index> ppc::core::ComputeOrdering(const CsrMatrix<Value, Index>& matrix, SparseOrdering ordering,
+                                              std::size_t parts, const PartRunner& run) {
+  switch (ordering) {
+    case SparseOrdering::kReverseCuthillMcKee:
+      return ReverseCuthillMcKee(matrix, parts, run);
+    case SparseOrdering::kNestedDissection:
+      return NestedDissection(matrix, Index{64}, parts, run);
+    case SparseOrdering::kNatural:
+      break;
+  }
+  RequireSquare(matrix);
+  std::vector<Index> perm(static_cast<std::size_t>(matrix.rows));
+  std::iota(perm.begin(), perm.end(), Index{0});
+  return perm;
+}
+
+template std::vector<int> ppc::core::InvertPermutation<int>(const std::vector<int>&);
+template std::vector<std::int64_t> ppc::core::InvertPermutation<std::int64_t>(const std::vector<std::int64_t>&);
+template ppc::core::BandProfile ppc::core::MeasureBandProfile<double>(
+    const CsrMatrix<double>&, std::size_t, const PartRunner&);
+template ppc::core::CsrMatrix<double> ppc::core::Permute<double>(const CsrMatrix<double>&, const std::vector<int>&,
+                                                                 const std::vector<int>&, std::size_t,
+                                                                 const PartRunner&);
+template std::vector<int> ppc::core::ReverseCuthillMcKee<double>(const CsrMatrix<double>&, std::size_t,
+                                                                 const PartRunner&);
+template std::vector<int> ppc::core::NestedDissection<double>(const CsrMatrix<double>&, int, std::size_t,
+                                                              const PartRunner&);
+template std::vector<int> ppc::core::ComputeOrdering<double>(const CsrMatrix<double>&, SparseOrdering, std::size_t,
+                                                             const PartRunner&);
+template ppc::core::BandProfile ppc::core::MeasureBandProfile<float>(const CsrMatrix<float>&, std::size_t,
+                                                                     const PartRunner&);
+template ppc::core::CsrMatrix<float> ppc::core::Permute<float>(const CsrMatrix<float>&, const std::vector<int>&,
+                                                               const std::vector<int>&, std::size_t, const PartRunner&);
+template std::vector<int> ppc::core::ReverseCuthillMcKee<float>(const CsrMatrix<float>&, std::size_t,
+                                                                const PartRunner&);
+template std::vector<int> ppc::core::NestedDissection<float>(const CsrMatrix<float>&, int, std::size_t,
+                                                             const PartRunner&);
+template std::vector<int> ppc::core::ComputeOrdering<float>(const CsrMatrix<float>&, SparseOrdering, std::size_t,
+                                                            const PartRunner&);
+template ppc::core::BandProfile ppc::core::MeasureBandProfile<std::complex<double>>(
+    const CsrMatrix<std::complex<double>>&, std::size_t, const PartRunner&);
+template ppc::core::CsrMatrix<std::complex<double>> ppc::core::Permute<std::complex<double>>(
+    const CsrMatrix<std::complex<double>>&, const std::vector<int>&, const std::vector<int>&, std::size_t,
+    const PartRunner&);
+template std::vector<int> ppc::core::ReverseCuthillMcKee<std::complex<double>>(
+    const CsrMatrix<std::complex<double>>&, std::size_t, const PartRunner&);
+template std::vector<int> ppc::core::NestedDissection<std::complex<double>>(
+    const CsrMatrix<std::complex<double>>&, int, std::size_t, const PartRunner&);
+template std::vector<int> ppc::core::ComputeOrdering<std::complex<double>>(
+    const CsrMatrix<std::complex<double>>&, SparseOrdering, std::size_t, const PartRunner&);
+template ppc::core::BandProfile ppc::core::MeasureBandProfile<double, std::int64_t>(
+    const CsrMatrix<double, std::int64_t>&, std::size_t, const PartRunner&);
+template ppc::core::CsrMatrix<double, std::int64_t> ppc::core::Permute<double, std::int64_t>(
+    const CsrMatrix<double, std::int64_t>&, const std::vector<std::int64_t>&, const std::vector<std::int64_t>&,
+    std::size_t, const PartRunner&);
+template std::vector<std::int64_t> ppc::core::ReverseCuthillMcKee<double, std::int64_t>(
+    const CsrMatrix<double, std::int64_t>&, std::size_t, const PartRunner&);
+template std::vector<std::int64_t> ppc::core::NestedDissection<double, std::int64_t>(
+    const CsrMatrix<double, std::int64_t>&, std::int64_t, std::size_t, const PartRunner&);
+template std::vector<std::int64_t> ppc::core::ComputeOrdering<double, std::int64_t>(
+    const CsrMatrix<double, std::int64_t>&, SparseOrdering, std::size_t, const PartRunner&);
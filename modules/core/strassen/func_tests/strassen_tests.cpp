@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/strassen/include/strassen.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(std::size_t size, std::mt19937& gen) {
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> matrix(size);
+  for (auto& value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> ReferenceProduct(std::size_t m, std::size_t n, std::size_t k, const std::vector<double>& a,
+                                     std::size_t lda, const std::vector<double>& b, std::size_t ldb) {
+  std::vector<double> c(m * n, 0.0);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+    }
+  }
+  return c;
+}
+
+void CheckProduct(std::size_t m, std::size_t n, const std::vector<double>& c, std::size_t ldc,
+                  const std::vector<double>& expected, double guard, double tolerance) {
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < ldc; ++j) {
+      if (j < n) {
+        ASSERT_NEAR(c[(i * ldc) + j], expected[(i * n) + j], tolerance) << i << ' ' << j;
+      } else {
+        ASSERT_EQ(c[(i * ldc) + j], guard);
+      }
+    }
+  }
+}
+
+// Runs on views with leading dimensions wider than the matrices and a workspace of exactly the advertised size,
+// so that any stray write beyond it lands in the guard values behind it.
+void CheckStrassen(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff) {
+  std::mt19937 gen(static_cast<unsigned>((m * 13) + (n * 7) + k + cutoff));
+  const std::size_t lda = k + 3;
+  const std::size_t ldb = n + 1;
+  const std::size_t ldc = n + 5;
+  const std::vector<double> a = RandomMatrix(m * lda, gen);
+  const std::vector<double> b = RandomMatrix(k * ldb, gen);
+  const std::vector<double> expected = ReferenceProduct(m, n, k, a, lda, b, ldb);
+  const double guard = 12345.0;
+  const double tolerance = 1e-9 * static_cast<double>(k);
+
+  std::vector<double> c(m * ldc, guard);
+  const std::size_t workspace_size = ppc::core::StrassenWorkspaceSize(m, n, k, cutoff);
+  std::vector<double> workspace(workspace_size + 16, guard);
+  ppc::core::Strassen(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc, workspace.data(), cutoff);
+  CheckProduct(m, n, c, ldc, expected, guard, tolerance);
+  for (std::size_t i = workspace_size; i < workspace.size(); ++i) {
+    ASSERT_EQ(workspace[i], guard);
+  }
+
+  std::ranges::fill(c, guard);
+  std::ranges::fill(workspace, guard);
+  ppc::core::StrassenWinograd(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc, workspace.data(), cutoff);
+  CheckProduct(m, n, c, ldc, expected, guard, tolerance);
+  for (std::size_t i = workspace_size; i < workspace.size(); ++i) {
+    ASSERT_EQ(workspace[i], guard);
+  }
+
+  // Products run in reverse order, so a product reading memory written by a later one would show up
+  const ppc::core::StrassenProductRunner run_backwards = [](const std::function<void(std::size_t)>& product) {
+    for (std::size_t p = ppc::core::kStrassenProducts; p > 0; --p) {
+      product(p - 1);
+    }
+  };
+  for (std::size_t depth = 1; depth <= 2; ++depth) {
+    const std::size_t parallel_size = ppc::core::StrassenWinogradParallelWorkspaceSize(m, n, k, cutoff, depth);
+    std::vector<double> parallel_workspace(parallel_size + 16, guard);
+    std::ranges::fill(c, guard);
+    ppc::core::StrassenWinogradParallel(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc,
+                                        parallel_workspace.data(), cutoff, depth, run_backwards);
+    CheckProduct(m, n, c, ldc, expected, guard, tolerance);
+    for (std::size_t i = parallel_size; i < parallel_workspace.size(); ++i) {
+      ASSERT_EQ(parallel_workspace[i], guard);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, workspace_is_about_two_thirds_of_n_squared) {
+  EXPECT_EQ(ppc::core::StrassenWorkspaceSize(16, 16, 16, 16), 0U);
+  EXPECT_EQ(ppc::core::StrassenWorkspaceSize(64, 64, 64, 16), (2U * 32 * 32) + (2U * 16 * 16));
+  EXPECT_LE(ppc::core::StrassenWorkspaceSize(1024, 1024, 1024, 1), 2U * 1024 * 1024 / 3);
+  EXPECT_LE(ppc::core::StrassenWorkspaceSize(1025, 1025, 1025, 1), 2U * 1025 * 1025 / 3);
+}
+
+TEST(strassen_tests, below_cutoff_uses_gemm) { CheckStrassen(24, 24, 24, 32); }
+
+TEST(strassen_tests, one_level) { CheckStrassen(64, 64, 64, 32); }
+
+TEST(strassen_tests, recursion_down_to_single_elements) { CheckStrassen(32, 32, 32, 1); }
+
+TEST(strassen_tests, several_levels) { CheckStrassen(256, 256, 256, 16); }
+
+TEST(strassen_tests, odd_sizes_are_peeled_at_every_level) { CheckStrassen(37, 37, 37, 2); }
+
+TEST(strassen_tests, one_past_a_power_of_two) { CheckStrassen(129, 129, 129, 16); }
+
+TEST(strassen_tests, rectangular) { CheckStrassen(45, 70, 33, 4); }
+
+TEST(strassen_tests, rectangular_odd_in_one_dimension_only) {
+  CheckStrassen(64, 64, 65, 8);
+  CheckStrassen(64, 65, 64, 8);
+  CheckStrassen(65, 64, 64, 8);
+}
+
+TEST(strassen_tests, thin_product_uses_gemm) { CheckStrassen(200, 3, 150, 16); }
+
+TEST(strassen_tests, parallel_depth_covers_threads) {
+  EXPECT_EQ(ppc::core::StrassenParallelDepth(1), 0U);
+  EXPECT_EQ(ppc::core::StrassenParallelDepth(2), 1U);
+  EXPECT_EQ(ppc::core::StrassenParallelDepth(7), 1U);
+  EXPECT_EQ(ppc::core::StrassenParallelDepth(8), 2U);
+}
+
+TEST(strassen_tests, tuned_cutoff_is_stable) {
+  const std::size_t cutoff = ppc::core::StrassenWinogradCutoff();
+  EXPECT_GE(cutoff, 32U);
+  EXPECT_LE(cutoff, 256U);
+  EXPECT_EQ(ppc::core::StrassenWinogradCutoff(), cutoff);
+}
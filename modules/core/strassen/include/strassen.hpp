@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ppc::core {
+
+// Number of independent products in one Strassen step.
+constexpr std::size_t kStrassenProducts = 7;
+
+// Whether an m x k by k x n product is split into Strassen products at all. If not, the routines below need no
+// workspace and multiply with Gemm.
+bool StrassenSplits(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff);
+
+// Doubles of scratch memory Strassen needs for an m x k by k x n product: two half-size temporaries per recursion
+// level, about 2n^2/3 in total for square matrices.
+std::size_t StrassenWorkspaceSize(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff);
+
+// C = A * B for an m x k matrix A and a k x n matrix B, all row-major with leading dimensions lda, ldb and ldc.
+// Quadrants are addressed in place and every temporary lives in `workspace`, so the recursion neither allocates
+// nor copies quadrants out. Odd dimensions are peeled: the even part goes through the Strassen step and the last
+// row, column and inner index are added with Gemm, so no size is padded. Products with a dimension not above
+// `cutoff` are multiplied by Gemm. C must not overlap A, B or the workspace.
+void Strassen(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+              std::size_t ldb, double* c, std::size_t ldc, double* workspace, std::size_t cutoff);
+
+// Strassen-Winograd: the same seven products arranged so that a step takes 15 matrix additions instead of 18.
+// Needs no more than StrassenWorkspaceSize(m, n, k, cutoff) doubles of workspace.
+void StrassenWinograd(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+                      std::size_t ldb, double* c, std::size_t ldc, double* workspace, std::size_t cutoff);
+
+// Calls product(0) .. product(kStrassenProducts - 1), possibly concurrently, and returns once all of them are done.
+using StrassenProductRunner = std::function<void(const std::function<void(std::size_t)>& product)>;
+
+// Recursion levels whose seven products are handed to the runner: the smallest depth with 7^depth >= num_threads.
+std::size_t StrassenParallelDepth(int num_threads);
+
+// Task-parallel Strassen-Winograd. The first `depth` levels compute their operand sums into a slice of the
+// workspace per product and pass the seven products to `run_products`; deeper levels run StrassenWinograd.
+// Each product owns its slice, so the runner may execute them on any threads, and nested levels call the runner
+// again from inside a product.
+std::size_t StrassenWinogradParallelWorkspaceSize(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff,
+                                                  std::size_t depth);
+void StrassenWinogradParallel(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda,
+                              const double* b, std::size_t ldb, double* c, std::size_t ldc, double* workspace,
+                              std::size_t cutoff, std::size_t depth, const StrassenProductRunner& run_products);
+
+// Leaf size for StrassenWinograd on this machine: the largest size at which one step over Gemm is still not faster
+// than Gemm alone. Measured on the first call on a machine and kept in the tuning file (see core/tuning).
+std::size_t StrassenWinogradCutoff();
+
+}  // namespace ppc::core
@@ -0,0 +1,350 @@
+#include "core/strassen/include/strassen.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/tuning/include/tuning.hpp"
+
+namespace {
+
+// z = x + y and z = x - y for rows x cols views
+void Add(std::size_t rows, std::size_t cols, const double* x, std::size_t ldx, const double* y, std::size_t ldy,
+         double* z, std::size_t ldz) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      z[(i * ldz) + j] = x[(i * ldx) + j] + y[(i * ldy) + j];
+    }
+  }
+}
+
+void Sub(std::size_t rows, std::size_t cols, const double* x, std::size_t ldx, const double* y, std::size_t ldy,
+         double* z, std::size_t ldz) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      z[(i * ldz) + j] = x[(i * ldx) + j] - y[(i * ldy) + j];
+    }
+  }
+}
+
+// z += x and z -= x for rows x cols views
+void AddTo(std::size_t rows, std::size_t cols, const double* x, std::size_t ldx, double* z, std::size_t ldz) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      z[(i * ldz) + j] += x[(i * ldx) + j];
+    }
+  }
+}
+
+void SubFrom(std::size_t rows, std::size_t cols, const double* x, std::size_t ldx, double* z, std::size_t ldz) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      z[(i * ldz) + j] -= x[(i * ldx) + j];
+    }
+  }
+}
+
+void Multiply(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+              std::size_t ldb, double* c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; ++i) {
+    std::fill(c + (i * ldc), c + (i * ldc) + n, 0.0);
+  }
+  ppc::core::Gemm(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// Quadrant views of the even part of a matrix whose quadrants are rows x cols
+template <typename T>
+struct Quadrants {
+  T* q11;
+  T* q12;
+  T* q21;
+  T* q22;
+};
+
+template <typename T>
+Quadrants<T> Split(T* x, std::size_t ld, std::size_t rows, std::size_t cols) {
+  return {.q11 = x, .q12 = x + cols, .q21 = x + (rows * ld), .q22 = x + (rows * ld) + cols};
+}
+
+// Completes C = A * B after the even part (2 mh) x (2 nh) x (2 kh) has been multiplied: adds the last inner index
+// if k is odd and computes the last column and row of C if n or m are odd.
+void PeelEdges(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda, const double* b,
+               std::size_t ldb, double* c, std::size_t ldc) {
+  const std::size_t me = m - (m % 2);
+  const std::size_t ne = n - (n % 2);
+  const std::size_t ke = k - (k % 2);
+  if (ke < k) {
+    ppc::core::Gemm(me, ne, k - ke, a + ke, lda, b + (ke * ldb), ldb, c, ldc);
+  }
+  if (ne < n) {
+    Multiply(me, n - ne, k, a, lda, b + ne, ldb, c + ne, ldc);
+  }
+  if (me < m) {
+    Multiply(m - me, n, k, a + (me * lda), lda, b, ldb, c + (me * ldc), ldc);
+  }
+}
+
+std::size_t ParallelSlotSize(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff, std::size_t depth) {
+  const std::size_t mh = m / 2;
+  const std::size_t nh = n / 2;
+  const std::size_t kh = k / 2;
+  return (mh * nh) + (mh * kh) + (kh * nh) +
+         ppc::core::StrassenWinogradParallelWorkspaceSize(mh, nh, kh, cutoff, depth - 1);
+}
+
+template <typename F>
+double BestSeconds(F&& run) {
+  double best = std::numeric_limits<double>::max();
+  for (int rep = 0; rep < 3; ++rep) {
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+// Times Gemm against one Winograd step for doubling sizes and stops at the first size where the step wins.
+std::size_t TuneWinogradCutoff() {
+  constexpr std::size_t kMinSize = 64;
+  constexpr std::size_t kMaxSize = 256;
+  const std::vector<double> a(kMaxSize * kMaxSize, 1.0);
+  const std::vector<double> b(kMaxSize * kMaxSize, 0.5);
+  std::vector<double> c(kMaxSize * kMaxSize);
+  std::vector<double> workspace(ppc::core::StrassenWorkspaceSize(kMaxSize, kMaxSize, kMaxSize, kMaxSize / 2));
+  for (std::size_t n = kMinSize; n <= kMaxSize; n *= 2) {
+    const double gemm = BestSeconds([&] { Multiply(n, n, n, a.data(), n, b.data(), n, c.data(), n); });
+    const double winograd = BestSeconds([&] {
+      ppc::core::StrassenWinograd(n, n, n, a.data(), n, b.data(), n, c.data(), n, workspace.data(), n / 2);
+    });
+    if (winograd < gemm) {
+      return n / 2;
+    }
+  }
+  return kMaxSize;
+}
+
+}  // namespace
+
+bool ppc::core::StrassenSplits(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff) {
+  return std::min({m, n, k}) > cutoff;
+}
+
+std::size_t ppc::core::StrassenWorkspaceSize(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff) {
+  std::size_t size = 0;
+  while (StrassenSplits(m, n, k, cutoff)) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    size += (m * std::max(k, n)) + (std::max(k, m) * n);
+  }
+  return size;
+}
+
+// The seven products are written into the quadrants of C or the two temporaries and accumulated there, so that
+// besides C only X (for sums of A quadrants) and Y (for sums of B quadrants) are needed:
+//   M7 = (A12 - A22)(B21 + B22) -> C11      M6 = (A21 - A11)(B11 + B12) -> C22
+//   M1 = (A11 + A22)(B11 + B22) -> C12      C11 += M1, C22 += M1
+//   M2 = (A21 + A22) B11        -> C21      C22 -= M2
+//   M4 = A22 (B21 - B11)        -> X        C11 += M4, C21 += M4
+//   M3 = A11 (B12 - B22)        -> C12      C22 += M3
+//   M5 = (A11 + A12) B22        -> Y        C11 -= M5, C12 += M5
+void ppc::core::Strassen(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda,
+                         const double* b, std::size_t ldb, double* c, std::size_t ldc, double* workspace,
+                         std::size_t cutoff) {
+  if (!StrassenSplits(m, n, k, cutoff)) {
+    Multiply(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const std::size_t mh = m / 2;
+  const std::size_t nh = n / 2;
+  const std::size_t kh = k / 2;
+  const auto qa = Split(a, lda, mh, kh);
+  const auto qb = Split(b, ldb, kh, nh);
+  const auto qc = Split(c, ldc, mh, nh);
+  double* x = workspace;
+  double* y = x + (mh * std::max(kh, nh));
+  double* rest = y + (std::max(kh, mh) * nh);
+
+  Sub(mh, kh, qa.q12, lda, qa.q22, lda, x, kh);
+  Add(kh, nh, qb.q21, ldb, qb.q22, ldb, y, nh);
+  Strassen(mh, nh, kh, x, kh, y, nh, qc.q11, ldc, rest, cutoff);
+
+  Sub(mh, kh, qa.q21, lda, qa.q11, lda, x, kh);
+  Add(kh, nh, qb.q11, ldb, qb.q12, ldb, y, nh);
+  Strassen(mh, nh, kh, x, kh, y, nh, qc.q22, ldc, rest, cutoff);
+
+  Add(mh, kh, qa.q11, lda, qa.q22, lda, x, kh);
+  Add(kh, nh, qb.q11, ldb, qb.q22, ldb, y, nh);
+  Strassen(mh, nh, kh, x, kh, y, nh, qc.q12, ldc, rest, cutoff);
+  AddTo(mh, nh, qc.q12, ldc, qc.q11, ldc);
+  AddTo(mh, nh, qc.q12, ldc, qc.q22, ldc);
+
+  Add(mh, kh, qa.q21, lda, qa.q22, lda, x, kh);
+  Strassen(mh, nh, kh, x, kh, qb.q11, ldb, qc.q21, ldc, rest, cutoff);
+  SubFrom(mh, nh, qc.q21, ldc, qc.q22, ldc);
+
+  Sub(kh, nh, qb.q21, ldb, qb.q11, ldb, y, nh);
+  Strassen(mh, nh, kh, qa.q22, lda, y, nh, x, nh, rest, cutoff);
+  AddTo(mh, nh, x, nh, qc.q11, ldc);
+  AddTo(mh, nh, x, nh, qc.q21, ldc);
+
+  Sub(kh, nh, qb.q12, ldb, qb.q22, ldb, y, nh);
+  Strassen(mh, nh, kh, qa.q11, lda, y, nh, qc.q12, ldc, rest, cutoff);
+  AddTo(mh, nh, qc.q12, ldc, qc.q22, ldc);
+
+  Add(mh, kh, qa.q11, lda, qa.q12, lda, x, kh);
+  Strassen(mh, nh, kh, x, kh, qb.q22, ldb, y, nh, rest, cutoff);
+  SubFrom(mh, nh, y, nh, qc.q11, ldc);
+  AddTo(mh, nh, y, nh, qc.q12, ldc);
+
+  PeelEdges(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+// Operand sums and products are placed so that only X (for sums of A quadrants and P1) and Y (for sums of B
+// quadrants) are needed besides C:
+//   S3 = A11 - A21 -> X,  T3 = B22 - B12 -> Y,  P7 = S3 T3 -> C21
+//   S1 = A21 + A22 -> X,  T1 = B12 - B11 -> Y,  P5 = S1 T1 -> C22
+//   S2 = S1 - A11  -> X,  T2 = B22 - T1  -> Y,  P6 = S2 T2 -> C12
+//   S4 = A12 - S2  -> X,  P3 = S4 B22 -> C11,   P1 = A11 B11 -> X
+//   C12 = P1 + P6, C21 = C12 + P7, C12 += P5, C22 += C21, C12 += P3
+//   T4 = T2 - B21  -> Y,  P4 = A22 T4 -> C11,   C21 -= P4
+//   P2 = A12 B21 -> C11,  C11 += P1
+void ppc::core::StrassenWinograd(std::size_t m, std::size_t n, std::size_t k, const double* a, std::size_t lda,
+                                 const double* b, std::size_t ldb, double* c, std::size_t ldc, double* workspace,
+                                 std::size_t cutoff) {
+  if (!StrassenSplits(m, n, k, cutoff)) {
+    Multiply(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const std::size_t mh = m / 2;
+  const std::size_t nh = n / 2;
+  const std::size_t kh = k / 2;
+  const auto qa = Split(a, lda, mh, kh);
+  const auto qb = Split(b, ldb, kh, nh);
+  const auto qc = Split(c, ldc, mh, nh);
+  double* x = workspace;
+  double* y = x + (mh * std::max(kh, nh));
+  double* rest = y + (std::max(kh, mh) * nh);
+
+  Sub(mh, kh, qa.q11, lda, qa.q21, lda, x, kh);
+  Sub(kh, nh, qb.q22, ldb, qb.q12, ldb, y, nh);
+  StrassenWinograd(mh, nh, kh, x, kh, y, nh, qc.q21, ldc, rest, cutoff);
+
+  Add(mh, kh, qa.q21, lda, qa.q22, lda, x, kh);
+  Sub(kh, nh, qb.q12, ldb, qb.q11, ldb, y, nh);
+  StrassenWinograd(mh, nh, kh, x, kh, y, nh, qc.q22, ldc, rest, cutoff);
+
+  Sub(mh, kh, x, kh, qa.q11, lda, x, kh);
+  Sub(kh, nh, qb.q22, ldb, y, nh, y, nh);
+  StrassenWinograd(mh, nh, kh, x, kh, y, nh, qc.q12, ldc, rest, cutoff);
+
+  Sub(mh, kh, qa.q12, lda, x, kh, x, kh);
+  StrassenWinograd(mh, nh, kh, x, kh, qb.q22, ldb, qc.q11, ldc, rest, cutoff);
+  StrassenWinograd(mh, nh, kh, qa.q11, lda, qb.q11, ldb, x, nh, rest, cutoff);
+
+  AddTo(mh, nh, x, nh, qc.q12, ldc);
+  AddTo(mh, nh, qc.q12, ldc, qc.q21, ldc);
+  AddTo(mh, nh, qc.q22, ldc, qc.q12, ldc);
+  AddTo(mh, nh, qc.q21, ldc, qc.q22, ldc);
+  AddTo(mh, nh, qc.q11, ldc, qc.q12, ldc);
+
+  Sub(kh, nh, y, nh, qb.q21, ldb, y, nh);
+  StrassenWinograd(mh, nh, kh, qa.q22, lda, y, nh, qc.q11, ldc, rest, cutoff);
+  SubFrom(mh, nh, qc.q11, ldc, qc.q21, ldc);
+
+  StrassenWinograd(mh, nh, kh, qa.q12, lda, qb.q21, ldb, qc.q11, ldc, rest, cutoff);
+  AddTo(mh, nh, x, nh, qc.q11, ldc);
+
+  PeelEdges(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+std::size_t ppc::core::StrassenParallelDepth(int num_threads) {
+  std::size_t depth = 0;
+  for (int tasks = 1; tasks < num_threads; tasks *= static_cast<int>(kStrassenProducts)) {
+    ++depth;
+  }
+  return depth;
+}
+
+std::size_t ppc::core::StrassenWinogradParallelWorkspaceSize(std::size_t m, std::size_t n, std::size_t k,
+                                                             std::size_t cutoff, std::size_t depth) {
+  if (depth == 0 || !StrassenSplits(m, n, k, cutoff)) {
+    return StrassenWorkspaceSize(m, n, k, cutoff);
+  }
+  return kStrassenProducts * ParallelSlotSize(m, n, k, cutoff, depth);
+}
+
+// Slot layout per product: the product P, the operand sums S and T, then the workspace of its recursion. The
+// eight operand sums are formed up front as in StrassenWinograd, so the products only read them, and the seven
+// output sums become one pass over C:
+//   C11 = P1 + P2, C12 = P1 + P6 + P5 + P3, C21 = P1 + P6 + P7 - P4, C22 = P1 + P6 + P7 + P5
+void ppc::core::StrassenWinogradParallel(std::size_t m, std::size_t n, std::size_t k, const double* a,
+                                         std::size_t lda, const double* b, std::size_t ldb, double* c,
+                                         std::size_t ldc, double* workspace, std::size_t cutoff, std::size_t depth,
+                                         const StrassenProductRunner& run_products) {
+  if (depth == 0 || !StrassenSplits(m, n, k, cutoff)) {
+    StrassenWinograd(m, n, k, a, lda, b, ldb, c, ldc, workspace, cutoff);
+    return;
+  }
+  const std::size_t mh = m / 2;
+  const std::size_t nh = n / 2;
+  const std::size_t kh = k / 2;
+  const auto qa = Split(a, lda, mh, kh);
+  const auto qb = Split(b, ldb, kh, nh);
+  const auto qc = Split(c, ldc, mh, nh);
+  const std::size_t slot = ParallelSlotSize(m, n, k, cutoff, depth);
+  const auto product = [&](std::size_t i) { return workspace + (i * slot); };
+  const auto s = [&](std::size_t i) { return product(i) + (mh * nh); };
+  const auto t = [&](std::size_t i) { return s(i) + (mh * kh); };
+
+  Add(mh, kh, qa.q21, lda, qa.q22, lda, s(4), kh);
+  Sub(mh, kh, s(4), kh, qa.q11, lda, s(5), kh);
+  Sub(mh, kh, qa.q11, lda, qa.q21, lda, s(6), kh);
+  Sub(mh, kh, qa.q12, lda, s(5), kh, s(2), kh);
+  Sub(kh, nh, qb.q12, ldb, qb.q11, ldb, t(4), nh);
+  Sub(kh, nh, qb.q22, ldb, t(4), nh, t(5), nh);
+  Sub(kh, nh, qb.q22, ldb, qb.q12, ldb, t(6), nh);
+  Sub(kh, nh, t(5), nh, qb.q21, ldb, t(3), nh);
+
+  struct Operands {
+    const double* a;
+    std::size_t lda;
+    const double* b;
+    std::size_t ldb;
+  };
+  const std::array<Operands, kStrassenProducts> operands = {{{qa.q11, lda, qb.q11, ldb},
+                                                             {qa.q12, lda, qb.q21, ldb},
+                                                             {s(2), kh, qb.q22, ldb},
+                                                             {qa.q22, lda, t(3), nh},
+                                                             {s(4), kh, t(4), nh},
+                                                             {s(5), kh, t(5), nh},
+                                                             {s(6), kh, t(6), nh}}};
+  run_products([&](std::size_t i) {
+    StrassenWinogradParallel(mh, nh, kh, operands[i].a, operands[i].lda, operands[i].b, operands[i].ldb, product(i),
+                             nh, t(i) + (kh * nh), cutoff, depth - 1, run_products);
+  });
+
+  std::array<const double*, kStrassenProducts> p{};
+  for (std::size_t i = 0; i < kStrassenProducts; ++i) {
+    p[i] = product(i);
+  }
+  for (std::size_t i = 0; i < mh; ++i) {
+    for (std::size_t j = 0; j < nh; ++j) {
+      const std::size_t u = (i * nh) + j;
+      const std::size_t v = (i * ldc) + j;
+      const double u2 = p[0][u] + p[5][u];
+      const double u3 = u2 + p[6][u];
+      qc.q11[v] = p[0][u] + p[1][u];
+      qc.q12[v] = u2 + p[4][u] + p[2][u];
+      qc.q21[v] = u3 - p[3][u];
+      qc.q22[v] = u3 + p[4][u];
+    }
+  }
+  PeelEdges(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+std::size_t ppc::core::StrassenWinogradCutoff() { return TunedValue("strassen_winograd_cutoff", TuneWinogradCutoff); }
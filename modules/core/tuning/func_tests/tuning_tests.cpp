@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#include "core/tuning/include/tuning.hpp"
+
+namespace {
+
+class ScratchDir {
+ public:
+  explicit ScratchDir(const std::string& name) : path_(std::filesystem::temp_directory_path() / name) {
+    std::filesystem::remove_all(path_);
+    std::filesystem::create_directories(path_);
+  }
+  ScratchDir(const ScratchDir&) = delete;
+  ScratchDir& operator=(const ScratchDir&) = delete;
+  ~ScratchDir() {
+    std::error_code error;
+    std::filesystem::remove_all(path_, error);
+  }
+
+  [[nodiscard]] const std::filesystem::path& Path() const { return path_; }
+
+ private:
+  std::filesystem::path path_;
+};
+
+void WriteCacheIndex(const std::filesystem::path& dir, const std::string& index, const std::string& level,
+                     const std::string& type, const std::string& size) {
+  const std::filesystem::path path = dir / index;
+  std::filesystem::create_directories(path);
+  std::ofstream(path / "level") << level << '\n';
+  std::ofstream(path / "type") << type << '\n';
+  std::ofstream(path / "size") << size << '\n';
+}
+
+}  // namespace
+
+TEST(tuning_tests, reads_data_and_unified_caches_from_sysfs_layout) {
+  const ScratchDir dir("ppc_tuning_tests_sysfs");
+  WriteCacheIndex(dir.Path(), "index0", "1", "Data", "48K");
+  WriteCacheIndex(dir.Path(), "index1", "1", "Instruction", "32K");
+  WriteCacheIndex(dir.Path(), "index2", "2", "Unified", "2048K");
+  WriteCacheIndex(dir.Path(), "index3", "3", "Unified", "30M");
+
+  const ppc::core::CacheSizes caches = ppc::core::ReadCacheSizes(dir.Path());
+  EXPECT_EQ(caches.l1d, 48U << 10);
+  EXPECT_EQ(caches.l2, 2048U << 10);
+  EXPECT_EQ(caches.l3, 30U << 20);
+}
+
+TEST(tuning_tests, missing_sysfs_keeps_defaults) {
+  EXPECT_EQ(ppc::core::ReadCacheSizes("/nonexistent/ppc/cache"), ppc::core::CacheSizes{});
+}
+
+TEST(tuning_tests, tuned_value_is_measured_once_and_persisted) {
+  const ScratchDir dir("ppc_tuning_tests_file");
+  const std::filesystem::path file = dir.Path() / "tuning.txt";
+  const ppc::core::CacheSizes caches{};
+  int measured = 0;
+  const auto measure = [&measured] {
+    ++measured;
+    return std::size_t{96};
+  };
+
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", measure), 96U);
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", measure), 96U);
+  EXPECT_EQ(measured, 1);
+
+  // Other keys are kept next to it
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "cutoff", [] { return std::size_t{128}; }), 128U);
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", measure), 96U);
+  EXPECT_EQ(measured, 1);
+}
+
+TEST(tuning_tests, file_from_other_caches_is_retuned) {
+  const ScratchDir dir("ppc_tuning_tests_other_cpu");
+  const std::filesystem::path file = dir.Path() / "tuning.txt";
+  ppc::core::CacheSizes caches{};
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", [] { return std::size_t{64}; }), 64U);
+
+  caches.l2 *= 2;
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", [] { return std::size_t{128}; }), 128U);
+  EXPECT_EQ(ppc::core::LoadOrTune(file, caches, "block", [] { return std::size_t{0}; }), 128U);
+}
+
+TEST(tuning_tests, block_candidates_span_l1_to_l2) {
+  const ppc::core::CacheSizes caches{.l1d = std::size_t{48} << 10, .l2 = std::size_t{2} << 20, .l3 = 0};
+  const auto candidates = ppc::core::BlockSizeCandidates(caches);
+  ASSERT_FALSE(candidates.empty());
+  EXPECT_EQ(candidates.front(), 32U);
+  EXPECT_EQ(candidates.back(), 288U);
+  for (const std::size_t block : candidates) {
+    EXPECT_EQ(block % 16, 0U);
+    EXPECT_LE(3 * block * block * sizeof(double), caches.l2);
+  }
+}
+
+TEST(tuning_tests, tuned_block_size_is_a_candidate) {
+  const auto candidates = ppc::core::BlockSizeCandidates(ppc::core::HostCacheSizes());
+  const std::size_t block = ppc::core::TunedMatrixBlockSize();
+  EXPECT_NE(std::ranges::find(candidates, block), candidates.end());
+  EXPECT_EQ(ppc::core::TunedMatrixBlockSize(), block);
+}
+
+TEST(tuning_tests, nearest_divisor) {
+  EXPECT_EQ(ppc::core::NearestDivisor(1, 64), 1U);
+  EXPECT_EQ(ppc::core::NearestDivisor(900, 96), 100U);
+  EXPECT_EQ(ppc::core::NearestDivisor(1024, 96), 128U);
+  EXPECT_EQ(ppc::core::NearestDivisor(97, 96), 97U);
+  EXPECT_EQ(ppc::core::NearestDivisor(12, 5), 6U);
+  EXPECT_EQ(ppc::core::NearestDivisor(16, 100), 16U);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace ppc::core {
+
+// Data cache sizes in bytes. Levels the system does not report keep these defaults.
+struct CacheSizes {
+  std::size_t l1d = std::size_t{32} << 10;
+  std::size_t l2 = std::size_t{1} << 20;
+  std::size_t l3 = std::size_t{8} << 20;
+
+  bool operator==(const CacheSizes&) const = default;
+};
+
+// Reads the data and unified caches listed in a sysfs cache directory such as /sys/devices/system/cpu/cpu0/cache.
+CacheSizes ReadCacheSizes(const std::filesystem::path& cache_dir);
+
+// Caches of the CPU the process runs on; read once.
+const CacheSizes& HostCacheSizes();
+
+// Where tuned values are kept: $PPC_TUNING_FILE if set, otherwise ppc_tuning.txt in the temporary directory.
+std::filesystem::path TuningFilePath();
+
+// Returns `key` from the tuning file if the file was written on a machine with the same caches. Otherwise calls
+// `measure`, stores its result under `key` and returns it. The file is replaced atomically, so concurrent
+// processes tuning at the same time at worst measure twice.
+std::size_t LoadOrTune(const std::filesystem::path& file, const CacheSizes& caches, std::string_view key,
+                       const std::function<std::size_t()>& measure);
+
+// LoadOrTune on TuningFilePath() for the host caches, remembered for the rest of the process.
+std::size_t TunedValue(std::string_view key, const std::function<std::size_t()>& measure);
+
+// Square block sides worth trying for blocked matrix products: multiples of 16 from the size whose three blocks
+// fill L1 up to the size whose three blocks fill L2.
+std::vector<std::size_t> BlockSizeCandidates(const CacheSizes& caches);
+
+// Block side for blocked matrix products (Fox, Cannon) that ran fastest on this machine, picked among
+// BlockSizeCandidates by timing a blocked product and persisted in the tuning file.
+std::size_t TunedMatrixBlockSize();
+
+// The divisor of n closest to target; ties go to the larger divisor.
+std::size_t NearestDivisor(std::size_t n, std::size_t target);
+
+}  // namespace ppc::core
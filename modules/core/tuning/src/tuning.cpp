@@ -0,0 +1,242 @@
+#include "core/tuning/include/tuning.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+constexpr std::string_view kCachesKey = "caches";
+
+// Sizes in sysfs look like "48K", "2048K" or "32M".
+std::size_t ParseCacheSize(const std::string& text) {
+  std::size_t value = 0;
+  std::size_t pos = 0;
+  while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+    value = (value * 10) + static_cast<std::size_t>(text[pos] - '0');
+    ++pos;
+  }
+  if (pos < text.size()) {
+    switch (text[pos]) {
+      case 'K':
+        return value << 10;
+      case 'M':
+        return value << 20;
+      case 'G':
+        return value << 30;
+      default:
+        break;
+    }
+  }
+  return value;
+}
+
+std::string ReadFirstLine(const std::filesystem::path& path) {
+  std::ifstream in(path);
+  std::string line;
+  std::getline(in, line);
+  return line;
+}
+
+using TuningEntries = std::map<std::string, std::size_t, std::less<>>;
+
+// Entries of a tuning file, empty if it is missing or was written for other caches.
+TuningEntries ReadTuningFile(const std::filesystem::path& file, const ppc::core::CacheSizes& caches) {
+  TuningEntries entries;
+  std::ifstream in(file);
+  std::string key;
+  ppc::core::CacheSizes file_caches{.l1d = 0, .l2 = 0, .l3 = 0};
+  if (!(in >> key >> file_caches.l1d >> file_caches.l2 >> file_caches.l3) || key != kCachesKey ||
+      file_caches != caches) {
+    return entries;
+  }
+  std::size_t value = 0;
+  while (in >> key >> value) {
+    entries[key] = value;
+  }
+  return entries;
+}
+
+void WriteTuningFile(const std::filesystem::path& file, const ppc::core::CacheSizes& caches,
+                     const TuningEntries& entries) {
+  std::filesystem::path tmp = file;
+  tmp += ".tmp" + std::to_string(std::random_device{}());
+  {
+    std::ofstream out(tmp);
+    out << kCachesKey << ' ' << caches.l1d << ' ' << caches.l2 << ' ' << caches.l3 << '\n';
+    for (const auto& [key, value] : entries) {
+      out << key << ' ' << value << '\n';
+    }
+    if (!out) {
+      return;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(tmp, file, error);
+  if (error) {
+    std::filesystem::remove(tmp, error);
+  }
+}
+
+// C += A * B for n x n matrices, block by block as the Fox and Cannon tasks multiply.
+void BlockedProduct(std::size_t n, std::size_t block, const double* a, const double* b, double* c) {
+  for (std::size_t i = 0; i < n; i += block) {
+    for (std::size_t j = 0; j < n; j += block) {
+      for (std::size_t k = 0; k < n; k += block) {
+        ppc::core::Gemm(std::min(block, n - i), std::min(block, n - j), std::min(block, n - k), a + (i * n) + k, n,
+                        b + (k * n) + j, n, c + (i * n) + j, n);
+      }
+    }
+  }
+}
+
+std::size_t MeasureMatrixBlockSize() {
+  constexpr std::size_t kSize = 512;
+  const std::vector<double> a(kSize * kSize, 1.0);
+  const std::vector<double> b(kSize * kSize, 0.5);
+  std::vector<double> c(kSize * kSize);
+  std::size_t best_block = 0;
+  double best_seconds = std::numeric_limits<double>::max();
+  for (const std::size_t block : ppc::core::BlockSizeCandidates(ppc::core::HostCacheSizes())) {
+    for (int rep = 0; rep < 2; ++rep) {
+      const auto start = std::chrono::steady_clock::now();
+      BlockedProduct(kSize, block, a.data(), b.data(), c.data());
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      if (seconds < best_seconds) {
+        best_seconds = seconds;
+        best_block = block;
+      }
+    }
+  }
+  return best_block;
+}
+
+}  // namespace
+
+ppc::core::CacheSizes ppc::core::ReadCacheSizes(const std::filesystem::path& cache_dir) {
+  CacheSizes caches;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(cache_dir, error)) {
+    if (!entry.path().filename().string().starts_with("index")) {
+      continue;
+    }
+    const std::string type = ReadFirstLine(entry.path() / "type");
+    if (type != "Data" && type != "Unified") {
+      continue;
+    }
+    const std::size_t size = ParseCacheSize(ReadFirstLine(entry.path() / "size"));
+    if (size == 0) {
+      continue;
+    }
+    const std::string level = ReadFirstLine(entry.path() / "level");
+    if (level == "1") {
+      caches.l1d = size;
+    } else if (level == "2") {
+      caches.l2 = size;
+    } else if (level == "3") {
+      caches.l3 = size;
+    }
+  }
+  return caches;
+}
+
+const ppc::core::CacheSizes& ppc::core::HostCacheSizes() {
+  static const CacheSizes kCaches = ReadCacheSizes("/sys/devices/system/cpu/cpu0/cache");
+  return kCaches;
+}
+
+std::filesystem::path ppc::core::TuningFilePath() {
+#ifdef _WIN32
+  std::size_t len = 0;
+  std::array<char, 1024> path{};
+  if (getenv_s(&len, path.data(), path.size(), "PPC_TUNING_FILE") == 0 && len > 0 && path[0] != '\0') {
+    return path.data();
+  }
+#else
+  const char* path = std::getenv("PPC_TUNING_FILE");
+  if (path != nullptr && *path != '\0') {
+    return path;
+  }
+#endif
+  std::error_code error;
+  std::filesystem::path dir = std::filesystem::temp_directory_path(error);
+  if (error) {
+    dir = ".";
+  }
+  return dir / "ppc_tuning.txt";
+}
+
+std::size_t ppc::core::LoadOrTune(const std::filesystem::path& file, const CacheSizes& caches, std::string_view key,
+                                  const std::function<std::size_t()>& measure) {
+  const TuningEntries entries = ReadTuningFile(file, caches);
+  if (const auto it = entries.find(key); it != entries.end()) {
+    return it->second;
+  }
+  const std::size_t value = measure();
+  // Another process may have stored other keys in the meantime
+  TuningEntries updated = ReadTuningFile(file, caches);
+  updated[std::string(key)] = value;
+  WriteTuningFile(file, caches, updated);
+  return value;
+}
+
+std::size_t ppc::core::TunedValue(std::string_view key, const std::function<std::size_t()>& measure) {
+  static std::mutex mutex;
+  static TuningEntries values;
+  const std::lock_guard<std::mutex> lock(mutex);
+  if (const auto it = values.find(key); it != values.end()) {
+    return it->second;
+  }
+  const std::size_t value = LoadOrTune(TuningFilePath(), HostCacheSizes(), key, measure);
+  values[std::string(key)] = value;
+  return value;
+}
+
+std::vector<std::size_t> ppc::core::BlockSizeCandidates(const CacheSizes& caches) {
+  constexpr std::size_t kStep = 16;
+  const auto side = [](std::size_t bytes) {
+    return static_cast<std::size_t>(std::sqrt(static_cast<double>(bytes) / (3.0 * sizeof(double))));
+  };
+  const std::size_t first = std::max(kStep, side(caches.l1d) / kStep * kStep);
+  const std::size_t last = std::max(first, side(caches.l2) / kStep * kStep);
+  std::vector<std::size_t> candidates;
+  for (std::size_t block = first; block <= last; block += kStep) {
+    candidates.push_back(block);
+  }
+  return candidates;
+}
+
+std::size_t ppc::core::TunedMatrixBlockSize() { return TunedValue("matrix_block_size", MeasureMatrixBlockSize); }
+
+std::size_t ppc::core::NearestDivisor(std::size_t n, std::size_t target) {
+  std::size_t best = 1;
+  const auto distance = [target](std::size_t d) { return d > target ? d - target : target - d; };
+  for (std::size_t d = 1; d * d <= n; ++d) {
+    if (n % d != 0) {
+      continue;
+    }
+    for (const std::size_t divisor : {d, n / d}) {
+      if (distance(divisor) < distance(best) || (distance(divisor) == distance(best) && divisor > best)) {
+        best = divisor;
+      }
+    }
+  }
+  return best;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <omp.h>
+
+namespace ppc::util {
+
+// Lets `levels` parallel regions nest and returns the setting to restore; OpenMP 2.0, the /openmp of MSVC, only
+// switches nesting on or off.
+inline int AllowNestedRegions(int levels) {
+#if _OPENMP >= 200805
+  const int previous = omp_get_max_active_levels();
+  omp_set_max_active_levels(levels);
+#else
+  const int previous = omp_get_nested();
+  omp_set_nested(levels > 1 ? 1 : 0);
+#endif
+  return previous;
+}
+
+inline void RestoreNestedRegions(int previous) {
+#if _OPENMP >= 200805
+  omp_set_max_active_levels(previous);
+#else
+  omp_set_nested(previous);
+#endif
+}
+
+}  // namespace ppc::util
@@ -0,0 +1,114 @@
+import csv
+import io
+import os
+import subprocess
+from pathlib import Path
+
+
+def init_cmd_args():
+    import argparse
+    parser = argparse.ArgumentParser(
+        description="Run sort_bench for every sort task and thread count and collect keys/s and speedup.")
+    parser.add_argument("--bench", default=None,
+                        help="Path to the sort_bench executable (default: build/bin or install/bin).")
+    parser.add_argument("--threads", default="1,2,4", help="Comma-separated OMP_NUM_THREADS values.")
+    parser.add_argument("--task", default="", help="Comma-separated substrings of task names (default: all).")
+    parser.add_argument("--key", default="", help="Comma-separated key types: int32, int64, double (default: all).")
+    parser.add_argument("--dist", default="", help="Comma-separated distributions (default: all).")
+    parser.add_argument("--sizes", default="", help="Comma-separated input sizes (default: sort_bench's own).")
+    parser.add_argument("--repeats", default="3", help="Runs per case; the median time is reported.")
+    parser.add_argument("--timeout", type=float, default=600.0, help="Seconds allowed per task and thread count.")
+    parser.add_argument("--output", default="sort_bench.csv", help="CSV file with one row per measured case.")
+    args = parser.parse_args()
+    _args_dict = vars(args)
+    return _args_dict
+
+
+def get_project_path():
+    script_path = Path(__file__).resolve()
+    script_dir = script_path.parent
+    return script_dir.parent
+
+
+def find_bench(bench):
+    if bench:
+        return Path(bench)
+    for work_dir in ["build/bin", "install/bin"]:
+        candidate = get_project_path() / work_dir / "sort_bench"
+        if candidate.is_file():
+            return candidate
+    raise Exception("sort_bench not found; build with -DUSE_PERF_TESTS=ON or pass --bench.")
+
+
+def list_tasks(bench, args):
+    result = subprocess.run([str(bench), "--list"], capture_output=True, text=True, check=True)
+    name_filter = [item for item in args["task"].split(",") if item]
+    key_filter = [item for item in args["key"].split(",") if item]
+    names = []
+    for line in result.stdout.splitlines():
+        name, key = line.split(",")
+        if name_filter and not any(item in name for item in name_filter):
+            continue
+        if key_filter and key not in key_filter:
+            continue
+        if name not in names:
+            names.append(name)
+    return names
+
+
+# Each task runs in its own process so that a crash or a hang in one of them only loses that task's rows
+def run_task(bench, task, threads, args):
+    cmd = [str(bench), f"--task={task}", f"--repeats={args['repeats']}"]
+    for option in ["key", "dist", "sizes"]:
+        if args[option]:
+            cmd.append(f"--{option}={args[option]}")
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    try:
+        result = subprocess.run(cmd, env=env, capture_output=True, text=True, timeout=args["timeout"])
+        output, status = result.stdout, None if result.returncode == 0 else f"exit code {result.returncode}"
+    except subprocess.TimeoutExpired as error:
+        output = error.stdout.decode() if isinstance(error.stdout, bytes) else (error.stdout or "")
+        status = "timeout"
+    rows = [row for row in csv.DictReader(io.StringIO(output)) if row.get("task") == task]
+    return rows, status
+
+
+def add_speedup(rows):
+    base = {}
+    for row in rows:
+        if row["status"] != "ok":
+            continue
+        case = (row["task"], row["key"], row["distribution"], row["size"])
+        if case not in base or int(row["threads"]) < int(base[case]["threads"]):
+            base[case] = row
+    for row in rows:
+        case = (row["task"], row["key"], row["distribution"], row["size"])
+        if row["status"] == "ok" and case in base and float(row["seconds"]) > 0:
+            row["speedup"] = f"{float(base[case]['seconds']) / float(row['seconds']):.3f}"
+        else:
+            row["speedup"] = ""
+
+
+if __name__ == "__main__":
+    args_dict = init_cmd_args()
+    bench_path = find_bench(args_dict["bench"])
+    thread_counts = [int(item) for item in args_dict["threads"].split(",") if item]
+
+    all_rows = []
+    for task_name in list_tasks(bench_path, args_dict):
+        for num_threads in thread_counts:
+            task_rows, failure = run_task(bench_path, task_name, num_threads, args_dict)
+            all_rows.extend(task_rows)
+            if failure:
+                print(f"{task_name} with {num_threads} threads: {failure}")
+            for r in task_rows:
+                print(f"{r['task']:58} {r['key']:6} {r['distribution']:10} {r['size']:>9} {r['threads']:>3} "
+                      f"{float(r['keys_per_sec']):14.0f} keys/s {r['status']}")
+
+    add_speedup(all_rows)
+    fields = ["task", "key", "distribution", "size", "threads", "seconds", "keys_per_sec", "speedup", "status"]
+    with open(args_dict["output"], "w", newline="") as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(all_rows)
+    print(f"Results written to {args_dict['output']}")
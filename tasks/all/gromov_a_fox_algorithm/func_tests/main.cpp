@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/gromov_a_fox_algorithm/include/ops_all.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+std::vector<double> GenerateRandomMatrix(size_t n, double min_val, double max_val) {
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::uniform_real_distribution<> dis(min_val, max_val);
+
+  std::vector<double> matrix(n * n);
+  for (size_t i = 0; i < n * n; ++i) {
+    matrix[i] = dis(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> MultiplyReference(const std::vector<double> &a, const std::vector<double> &b, size_t n) {
+  std::vector<double> c(n * n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t k = 0; k < n; ++k) {
+      for (size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * n) + k] * b[(k * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+// Only the root passes buffers to the task, the other ranks take part in the run with empty task data
+void RunAndCheck(const std::vector<double> &a, const std::vector<double> &b, size_t n) {
+  boost::mpi::communicator world;
+  std::vector<double> out(n * n, 0.0);
+  std::vector<double> input;
+  input.reserve(a.size() + b.size());
+  std::ranges::copy(a, std::back_inserter(input));
+  std::ranges::copy(b, std::back_inserter(input));
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+    task_data_all->inputs_count.emplace_back(input.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_all->outputs_count.emplace_back(out.size());
+  }
+
+  gromov_a_fox_algorithm_all::TestTaskALL test_task_all(task_data_all);
+  ASSERT_TRUE(test_task_all.Validation());
+  ASSERT_TRUE(test_task_all.PreProcessing());
+  ASSERT_TRUE(test_task_all.Run());
+  ASSERT_TRUE(test_task_all.PostProcessing());
+
+  if (world.rank() == 0) {
+    std::vector<double> expected = MultiplyReference(a, b, n);
+    for (size_t i = 0; i < out.size(); ++i) {
+      EXPECT_NEAR(out[i], expected[i], 1e-9);
+    }
+  }
+}
+}  // namespace
+
+TEST(gromov_a_fox_algorithm_all, test_1x1) { RunAndCheck({2.5}, {4.0}, 1); }
+
+TEST(gromov_a_fox_algorithm_all, test_4x4) {
+  RunAndCheck({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0},
+              {16.0, 15.0, 14.0, 13.0, 12.0, 11.0, 10.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0}, 4);
+}
+
+TEST(gromov_a_fox_algorithm_all, test_16x16) {
+  RunAndCheck(GenerateRandomMatrix(16, -10.0, 10.0), GenerateRandomMatrix(16, -5.0, 5.0), 16);
+}
+
+TEST(gromov_a_fox_algorithm_all, test_uneven_blocks) {
+  RunAndCheck(GenerateRandomMatrix(37, -10.0, 10.0), GenerateRandomMatrix(37, -5.0, 5.0), 37);
+}
+
+TEST(gromov_a_fox_algorithm_all, test_100x100) {
+  RunAndCheck(GenerateRandomMatrix(100, -10.0, 10.0), GenerateRandomMatrix(100, -5.0, 5.0), 100);
+}
+
+TEST(gromov_a_fox_algorithm_all, test_128x128) {
+  RunAndCheck(GenerateRandomMatrix(128, -10.0, 10.0), GenerateRandomMatrix(128, -5.0, 5.0), 128);
+}
+
+TEST(gromov_a_fox_algorithm_all, test_invalid_input_size) {
+  boost::mpi::communicator world;
+  std::vector<double> input(7, 1.0);
+  std::vector<double> out(4, 0.0);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+    task_data_all->inputs_count.emplace_back(input.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_all->outputs_count.emplace_back(out.size());
+  }
+
+  gromov_a_fox_algorithm_all::TestTaskALL test_task_all(task_data_all);
+  if (world.rank() == 0) {
+    EXPECT_FALSE(test_task_all.Validation());
+  }
+}
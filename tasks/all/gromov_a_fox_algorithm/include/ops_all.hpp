@@ -0,0 +1,29 @@
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace gromov_a_fox_algorithm_all {
+
+// Fox's algorithm on a q x q grid of processes, q = floor(sqrt(world size)); the remaining ranks stay idle.
+// In stage s the process in column (i + s) mod q of grid row i broadcasts its A block along the row, and every
+// process multiplies it by the B block it holds, after which the B blocks roll up by one row. The broadcast and the
+// B roll for the next stage are started before the local product, so they run while the threads multiply.
+class TestTaskALL : public ppc::core::Task {
+ public:
+  explicit TestTaskALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  std::vector<double> A_, B_, output_;
+  int n_{};
+  boost::mpi::communicator world_;
+};
+
+}  // namespace gromov_a_fox_algorithm_all
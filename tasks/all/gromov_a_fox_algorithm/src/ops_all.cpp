@@ -0,0 +1,196 @@
+#include "all/gromov_a_fox_algorithm/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr int kTagB = 1;
+
+// Side of the process grid: the largest q with q * q <= processes, but no more blocks than matrix rows.
+int GridSide(int processes, int n) {
+  int q = static_cast<int>(std::sqrt(static_cast<double>(processes)));
+  while (q * q > processes) {
+    --q;
+  }
+  while ((q + 1) * (q + 1) <= processes) {
+    ++q;
+  }
+  return std::max(1, std::min(q, n));
+}
+
+// [0, n) is split into q near-equal parts; part i is [PartBegin(n, q, i), PartBegin(n, q, i + 1)).
+int PartBegin(int n, int q, int i) { return static_cast<int>((static_cast<long long>(n) * i) / q); }
+
+int PartSize(int n, int q, int i) { return PartBegin(n, q, i + 1) - PartBegin(n, q, i); }
+
+// Appends block (bi, bj) of an n x n row-major matrix split into q x q blocks to dst, row by row.
+void PackBlock(const std::vector<double>& matrix, int n, int q, int bi, int bj, std::vector<double>& dst) {
+  for (int i = PartBegin(n, q, bi); i < PartBegin(n, q, bi + 1); ++i) {
+    const auto row = matrix.begin() + (static_cast<std::ptrdiff_t>(i) * n);
+    dst.insert(dst.end(), row + PartBegin(n, q, bj), row + PartBegin(n, q, bj + 1));
+  }
+}
+
+// Sends block (i, j) of the root's matrix to process i * q + j of the grid, which receives `count` values.
+void ScatterBlocks(const boost::mpi::communicator& grid, const std::vector<double>& matrix, int n, int q,
+                   double* block, int count) {
+  if (grid.rank() != 0) {
+    boost::mpi::scatterv(grid, block, count, 0);
+    return;
+  }
+  std::vector<double> packed;
+  packed.reserve(matrix.size());
+  std::vector<int> counts(q * q);
+  std::vector<int> displs(q * q);
+  for (int p = 0; p < q * q; ++p) {
+    displs[p] = static_cast<int>(packed.size());
+    PackBlock(matrix, n, q, p / q, p % q, packed);
+    counts[p] = static_cast<int>(packed.size()) - displs[p];
+  }
+  boost::mpi::scatterv(grid, packed.data(), counts, displs, block, count, 0);
+}
+
+// C += A * B for a rows x inner block of A and an inner x cols block of B, with the rows of C split among threads.
+void LocalGemm(int rows, int cols, int inner, const double* a, const double* b, double* c, int num_threads) {
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+  for (int t = 0; t < num_threads; ++t) {
+    const int first = (rows * t) / num_threads;
+    const int last = (rows * (t + 1)) / num_threads;
+    ppc::core::Gemm(last - first, cols, inner, a + (static_cast<std::ptrdiff_t>(first) * inner), inner, b, cols,
+                    c + (static_cast<std::ptrdiff_t>(first) * cols), cols);
+  }
+}
+
+}  // namespace
+
+bool gromov_a_fox_algorithm_all::TestTaskALL::PreProcessingImpl() {
+  if (world_.rank() != 0) {
+    return true;
+  }
+  unsigned int input_size = task_data->inputs_count[0];
+  unsigned int matrix_size = input_size / 2;
+  auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
+
+  A_ = std::vector<double>(in_ptr, in_ptr + matrix_size);
+  B_ = std::vector<double>(in_ptr + matrix_size, in_ptr + input_size);
+  output_ = std::vector<double>(task_data->outputs_count[0], 0.0);
+  n_ = static_cast<int>(std::sqrt(matrix_size));
+  return true;
+}
+
+bool gromov_a_fox_algorithm_all::TestTaskALL::ValidationImpl() {
+  if (world_.rank() != 0) {
+    return true;
+  }
+  unsigned int input_size = task_data->inputs_count[0];
+  if (input_size == 0 || input_size % 2 != 0) {
+    return false;
+  }
+  unsigned int matrix_size = input_size / 2;
+  auto sqrt_matrix_size = static_cast<unsigned int>(std::sqrt(matrix_size));
+  return matrix_size == task_data->outputs_count[0] && sqrt_matrix_size * sqrt_matrix_size == matrix_size;
+}
+
+bool gromov_a_fox_algorithm_all::TestTaskALL::RunImpl() {
+  int n = n_;
+  boost::mpi::broadcast(world_, n, 0);
+  const int q = GridSide(world_.size(), n);
+  const bool in_grid = world_.rank() < q * q;
+  const boost::mpi::communicator grid = world_.split(in_grid ? 0 : 1);
+  if (!in_grid) {
+    return true;
+  }
+
+  const int rank = grid.rank();
+  const int row = rank / q;
+  const int col = rank % q;
+  const int rows = PartSize(n, q, row);
+  const int cols = PartSize(n, q, col);
+  const int max_part = (n + q - 1) / q;
+  const boost::mpi::communicator row_comm = grid.split(row, col);
+
+  std::vector<double> a_own(static_cast<std::size_t>(rows) * cols);
+  std::vector<double> b_cur(static_cast<std::size_t>(max_part) * cols);
+  ScatterBlocks(grid, A_, n, q, a_own.data(), rows * cols);
+  ScatterBlocks(grid, B_, n, q, b_cur.data(), rows * cols);
+
+  const int above = (((row + q - 1) % q) * q) + col;
+  const int below = (((row + 1) % q) * q) + col;
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  std::vector<double> a_cur(static_cast<std::size_t>(rows) * max_part);
+  std::vector<double> a_next(a_cur.size());
+  std::vector<double> b_next(b_cur.size());
+  std::vector<double> c(static_cast<std::size_t>(rows) * cols, 0.0);
+
+  // Stage s multiplies A(row, k) by B(k, col) with k = row + s; the process holding A(row, k) is column k
+  if (col == row) {
+    std::ranges::copy(a_own, a_cur.begin());
+  }
+  boost::mpi::broadcast(row_comm, a_cur.data(), rows * PartSize(n, q, row), row);
+  for (int step = 0; step < q; ++step) {
+    const int k = (row + step) % q;
+    std::vector<boost::mpi::request> requests;
+    MPI_Request bcast = MPI_REQUEST_NULL;
+    if (step + 1 < q) {
+      const int next = (k + 1) % q;
+      if (col == next) {
+        std::ranges::copy(a_own, a_next.begin());
+      }
+      MPI_Ibcast(a_next.data(), rows * PartSize(n, q, next), MPI_DOUBLE, next, static_cast<MPI_Comm>(row_comm),
+                 &bcast);
+      requests.push_back(grid.irecv(below, kTagB, b_next.data(), PartSize(n, q, next) * cols));
+      requests.push_back(grid.isend(above, kTagB, b_cur.data(), PartSize(n, q, k) * cols));
+    }
+    LocalGemm(rows, cols, PartSize(n, q, k), a_cur.data(), b_cur.data(), c.data(), num_threads);
+    boost::mpi::wait_all(requests.begin(), requests.end());
+    MPI_Wait(&bcast, MPI_STATUS_IGNORE);
+    std::swap(a_cur, a_next);
+    std::swap(b_cur, b_next);
+  }
+
+  if (rank == 0) {
+    std::vector<int> counts(q * q);
+    std::vector<int> displs(q * q);
+    for (int p = 0; p < q * q; ++p) {
+      counts[p] = PartSize(n, q, p / q) * PartSize(n, q, p % q);
+      displs[p] = p == 0 ? 0 : displs[p - 1] + counts[p - 1];
+    }
+    std::vector<double> packed(static_cast<std::size_t>(n) * n);
+    boost::mpi::gatherv(grid, c.data(), static_cast<int>(c.size()), packed.data(), counts, displs, 0);
+    for (int p = 0; p < q * q; ++p) {
+      const int i = p / q;
+      const int j = p % q;
+      const int block_cols = PartSize(n, q, j);
+      for (int r = 0; r < PartSize(n, q, i); ++r) {
+        const auto src = packed.begin() + displs[p] + (static_cast<std::ptrdiff_t>(r) * block_cols);
+        std::copy(src, src + block_cols,
+                  output_.begin() + (static_cast<std::ptrdiff_t>(PartBegin(n, q, i) + r) * n) + PartBegin(n, q, j));
+      }
+    }
+  } else {
+    boost::mpi::gatherv(grid, c.data(), static_cast<int>(c.size()), 0);
+  }
+  return true;
+}
+
+bool gromov_a_fox_algorithm_all::TestTaskALL::PostProcessingImpl() {
+  if (world_.rank() == 0) {
+    std::ranges::copy(output_, reinterpret_cast<double*>(task_data->outputs[0]));
+  }
+  return true;
+}
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "all/nesterov_a_sample_sort/include/ops_all.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+// Every rank builds the same input and passes the block given by block_sizes; the sorted blocks are gathered
+// on the root and compared with the fully sorted input. Returns the number of keys the rank's range held.
+template <typename T>
+std::size_t RunAndCheck(std::vector<T> in, const std::vector<int>& block_sizes) {
+  boost::mpi::communicator world;
+  int block_begin = 0;
+  for (int r = 0; r < world.rank(); ++r) {
+    block_begin += block_sizes[r];
+  }
+  std::vector<T> block(in.begin() + block_begin, in.begin() + block_begin + block_sizes[world.rank()]);
+  std::vector<T> out(block.size());
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(block.data()));
+  task_data_all->inputs_count.emplace_back(block.size());
+  task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_all->outputs_count.emplace_back(out.size());
+
+  nesterov_a_sample_sort_all::SampleSortALL<T> test_task_all(task_data_all);
+  EXPECT_TRUE(test_task_all.Validation());
+  EXPECT_TRUE(test_task_all.PreProcessing());
+  EXPECT_TRUE(test_task_all.Run());
+  EXPECT_TRUE(test_task_all.PostProcessing());
+
+  if (world.rank() == 0) {
+    std::vector<T> result(in.size());
+    boost::mpi::gatherv(world, out.data(), static_cast<int>(out.size()), result.data(), block_sizes, 0);
+    std::ranges::sort(in);
+    EXPECT_EQ(in, result);
+  } else {
+    boost::mpi::gatherv(world, out.data(), static_cast<int>(out.size()), 0);
+  }
+  return test_task_all.PartitionSize();
+}
+
+template <typename T>
+std::size_t RunAndCheck(std::vector<T> in) {
+  boost::mpi::communicator world;
+  const auto n = static_cast<int>(in.size());
+  std::vector<int> block_sizes(world.size());
+  for (int r = 0; r < world.size(); ++r) {
+    block_sizes[r] = (n * (r + 1) / world.size()) - (n * r / world.size());
+  }
+  return RunAndCheck(std::move(in), block_sizes);
+}
+
+std::vector<int> GenRandVec(std::size_t size, int min, int max) {
+  std::mt19937 gen(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<int> vec(size);
+  std::ranges::generate(vec, [&] { return dist(gen); });
+  return vec;
+}
+}  // namespace
+
+TEST(nesterov_a_sample_sort_all, test_empty) { RunAndCheck(std::vector<int>{}); }
+
+TEST(nesterov_a_sample_sort_all, test_single_element) { RunAndCheck(std::vector<int>{42}); }
+
+TEST(nesterov_a_sample_sort_all, test_small_random) { RunAndCheck(GenRandVec(100, -1000, 1000)); }
+
+TEST(nesterov_a_sample_sort_all, test_large_random) { RunAndCheck(GenRandVec(200000, -1000000, 1000000)); }
+
+TEST(nesterov_a_sample_sort_all, test_odd_size) { RunAndCheck(GenRandVec(100003, -1000000, 1000000)); }
+
+TEST(nesterov_a_sample_sort_all, test_few_unique) { RunAndCheck(GenRandVec(100000, 0, 3)); }
+
+TEST(nesterov_a_sample_sort_all, test_all_equal) { RunAndCheck(std::vector<int>(50000, 7)); }
+
+TEST(nesterov_a_sample_sort_all, test_duplicates_are_spread_over_ranks) {
+  boost::mpi::communicator world;
+  const std::size_t n = 60000;
+  const std::size_t limit = (2 * n / world.size()) + 1;
+  EXPECT_LE(RunAndCheck(std::vector<int>(n, 7)), limit);
+
+  // One key takes nine tenths of the input
+  auto in = GenRandVec(n, 0, 1000000);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (i % 10 != 0) {
+      in[i] = 500000;
+    }
+  }
+  EXPECT_LE(RunAndCheck(in), limit);
+}
+
+TEST(nesterov_a_sample_sort_all, test_uneven_blocks) {
+  boost::mpi::communicator world;
+  auto in = GenRandVec(40000, -1000, 1000);
+  std::vector<int> block_sizes(world.size(), 0);
+  block_sizes[0] = static_cast<int>(in.size());
+  RunAndCheck(in, block_sizes);
+
+  int rest = static_cast<int>(in.size());
+  for (int r = world.size() - 1; r > 0; --r) {
+    block_sizes[r] = rest / 3;
+    rest -= block_sizes[r];
+  }
+  block_sizes[0] = rest;
+  RunAndCheck(in, block_sizes);
+}
+
+TEST(nesterov_a_sample_sort_all, test_sorted) {
+  auto in = GenRandVec(50000, -100000, 100000);
+  std::ranges::sort(in);
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_all, test_reverse_sorted) {
+  auto in = GenRandVec(50000, -100000, 100000);
+  std::ranges::sort(in, std::greater<>());
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_all, test_int64) {
+  std::mt19937_64 gen(1);
+  std::vector<std::int64_t> in(60000);
+  std::ranges::generate(in, [&] { return static_cast<std::int64_t>(gen()); });
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_all, test_double) {
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> in(60000);
+  std::ranges::generate(in, [&] { return dist(gen); });
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_all, test_local_sort_with_many_threads) {
+  auto in = GenRandVec(30001, -500, 500);
+  auto expected = in;
+  std::ranges::sort(expected);
+  nesterov_a_sample_sort_all::SampleSortALL<int>::LocalSort(in, 7);
+  EXPECT_EQ(expected, in);
+}
+
+TEST(nesterov_a_sample_sort_all, test_invalid_output_size) {
+  std::vector<int> in(10, 1);
+  std::vector<int> out(5);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_all->inputs_count.emplace_back(in.size());
+  task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_all->outputs_count.emplace_back(out.size());
+
+  nesterov_a_sample_sort_all::SampleSortALL<int> test_task_all(task_data_all);
+  EXPECT_FALSE(test_task_all.Validation());
+}
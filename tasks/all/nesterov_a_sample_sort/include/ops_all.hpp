@@ -0,0 +1,39 @@
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sample_sort_all {
+
+// Distributed sample sort (PSRS): every rank passes its own block of the input and gets back the block of the
+// sorted sequence at the same position and of the same length, so no rank ever holds the whole array. Every
+// rank sorts its block with threads, splitters are chosen from a regular sample of all blocks, an all-to-all
+// exchange sends every key to the rank owning its range, the received sorted pieces are merged locally and a
+// second exchange shifts the result into the caller's block layout. Equal keys are ordered by their rank and
+// position in the sorted block, so runs of duplicates are split between ranks like any other keys.
+template <typename T>
+class SampleSortALL : public ppc::core::Task {
+ public:
+  explicit SampleSortALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // Node-local threaded sort: blocks are sorted in parallel, then merged pairwise.
+  static void LocalSort(std::vector<T>& data, int num_threads);
+
+  // Number of keys whose range this rank owned during the last run, before they were shifted into its block.
+  [[nodiscard]] std::size_t PartitionSize() const { return partition_size_; }
+
+ private:
+  std::vector<T> data_;
+  std::size_t partition_size_ = 0;
+  boost::mpi::communicator world_;
+};
+
+}  // namespace nesterov_a_sample_sort_all
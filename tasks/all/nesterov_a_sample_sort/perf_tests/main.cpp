@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/nesterov_a_sample_sort/include/ops_all.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+std::vector<int> GenRandVec(int size) {
+  std::mt19937 gen(size);
+  std::uniform_int_distribution<int> dist(-1000000, 1000000);
+  std::vector<int> vec(size);
+  std::ranges::generate(vec, [&] { return dist(gen); });
+  return vec;
+}
+
+// Every rank passes its own block of the input
+std::vector<int> TakeBlock(const std::vector<int>& in, std::vector<int>& block_sizes) {
+  boost::mpi::communicator world;
+  const auto n = static_cast<int>(in.size());
+  block_sizes.resize(world.size());
+  for (int r = 0; r < world.size(); ++r) {
+    block_sizes[r] = (n * (r + 1) / world.size()) - (n * r / world.size());
+  }
+  const auto begin = in.begin() + (n * world.rank() / world.size());
+  return {begin, begin + block_sizes[world.rank()]};
+}
+
+void CheckSorted(std::vector<int>& in, const std::vector<int>& out, const std::vector<int>& block_sizes) {
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    std::vector<int> result(in.size());
+    boost::mpi::gatherv(world, out.data(), static_cast<int>(out.size()), result.data(), block_sizes, 0);
+    std::ranges::sort(in);
+    ASSERT_EQ(in, result);
+  } else {
+    boost::mpi::gatherv(world, out.data(), static_cast<int>(out.size()), 0);
+  }
+}
+}  // namespace
+
+TEST(nesterov_a_sample_sort_all, test_pipeline_run) {
+  constexpr int kCount = 4000000;
+
+  std::vector<int> in = GenRandVec(kCount);
+  std::vector<int> block_sizes;
+  std::vector<int> block = TakeBlock(in, block_sizes);
+  std::vector<int> out(block.size());
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(block.data()));
+  task_data_all->inputs_count.emplace_back(block.size());
+  task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_all->outputs_count.emplace_back(out.size());
+
+  auto test_task_all = std::make_shared<nesterov_a_sample_sort_all::SampleSortALL<int>>(task_data_all);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
+  perf_analyzer->PipelineRun(perf_attr, perf_results);
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+  }
+  CheckSorted(in, out, block_sizes);
+}
+
+TEST(nesterov_a_sample_sort_all, test_task_run) {
+  constexpr int kCount = 4000000;
+
+  std::vector<int> in = GenRandVec(kCount);
+  std::vector<int> block_sizes;
+  std::vector<int> block = TakeBlock(in, block_sizes);
+  std::vector<int> out(block.size());
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(block.data()));
+  task_data_all->inputs_count.emplace_back(block.size());
+  task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_all->outputs_count.emplace_back(out.size());
+
+  auto test_task_all = std::make_shared<nesterov_a_sample_sort_all::SampleSortALL<int>>(task_data_all);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+  }
+  CheckSorted(in, out, block_sizes);
+}
@@ -0,0 +1,210 @@
+#include "all/nesterov_a_sample_sort/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives/all_gather.hpp>
+#include <boost/mpi/collectives/all_to_all.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr std::size_t kSequentialThreshold = 1 << 12;
+constexpr std::size_t kOversampling = 16;
+
+// Merges the sorted runs [bounds[i], bounds[i + 1]) of data pairwise, one parallel round per level.
+template <typename T>
+void MergeSortedRuns(std::vector<T>& data, std::vector<std::size_t> bounds, int num_threads) {
+  std::vector<T> buffer(data.size());
+  while (bounds.size() > 2) {
+    const int runs = static_cast<int>(bounds.size()) - 1;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (int k = 0; k < runs; k += 2) {
+      const auto first = data.begin() + static_cast<std::ptrdiff_t>(bounds[k]);
+      const auto middle = data.begin() + static_cast<std::ptrdiff_t>(bounds[k + 1]);
+      const auto dst = buffer.begin() + static_cast<std::ptrdiff_t>(bounds[k]);
+      if (k + 1 < runs) {
+        std::merge(first, middle, middle, data.begin() + static_cast<std::ptrdiff_t>(bounds[k + 2]), dst);
+      } else {
+        std::copy(first, middle, dst);
+      }
+    }
+    data.swap(buffer);
+
+    std::vector<std::size_t> merged;
+    for (std::size_t k = 0; k < bounds.size(); k += 2) {
+      merged.push_back(bounds[k]);
+    }
+    if (merged.back() != data.size()) {
+      merged.push_back(data.size());
+    }
+    bounds.swap(merged);
+  }
+}
+
+std::vector<int> ExclusiveScan(const std::vector<int>& counts) {
+  std::vector<int> displs(counts.size(), 0);
+  for (std::size_t i = 1; i < counts.size(); ++i) {
+    displs[i] = displs[i - 1] + counts[i - 1];
+  }
+  return displs;
+}
+
+// Number of elements of [begin, end) that also lie in [other_begin, other_end).
+int Overlap(int begin, int end, int other_begin, int other_end) {
+  return std::max(0, std::min(end, other_end) - std::max(begin, other_begin));
+}
+
+}  // namespace
+
+template <typename T>
+void nesterov_a_sample_sort_all::SampleSortALL<T>::LocalSort(std::vector<T>& data, int num_threads) {
+  const std::size_t n = data.size();
+  if (num_threads <= 1 || n < kSequentialThreshold) {
+    std::ranges::sort(data);
+    return;
+  }
+
+  std::vector<std::size_t> bounds(num_threads + 1);
+  for (int t = 0; t <= num_threads; ++t) {
+    bounds[t] = (n * t) / num_threads;
+  }
+#pragma omp parallel for num_threads(num_threads)
+  for (int t = 0; t < num_threads; ++t) {
+    std::sort(data.begin() + static_cast<std::ptrdiff_t>(bounds[t]),
+              data.begin() + static_cast<std::ptrdiff_t>(bounds[t + 1]));
+  }
+  MergeSortedRuns(data, std::move(bounds), num_threads);
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_all::SampleSortALL<T>::PreProcessingImpl() {
+  auto* in_ptr = reinterpret_cast<T*>(task_data->inputs[0]);
+  data_ = std::vector<T>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_all::SampleSortALL<T>::ValidationImpl() {
+  return task_data->inputs.size() == 1 && task_data->outputs.size() == 1 &&
+         task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_all::SampleSortALL<T>::RunImpl() {
+  const int size = world_.size();
+  const int rank = world_.rank();
+  const int num_threads = ppc::util::GetPPCNumThreads();
+
+  LocalSort(data_, num_threads);
+  partition_size_ = data_.size();
+  if (size == 1) {
+    return true;
+  }
+
+  std::vector<int> block_sizes;
+  boost::mpi::all_gather(world_, static_cast<int>(data_.size()), block_sizes);
+  const std::vector<int> block_displs = ExclusiveScan(block_sizes);
+  if (block_displs.back() + block_sizes.back() == 0) {
+    return true;
+  }
+
+  // Regular sampling; the position of every sample follows from the block sizes, so only the keys travel
+  std::vector<int> sample_counts(size);
+  for (int r = 0; r < size; ++r) {
+    sample_counts[r] = std::min(size * static_cast<int>(kOversampling), block_sizes[r]);
+  }
+  const auto sample_position = [&](int r, int i) {
+    return static_cast<int>(((((2 * static_cast<std::int64_t>(i)) + 1) * block_sizes[r]) / (2 * sample_counts[r])));
+  };
+  std::vector<T> sample(sample_counts[rank]);
+  for (int i = 0; i < sample_counts[rank]; ++i) {
+    sample[i] = data_[sample_position(rank, i)];
+  }
+  const std::vector<int> sample_displs = ExclusiveScan(sample_counts);
+  std::vector<T> sample_keys(static_cast<std::size_t>(sample_displs.back()) + sample_counts.back());
+  MPI_Datatype type = boost::mpi::get_mpi_datatype<T>();
+  MPI_Allgatherv(sample.data(), sample_counts[rank], type, sample_keys.data(), sample_counts.data(),
+                 sample_displs.data(), type, world_);
+
+  // Keys are ordered by (key, rank, position in the sorted block), which makes every element distinct; the
+  // gathered samples already come in rank and position order, so a stable sort by key is enough
+  struct Splitter {
+    T key;
+    int rank;
+    int position;
+  };
+  std::vector<Splitter> samples;
+  samples.reserve(sample_keys.size());
+  for (int r = 0; r < size; ++r) {
+    for (int i = 0; i < sample_counts[r]; ++i) {
+      samples.push_back({sample_keys[sample_displs[r] + i], r, sample_position(r, i)});
+    }
+  }
+  std::ranges::stable_sort(samples, {}, &Splitter::key);
+
+  // Rank r receives the keys in (splitter r-1, splitter r]; data_ is sorted, so each range is contiguous. Equal
+  // keys go left of a splitter from lower ranks and right of it from higher ranks, and the splitter's own
+  // rank cuts its run right after the sampled position
+  std::vector<int> send_counts(size, 0);
+  int range_begin = 0;
+  for (int r = 0; r < size; ++r) {
+    int range_end = static_cast<int>(data_.size());
+    if (r + 1 < size) {
+      const Splitter& splitter = samples[((r + 1) * samples.size()) / size];
+      if (splitter.rank < rank) {
+        range_end = static_cast<int>(std::ranges::lower_bound(data_, splitter.key) - data_.begin());
+      } else if (splitter.rank > rank) {
+        range_end = static_cast<int>(std::ranges::upper_bound(data_, splitter.key) - data_.begin());
+      } else {
+        range_end = splitter.position + 1;
+      }
+      range_end = std::max(range_end, range_begin);
+    }
+    send_counts[r] = range_end - range_begin;
+    range_begin = range_end;
+  }
+  std::vector<int> recv_counts(size, 0);
+  boost::mpi::all_to_all(world_, send_counts, recv_counts);
+
+  std::vector<int> recv_displs = ExclusiveScan(recv_counts);
+  std::vector<T> received(static_cast<std::size_t>(recv_displs.back()) + recv_counts.back());
+  MPI_Alltoallv(data_.data(), send_counts.data(), ExclusiveScan(send_counts).data(), type, received.data(),
+                recv_counts.data(), recv_displs.data(), type, world_);
+
+  std::vector<std::size_t> bounds(recv_displs.begin(), recv_displs.end());
+  bounds.push_back(received.size());
+  MergeSortedRuns(received, std::move(bounds), num_threads);
+  partition_size_ = received.size();
+
+  // The partitions cover the sorted sequence in rank order; hand every rank the part that falls into its block
+  std::vector<int> partition_sizes;
+  boost::mpi::all_gather(world_, static_cast<int>(received.size()), partition_sizes);
+  const std::vector<int> partition_displs = ExclusiveScan(partition_sizes);
+  const int own_begin = partition_displs[rank];
+  const int own_end = own_begin + partition_sizes[rank];
+  for (int r = 0; r < size; ++r) {
+    send_counts[r] = Overlap(own_begin, own_end, block_displs[r], block_displs[r] + block_sizes[r]);
+    recv_counts[r] = Overlap(partition_displs[r], partition_displs[r] + partition_sizes[r], block_displs[rank],
+                             block_displs[rank] + block_sizes[rank]);
+  }
+  recv_displs = ExclusiveScan(recv_counts);
+  MPI_Alltoallv(received.data(), send_counts.data(), ExclusiveScan(send_counts).data(), type, data_.data(),
+                recv_counts.data(), recv_displs.data(), type, world_);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_all::SampleSortALL<T>::PostProcessingImpl() {
+  std::ranges::copy(data_, reinterpret_cast<T*>(task_data->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sample_sort_all::SampleSortALL<int>;
+template class nesterov_a_sample_sort_all::SampleSortALL<std::int64_t>;
+template class nesterov_a_sample_sort_all::SampleSortALL<double>;
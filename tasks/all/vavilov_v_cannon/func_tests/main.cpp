@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/vavilov_v_cannon/include/ops_all.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+std::vector<double> GenerateRandomMatrix(int n, double min_val = -10.0, double max_val = 10.0) {
+  std::vector<double> matrix(n * n);
+  std::mt19937 gen(static_cast<unsigned>(n));
+  std::uniform_real_distribution<double> dist(min_val, max_val);
+
+  for (int i = 0; i < n * n; i++) {
+    matrix[i] = dist(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> MultMat(const std::vector<double>& a, const std::vector<double>& b, int n) {
+  std::vector<double> c(n * n, 0.0);
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < n; k++) {
+      for (int j = 0; j < n; j++) {
+        c[(i * n) + j] += a[(i * n) + k] * b[(k * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+// Only the root passes buffers to the task, the other ranks take part in the run with empty task data.
+// The inputs are rounded to T and the result is compared with the double product of the rounded values.
+template <typename T = double, typename AccT = T>
+void RunAndCheck(const std::vector<double>& a_ref, const std::vector<double>& b_ref, int n, double tolerance = 1e-6) {
+  boost::mpi::communicator world;
+  std::vector<T> a(a_ref.begin(), a_ref.end());
+  std::vector<T> b(b_ref.begin(), b_ref.end());
+  std::vector<AccT> c(n * n, 0);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_all->inputs_count.emplace_back(a.size());
+    task_data_all->inputs_count.emplace_back(b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+    task_data_all->outputs_count.emplace_back(c.size());
+  }
+
+  vavilov_v_cannon_all::CannonALL<T, AccT> task_all(task_data_all);
+  ASSERT_TRUE(task_all.Validation());
+  ASSERT_TRUE(task_all.PreProcessing());
+  ASSERT_TRUE(task_all.Run());
+  ASSERT_TRUE(task_all.PostProcessing());
+
+  if (world.rank() == 0) {
+    std::vector<double> expected_output =
+        MultMat(std::vector<double>(a.begin(), a.end()), std::vector<double>(b.begin(), b.end()), n);
+    for (int i = 0; i < n * n; i++) {
+      EXPECT_NEAR(expected_output[i], c[i], tolerance);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(vavilov_v_cannon_all, test_single_element) { RunAndCheck({3.0}, {-2.0}, 1); }
+
+TEST(vavilov_v_cannon_all, test_fixed_4x4) {
+  RunAndCheck({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},
+              {16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1}, 4);
+}
+
+TEST(vavilov_v_cannon_all, test_identity) {
+  constexpr int kN = 16;
+  std::vector<double> identity(kN * kN, 0.0);
+  for (int i = 0; i < kN; i++) {
+    identity[(i * kN) + i] = 1.0;
+  }
+  RunAndCheck(GenerateRandomMatrix(kN), identity, kN);
+}
+
+TEST(vavilov_v_cannon_all, test_random_16) { RunAndCheck(GenerateRandomMatrix(16), GenerateRandomMatrix(16), 16); }
+
+TEST(vavilov_v_cannon_all, test_uneven_blocks) {
+  RunAndCheck(GenerateRandomMatrix(37), GenerateRandomMatrix(37), 37);
+}
+
+TEST(vavilov_v_cannon_all, test_random_100) { RunAndCheck(GenerateRandomMatrix(100), GenerateRandomMatrix(100), 100); }
+
+TEST(vavilov_v_cannon_all, test_random_128) { RunAndCheck(GenerateRandomMatrix(128), GenerateRandomMatrix(128), 128); }
+
+TEST(vavilov_v_cannon_all, test_float) {
+  RunAndCheck<float>(GenerateRandomMatrix(96, -1.0, 1.0), GenerateRandomMatrix(96, -1.0, 1.0), 96, 1e-4);
+}
+
+TEST(vavilov_v_cannon_all, test_float_inputs_double_accumulation) {
+  RunAndCheck<float, double>(GenerateRandomMatrix(96, -1.0, 1.0), GenerateRandomMatrix(96, -1.0, 1.0), 96, 1e-11);
+}
+
+TEST(vavilov_v_cannon_all, test_invalid_sizes) {
+  boost::mpi::communicator world;
+  std::vector<double> a(16, 1.0);
+  std::vector<double> b(9, 1.0);
+  std::vector<double> c(16, 0.0);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_all->inputs_count.emplace_back(a.size());
+    task_data_all->inputs_count.emplace_back(b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+    task_data_all->outputs_count.emplace_back(c.size());
+  }
+
+  vavilov_v_cannon_all::CannonALL<double> task_all(task_data_all);
+  if (world.rank() == 0) {
+    EXPECT_FALSE(task_all.Validation());
+  }
+}
+
+// A is the block at (3, 5) of a 50 x 50 matrix, B is column-major with a leading dimension of 40, and the buffer of
+// C receives its transpose with two padding columns per row.
+TEST(vavilov_v_cannon_all, test_views) {
+  boost::mpi::communicator world;
+  constexpr int kN = 37;
+  constexpr int kBig = 50;
+  constexpr int kLdb = 40;
+  constexpr int kLdc = kN + 2;
+  std::vector<double> big = GenerateRandomMatrix(kBig);
+  std::vector<double> b = GenerateRandomMatrix(kLdb);
+  b.resize(kLdb * kN);
+  std::vector<double> c(kN * kLdc, -1.0);
+  std::array<ppc::core::MatrixDesc, 3> layouts = {
+      ppc::core::MatrixDesc{.rows = kN, .cols = kN, .ld = kBig},
+      ppc::core::MatrixDesc{
+          .rows = kN, .cols = kN, .ld = kLdb, .transpose = false, .layout = ppc::core::MatrixLayout::kColumnMajor},
+      ppc::core::MatrixDesc{.rows = kN, .cols = kN, .ld = kLdc, .transpose = true},
+  };
+  const int a_offset = (3 * kBig) + 5;
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(big.data() + a_offset));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(layouts.data()));
+    task_data_all->inputs_count.emplace_back(big.size() - a_offset);
+    task_data_all->inputs_count.emplace_back(b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+    task_data_all->outputs_count.emplace_back(c.size());
+  }
+
+  vavilov_v_cannon_all::CannonALL<double> task_all(task_data_all);
+  ASSERT_TRUE(task_all.Validation());
+  ASSERT_TRUE(task_all.PreProcessing());
+  ASSERT_TRUE(task_all.Run());
+  ASSERT_TRUE(task_all.PostProcessing());
+
+  if (world.rank() == 0) {
+    for (int j = 0; j < kN; j++) {
+      for (int i = 0; i < kLdc; i++) {
+        double expected = -1.0;
+        if (i < kN) {
+          expected = 0.0;
+          for (int p = 0; p < kN; p++) {
+            expected += big[a_offset + (i * kBig) + p] * b[(j * kLdb) + p];
+          }
+        }
+        EXPECT_NEAR(expected, c[(j * kLdc) + i], 1e-9);
+      }
+    }
+  }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+
+namespace vavilov_v_cannon_all {
+
+// Cannon's algorithm on a q x q grid of processes, q = floor(sqrt(world size)); the remaining ranks stay idle.
+// The root scatters to every process the blocks it starts with, already skewed, so the initial alignment costs no
+// extra messages. In each of the q steps a process multiplies its current A and B blocks with threads while the
+// next A block arrives from the right neighbour and the next B block from the one below. Besides the root, which
+// holds inputs and outputs, a process never keeps more than its C block and two A and B blocks each.
+// Blocks travel as T; C is accumulated and gathered as AccT. As in the shared-memory variants, inputs[2] may point
+// to ppc::core::MatrixDesc views of A, B and C, which the root reads and writes in place.
+template <typename T, typename AccT = T>
+class CannonALL : public ppc::core::Task {
+ public:
+  explicit CannonALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  int n_{};
+  const T* a_{};
+  const T* b_{};
+  std::vector<AccT> c_;
+  ppc::core::MatrixDesc desc_a_;
+  ppc::core::MatrixDesc desc_b_;
+  ppc::core::MatrixDesc desc_c_;
+  boost::mpi::communicator world_;
+};
+
+}  // namespace vavilov_v_cannon_all
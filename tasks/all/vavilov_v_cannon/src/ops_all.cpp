@@ -0,0 +1,231 @@
+#include "all/vavilov_v_cannon/include/ops_all.hpp"
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr int kTagA = 1;
+constexpr int kTagB = 2;
+
+// Side of the process grid: the largest q with q * q <= processes, but no more blocks than matrix rows.
+int GridSide(int processes, int n) {
+  int q = static_cast<int>(std::sqrt(static_cast<double>(processes)));
+  while (q * q > processes) {
+    --q;
+  }
+  while ((q + 1) * (q + 1) <= processes) {
+    ++q;
+  }
+  return std::max(1, std::min(q, n));
+}
+
+// [0, n) is split into q near-equal parts; part i is [PartBegin(n, q, i), PartBegin(n, q, i + 1)).
+int PartBegin(int n, int q, int i) { return static_cast<int>((static_cast<long long>(n) * i) / q); }
+
+int PartSize(int n, int q, int i) { return PartBegin(n, q, i + 1) - PartBegin(n, q, i); }
+
+// Appends block (bi, bj) of the n x n matrix `desc` describes, split into q x q blocks, to dst row by row.
+template <typename T>
+void PackBlock(const T* matrix, const ppc::core::MatrixDesc& desc, int n, int q, int bi, int bj, std::vector<T>& dst) {
+  for (int i = PartBegin(n, q, bi); i < PartBegin(n, q, bi + 1); ++i) {
+    if (desc.ColStride() == 1) {
+      const T* row = matrix + desc.Offset(i, 0);
+      dst.insert(dst.end(), row + PartBegin(n, q, bj), row + PartBegin(n, q, bj + 1));
+      continue;
+    }
+    for (int j = PartBegin(n, q, bj); j < PartBegin(n, q, bj + 1); ++j) {
+      dst.push_back(matrix[desc.Offset(i, j)]);
+    }
+  }
+}
+
+// Descriptors of A, B and C if the caller passed them in inputs[2]
+const ppc::core::MatrixDesc* Layouts(const ppc::core::TaskData& data) {
+  return data.inputs.size() > 2 ? reinterpret_cast<const ppc::core::MatrixDesc*>(data.inputs[2]) : nullptr;
+}
+
+// C += A * B for a rows x inner block of A and an inner x cols block of B, with the rows of C split among threads.
+template <typename T, typename AccT>
+void LocalGemm(int rows, int cols, int inner, const T* a, const T* b, AccT* c, int num_threads) {
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+  for (int t = 0; t < num_threads; ++t) {
+    const int first = (rows * t) / num_threads;
+    const int last = (rows * (t + 1)) / num_threads;
+    ppc::core::Gemm(last - first, cols, inner, a + (static_cast<std::ptrdiff_t>(first) * inner), inner, b, cols,
+                    c + (static_cast<std::ptrdiff_t>(first) * cols), cols);
+  }
+}
+
+}  // namespace
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_all::CannonALL<T, AccT>::PreProcessingImpl() {
+  if (world_.rank() == 0) {
+    if (const ppc::core::MatrixDesc* layouts = Layouts(*task_data)) {
+      desc_a_ = layouts[0];
+      desc_b_ = layouts[1];
+      desc_c_ = layouts[2];
+    } else {
+      const auto n = static_cast<std::size_t>(std::sqrt(task_data->inputs_count[0]));
+      desc_a_ = desc_b_ = desc_c_ = ppc::core::RowMajorDesc(n, n);
+    }
+    n_ = static_cast<int>(desc_a_.rows);
+    a_ = reinterpret_cast<const T*>(task_data->inputs[0]);
+    b_ = reinterpret_cast<const T*>(task_data->inputs[1]);
+    c_.assign(n_ * n_, 0.0);
+  }
+  return true;
+}
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_all::CannonALL<T, AccT>::ValidationImpl() {
+  if (world_.rank() != 0) {
+    return true;
+  }
+  if (task_data->inputs.size() < 2 || task_data->inputs.size() > 3 || task_data->outputs.size() != 1) {
+    return false;
+  }
+  if (const ppc::core::MatrixDesc* layouts = Layouts(*task_data)) {
+    const std::array<std::size_t, 3> sizes = {task_data->inputs_count[0], task_data->inputs_count[1],
+                                              task_data->outputs_count[0]};
+    for (std::size_t i = 0; i < sizes.size(); ++i) {
+      if (!layouts[i].IsValid() || layouts[i].rows != layouts[0].rows || layouts[i].cols != layouts[0].rows ||
+          layouts[i].Span() > sizes[i]) {
+        return false;
+      }
+    }
+    return layouts[0].rows > 0;
+  }
+  if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
+      task_data->outputs_count[0] != task_data->inputs_count[0]) {
+    return false;
+  }
+  auto n = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
+  return n > 0 && n * n == task_data->inputs_count[0];
+}
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_all::CannonALL<T, AccT>::RunImpl() {
+  int n = n_;
+  boost::mpi::broadcast(world_, n, 0);
+  const int q = GridSide(world_.size(), n);
+  const bool in_grid = world_.rank() < q * q;
+  const boost::mpi::communicator grid = world_.split(in_grid ? 0 : 1);
+  if (!in_grid) {
+    return true;
+  }
+
+  const int rank = grid.rank();
+  const int row = rank / q;
+  const int col = rank % q;
+  const int rows = PartSize(n, q, row);
+  const int cols = PartSize(n, q, col);
+  const int max_part = (n + q - 1) / q;
+
+  // Process (i, j) starts with A(i, i + j) and B(i + j, j), which is the skew of Cannon's algorithm
+  std::vector<T> a_cur(static_cast<std::size_t>(rows) * max_part);
+  std::vector<T> b_cur(static_cast<std::size_t>(max_part) * cols);
+  const int k0 = (row + col) % q;
+  if (rank == 0) {
+    std::vector<T> packed_a;
+    std::vector<T> packed_b;
+    packed_a.reserve(static_cast<std::size_t>(n) * n);
+    packed_b.reserve(static_cast<std::size_t>(n) * n);
+    std::vector<int> counts_a(q * q);
+    std::vector<int> counts_b(q * q);
+    std::vector<int> displs_a(q * q);
+    std::vector<int> displs_b(q * q);
+    for (int p = 0; p < q * q; ++p) {
+      const int i = p / q;
+      const int j = p % q;
+      const int k = (i + j) % q;
+      displs_a[p] = static_cast<int>(packed_a.size());
+      displs_b[p] = static_cast<int>(packed_b.size());
+      PackBlock(a_, desc_a_, n, q, i, k, packed_a);
+      PackBlock(b_, desc_b_, n, q, k, j, packed_b);
+      counts_a[p] = static_cast<int>(packed_a.size()) - displs_a[p];
+      counts_b[p] = static_cast<int>(packed_b.size()) - displs_b[p];
+    }
+    boost::mpi::scatterv(grid, packed_a.data(), counts_a, displs_a, a_cur.data(), counts_a[0], 0);
+    boost::mpi::scatterv(grid, packed_b.data(), counts_b, displs_b, b_cur.data(), counts_b[0], 0);
+  } else {
+    boost::mpi::scatterv(grid, a_cur.data(), rows * PartSize(n, q, k0), 0);
+    boost::mpi::scatterv(grid, b_cur.data(), PartSize(n, q, k0) * cols, 0);
+  }
+
+  // A blocks travel left and B blocks up; the transfer of the next pair runs while the current pair is multiplied
+  const int left = (row * q) + ((col + q - 1) % q);
+  const int right = (row * q) + ((col + 1) % q);
+  const int above = (((row + q - 1) % q) * q) + col;
+  const int below = (((row + 1) % q) * q) + col;
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  std::vector<T> a_next(a_cur.size());
+  std::vector<T> b_next(b_cur.size());
+  std::vector<AccT> c(static_cast<std::size_t>(rows) * cols, 0.0);
+  for (int step = 0; step < q; ++step) {
+    const int k = (k0 + step) % q;
+    std::vector<boost::mpi::request> requests;
+    if (step + 1 < q) {
+      const int next = (k + 1) % q;
+      requests.push_back(grid.irecv(right, kTagA, a_next.data(), rows * PartSize(n, q, next)));
+      requests.push_back(grid.irecv(below, kTagB, b_next.data(), PartSize(n, q, next) * cols));
+      requests.push_back(grid.isend(left, kTagA, a_cur.data(), rows * PartSize(n, q, k)));
+      requests.push_back(grid.isend(above, kTagB, b_cur.data(), PartSize(n, q, k) * cols));
+    }
+    LocalGemm(rows, cols, PartSize(n, q, k), a_cur.data(), b_cur.data(), c.data(), num_threads);
+    boost::mpi::wait_all(requests.begin(), requests.end());
+    std::swap(a_cur, a_next);
+    std::swap(b_cur, b_next);
+  }
+
+  if (rank == 0) {
+    std::vector<int> counts(q * q);
+    std::vector<int> displs(q * q);
+    for (int p = 0; p < q * q; ++p) {
+      counts[p] = PartSize(n, q, p / q) * PartSize(n, q, p % q);
+      displs[p] = p == 0 ? 0 : displs[p - 1] + counts[p - 1];
+    }
+    std::vector<AccT> packed(static_cast<std::size_t>(n) * n);
+    boost::mpi::gatherv(grid, c.data(), static_cast<int>(c.size()), packed.data(), counts, displs, 0);
+    for (int p = 0; p < q * q; ++p) {
+      const int i = p / q;
+      const int j = p % q;
+      const int block_cols = PartSize(n, q, j);
+      for (int r = 0; r < PartSize(n, q, i); ++r) {
+        const auto src = packed.begin() + displs[p] + (static_cast<std::ptrdiff_t>(r) * block_cols);
+        std::copy(src, src + block_cols,
+                  c_.begin() + (static_cast<std::ptrdiff_t>(PartBegin(n, q, i) + r) * n) + PartBegin(n, q, j));
+      }
+    }
+  } else {
+    boost::mpi::gatherv(grid, c.data(), static_cast<int>(c.size()), 0);
+  }
+  return true;
+}
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_all::CannonALL<T, AccT>::PostProcessingImpl() {
+  if (world_.rank() == 0) {
+    ppc::core::CopyToMatrix(c_.data(), desc_c_, reinterpret_cast<AccT*>(task_data->outputs[0]));
+  }
+  return true;
+}
+
+template class vavilov_v_cannon_all::CannonALL<double>;
+template class vavilov_v_cannon_all::CannonALL<float>;
+template class vavilov_v_cannon_all::CannonALL<float, double>;
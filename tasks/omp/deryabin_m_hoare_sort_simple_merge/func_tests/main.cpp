@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <random>
 #include <vector>
@@ -364,3 +365,92 @@ TEST(deryabin_m_hoare_sort_simple_merge_omp, test_invalid_chunk_count) {
   deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP hoare_sort_task_openmp(task_data_omp);
   ASSERT_EQ(hoare_sort_task_openmp.Validation(), false);
 }
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_few_ascending_runs) {
+  // Create data
+  std::vector<double> input_array;
+  for (int run = 0; run < 3; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      input_array.push_back(static_cast<double>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(input_array.size());
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  // Create TaskData
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_omp->inputs_count.emplace_back(input_array.size());
+  task_data_omp->inputs_count.emplace_back(chunk_count);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_omp->outputs_count.emplace_back(output_array.size());
+
+  // Create Task
+  deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP hoare_sort_task_openmp(task_data_omp);
+  ASSERT_EQ(hoare_sort_task_openmp.Validation(), true);
+  hoare_sort_task_openmp.PreProcessing();
+  hoare_sort_task_openmp.Run();
+  hoare_sort_task_openmp.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_nth_element) {
+  // Create data
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(100000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  for (size_t k : {size_t{0}, size_t{1}, size_t{49999}, size_t{99999}}) {
+    std::vector<double> array(input_array);
+    deryabin_m_hoare_sort_simple_merge_omp::NthElement(array, k);
+    ASSERT_EQ(true_solution[k], array[k]);
+    ASSERT_LE(*std::max_element(array.begin(), array.begin() + (long)k + 1), array[k]);
+    ASSERT_GE(*std::min_element(array.begin() + (long)k, array.end()), array[k]);
+  }
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_nth_element_many_duplicates) {
+  // Create data
+  std::mt19937 gen(8);
+  std::uniform_int_distribution<> distribution(0, 3);
+  std::vector<double> input_array(80000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_omp::NthElement(input_array, 30000);
+  ASSERT_EQ(true_solution[30000], input_array[30000]);
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_partial_sort) {
+  // Create data
+  std::mt19937 gen(9);
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(60000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  deryabin_m_hoare_sort_simple_merge_omp::PartialSort(input_array, 1000);
+  ASSERT_TRUE(std::equal(true_solution.begin(), true_solution.begin() + 1000, input_array.begin()));
+}
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_top_k) {
+  // Create data
+  std::mt19937 gen(10);
+  std::uniform_real_distribution<> distribution(-100, 100);
+  std::vector<double> input_array(50000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end(), std::greater<>());
+  true_solution.resize(500);
+
+  ASSERT_EQ(true_solution, deryabin_m_hoare_sort_simple_merge_omp::TopK(input_array, 500));
+}
@@ -1,11 +1,16 @@
 #include "omp/deryabin_m_hoare_sort_simple_merge/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <numbers>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/omp_part_runner.hpp"
+
 void deryabin_m_hoare_sort_simple_merge_omp::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   size_t i = first;
   size_t j = last;
@@ -63,6 +68,20 @@ void deryabin_m_hoare_sort_simple_merge_omp::MergeTwoParts(std::vector<double>&
   }
 }
 
+// Выбор разбивает массив параллельным разбиением Хоара из core/sort, а не HoaraSort, которая не завершается на
+// равных опорному элементах
+void deryabin_m_hoare_sort_simple_merge_omp::NthElement(std::vector<double>& a, size_t k) {
+  ppc::core::NthElement(a, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
+
+void deryabin_m_hoare_sort_simple_merge_omp::PartialSort(std::vector<double>& a, size_t k) {
+  ppc::core::PartialSort(a, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
+
+std::vector<double> deryabin_m_hoare_sort_simple_merge_omp::TopK(const std::vector<double>& a, size_t k) {
+  return ppc::core::TopK(a, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
+
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskSequential::PreProcessingImpl() {
   input_array_A_ = reinterpret_cast<std::vector<double>*>(task_data->inputs[0])[0];
   dimension_ = task_data->inputs_count[0];
@@ -114,6 +133,10 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::ValidationImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::RunImpl() {
+  if (ppc::core::SortIfPresorted(input_array_A_, static_cast<std::size_t>(omp_get_max_threads()),
+                                 ppc::core::OmpPartRunner())) {
+    return true;
+  }
   auto chunk_count = (short)chunk_count_;
 #pragma omp parallel for
   for (short count = 0; count < chunk_count; count++) {
@@ -2,8 +2,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+#include "core/tuning/include/tuning.hpp"
+#include "core/util/include/util.hpp"
+
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   if (input_size % 2 != 0) {
@@ -24,13 +29,9 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
     return false;
   }
 
-  block_size_ = n_ / 2;
-  for (int i = 1; i <= n_; ++i) {
-    if (n_ % i == 0) {
-      block_size_ = i;
-      break;
-    }
-  }
+  // The tuned block size, shrunk if needed so that every thread gets a block row of C
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  block_size_ = std::min(static_cast<int>(ppc::core::TunedMatrixBlockSize()), (n_ + num_threads - 1) / num_threads);
   return block_size_ > 0;
 }
 
@@ -57,14 +58,10 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::RunImpl() {
 #pragma omp parallel for default(none) shared(a_ref, b_ref, output_ref, n_ref, block_size_ref, stage)
     for (int i = 0; i < n_ref; i += block_size_ref) {
       for (int j = 0; j < n_ref; j += block_size_ref) {
-        for (int bi = i; bi < i + block_size_ref && bi < n_ref; ++bi) {
-          for (int bj = j; bj < j + block_size_ref && bj < n_ref; ++bj) {
-            int start_k = stage * block_size_ref;
-            for (int bk = start_k; bk < std::min((stage + 1) * block_size_ref, n_ref); ++bk) {
-              output_ref[(bi * n_ref) + bj] += a_ref[(bi * n_ref) + bk] * b_ref[(bk * n_ref) + bj];
-            }
-          }
-        }
+        const int k = stage * block_size_ref;
+        ppc::core::Gemm(std::min(block_size_ref, n_ref - i), std::min(block_size_ref, n_ref - j),
+                        std::min(block_size_ref, n_ref - k), &a_ref[(i * n_ref) + k], n_ref, &b_ref[(k * n_ref) + j],
+                        n_ref, &output_ref[(i * n_ref) + j], n_ref);
       }
     }
   }
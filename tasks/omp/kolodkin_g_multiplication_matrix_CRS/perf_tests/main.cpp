@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -35,27 +36,21 @@ TEST(kolodkin_g_multiplication_matrix__task_omp, test_pipeline_run) {
   srand(time(nullptr));
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS a(400, 400);
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS b(400, 400);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a = ::GenMatrix(400, 400, 0, 150, 0, 150, -100, 100);
   b = ::GenMatrix(400, 400, 50, 140, 50, 150, -100, 100);
-  in_a = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoBytes(b);
 
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -80,34 +75,28 @@ TEST(kolodkin_g_multiplication_matrix__task_omp, test_pipeline_run) {
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_omp::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_omp::ParseBytesIntoMatrix(out.data(), out.size());
 }
 
 TEST(kolodkin_g_multiplication_matrix__task_omp, test_task_run) {
   srand(time(nullptr));
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS a(400, 400);
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS b(400, 400);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a = ::GenMatrix(400, 400, 0, 150, 0, 150, -100, 100);
   b = ::GenMatrix(400, 400, 50, 140, 50, 150, -100, 100);
-  in_a = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_omp::ParseMatrixIntoBytes(b);
 
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -132,5 +121,5 @@ TEST(kolodkin_g_multiplication_matrix__task_omp, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   kolodkin_g_multiplication_matrix_omp::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_omp::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_omp::ParseBytesIntoMatrix(out.data(), out.size());
 }
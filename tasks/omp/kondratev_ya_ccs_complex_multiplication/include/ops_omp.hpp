@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kondratev_ya_ccs_complex_multiplication_omp {
@@ -25,16 +26,22 @@ struct CCSMatrix {
   CCSMatrix operator*(const CCSMatrix& other) const;
 };
 
+// CCSMatrix::operator* forms the product; with ComplexStorage::kSplit the SIMD kernels of ppc::core::SplitCscMatrix
+// do, on split real and imaginary arrays, and the same entries are dropped as IsZero.
 class TestTaskOMP : public ppc::core::Task {
  public:
-  explicit TestTaskOMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  explicit TestTaskOMP(ppc::core::TaskDataPtr task_data,
+                       ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved)
+      : Task(std::move(task_data)), storage_(storage) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
  private:
+  ppc::core::ComplexStorage storage_;
   CCSMatrix a_, b_, c_;
+  ppc::core::SplitCscMatrix<double> split_a_, split_b_;
 };
 
 }  // namespace kondratev_ya_ccs_complex_multiplication_omp
\ No newline at end of file
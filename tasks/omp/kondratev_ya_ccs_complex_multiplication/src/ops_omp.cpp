@@ -5,9 +5,42 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/util/include/util.hpp"
+
+namespace kondratev_ya_ccs_complex_multiplication_omp {
+namespace {
+// Entries of the split product that are not IsZero, which are the ones CCSMatrix::operator* keeps
+CCSMatrix CollectNonZeros(const ppc::core::SplitCscMatrix<double> &product) {
+  CCSMatrix result({product.rows, product.cols});
+  for (int col = 0; col < product.cols; col++) {
+    for (int k = product.col_ptr[col]; k < product.col_ptr[col + 1]; k++) {
+      const std::complex<double> value(product.real[k], product.imag[k]);
+      if (!IsZero(value)) {
+        result.values.emplace_back(value);
+        result.row_index.emplace_back(product.row_idx[k]);
+      }
+    }
+    result.col_ptrs[col + 1] = static_cast<int>(result.values.size());
+  }
+  return result;
+}
+
+ppc::core::SplitCscMatrix<double> ToSplit(const CCSMatrix &matrix) {
+  return ppc::core::SplitCscMatrix<double>::FromInterleaved({.rows = matrix.rows,
+                                                             .cols = matrix.cols,
+                                                             .col_ptr = matrix.col_ptrs,
+                                                             .row_idx = matrix.row_index,
+                                                             .values = matrix.values});
+}
+}  // namespace
+}  // namespace kondratev_ya_ccs_complex_multiplication_omp
+
 bool kondratev_ya_ccs_complex_multiplication_omp::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -29,6 +62,10 @@ bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::PreProcessingImpl
     return false;
   }
 
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_a_ = ToSplit(a_);
+    split_b_ = ToSplit(b_);
+  }
   return true;
 }
 
@@ -38,7 +75,12 @@ bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::ValidationImpl()
 }
 
 bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::RunImpl() {
-  c_ = a_ * b_;
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+    c_ = CollectNonZeros(split_a_.Multiply(split_b_, parts, ppc::core::OmpPartRunner()));
+  } else {
+    c_ = a_ * b_;
+  }
   return true;
 }
 
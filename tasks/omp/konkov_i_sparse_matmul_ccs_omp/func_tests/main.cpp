@@ -86,9 +86,57 @@ TEST(konkov_i_SparseMatmulTest_omp, IdentityMatrixTest) {
   task.rowsB = 3;
   task.colsB = 3;
 
+  EXPECT_TRUE(task.ValidationImpl());
+  EXPECT_TRUE(task.PreProcessingImpl());
   EXPECT_TRUE(task.RunImpl());
 
   EXPECT_EQ(task.C_values, task.B_values);
   EXPECT_EQ(task.C_row_indices, task.B_row_indices);
   EXPECT_EQ(task.C_col_ptr, task.B_col_ptr);
-}
\ No newline at end of file
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, CancelledEntriesAreDropped) {
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+
+  // (1 1; 0 1) * (1 0; -1 1) = (0 1; -1 1)
+  task.A_values = {1.0, 1.0, 1.0};
+  task.A_row_indices = {0, 0, 1};
+  task.A_col_ptr = {0, 1, 3};
+  task.rowsA = 2;
+  task.colsA = 2;
+
+  task.B_values = {1.0, -1.0, 1.0};
+  task.B_row_indices = {0, 1, 1};
+  task.B_col_ptr = {0, 2, 3};
+  task.rowsB = 2;
+  task.colsB = 2;
+
+  EXPECT_TRUE(task.ValidationImpl());
+  EXPECT_TRUE(task.PreProcessingImpl());
+  EXPECT_TRUE(task.RunImpl());
+  EXPECT_TRUE(task.PostProcessingImpl());
+
+  EXPECT_EQ(task.C_col_ptr, (std::vector<int>{0, 1, 3}));
+  EXPECT_EQ(task.C_row_indices, (std::vector<int>{1, 0, 1}));
+  EXPECT_EQ(task.C_values, (std::vector<double>{-1.0, 1.0, 1.0}));
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, InconsistentArraysAreRejected) {
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+
+  task.A_values = {1.0, 2.0};
+  task.A_row_indices = {0, 5};
+  task.A_col_ptr = {0, 1, 2};
+  task.rowsA = 2;
+  task.colsA = 2;
+
+  task.B_values = {1.0};
+  task.B_row_indices = {0};
+  task.B_col_ptr = {0, 1, 1};
+  task.rowsB = 2;
+  task.colsB = 2;
+
+  EXPECT_FALSE(task.ValidationImpl());
+}
@@ -3,6 +3,7 @@
 
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_sparse_matmul_ccs_omp {
@@ -20,6 +21,10 @@ class SparseMatmulTask : public ppc::core::Task {
   std::vector<int> A_row_indices, B_row_indices, C_row_indices;
   std::vector<int> A_col_ptr, B_col_ptr, C_col_ptr;
   int rowsA, colsA, rowsB, colsB;
+
+ private:
+  // Copies of the operands built once by PreProcessingImpl
+  ppc::core::CscMatrix<double> a_, b_;
 };
 
 }  // namespace konkov_i_sparse_matmul_ccs_omp
\ No newline at end of file
@@ -4,11 +4,13 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 
 namespace konkov_i_sparse_matmul_ccs_omp {
 
@@ -21,63 +23,48 @@ bool SparseMatmulTask::ValidationImpl() {
   if (A_col_ptr.empty() || B_col_ptr.empty()) {
     return false;
   }
-  return true;
+  const ppc::core::CscMatrix<double> a{
+      .rows = rowsA, .cols = colsA, .col_ptr = A_col_ptr, .row_idx = A_row_indices, .values = A_values};
+  const ppc::core::CscMatrix<double> b{
+      .rows = rowsB, .cols = colsB, .col_ptr = B_col_ptr, .row_idx = B_row_indices, .values = B_values};
+  return a.IsValid() && b.IsValid();
 }
 
 bool SparseMatmulTask::PreProcessingImpl() {
-  C_col_ptr.resize(colsB + 1, 0);
+  a_ = {.rows = rowsA, .cols = colsA, .col_ptr = A_col_ptr, .row_idx = A_row_indices, .values = A_values};
+  b_ = {.rows = rowsB, .cols = colsB, .col_ptr = B_col_ptr, .row_idx = B_row_indices, .values = B_values};
+  C_col_ptr.clear();
   C_row_indices.clear();
   C_values.clear();
   return true;
 }
 
 bool SparseMatmulTask::RunImpl() {
-  std::vector<std::unordered_map<int, double>> column_map(colsB);
-
-#pragma omp parallel for
-  for (int col_b = 0; col_b < colsB; ++col_b) {
-    for (int j = B_col_ptr[col_b]; j < B_col_ptr[col_b + 1]; ++j) {
-      int row_b = B_row_indices[j];
-      double val_b = B_values[j];
-
-      if (row_b >= colsA) {
-        continue;
-      }
-
-      for (int k = A_col_ptr[row_b]; k < A_col_ptr[row_b + 1]; ++k) {
-        if (static_cast<size_t>(k) >= A_row_indices.size()) {
-          continue;
-        }
-
-        int row_a = A_row_indices[k];
-        double val_a = A_values[k];
-
-#pragma omp critical
-        column_map[col_b][row_a] += val_a * val_b;
+  // Symbolic and numeric Gustavson passes over ranges of columns of B with about equal numbers of products
+  const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+  ppc::core::CscMatrix<double> c = a_.Multiply(b_, parts, ppc::core::OmpPartRunner());
+
+  // The kernel keeps products that cancel out as explicit zeros; the task drops them
+  int kept = 0;
+  int begin = 0;
+  for (int col = 0; col < c.cols; ++col) {
+    const int end = c.col_ptr[col + 1];
+    for (int e = begin; e < end; ++e) {
+      if (c.values[e] != 0.0) {
+        c.row_idx[kept] = c.row_idx[e];
+        c.values[kept] = c.values[e];
+        ++kept;
       }
     }
+    begin = end;
+    c.col_ptr[col + 1] = kept;
   }
+  c.row_idx.resize(kept);
+  c.values.resize(kept);
 
-  C_col_ptr.resize(colsB + 1, 0);
-  int count = 0;
-
-  for (int col = 0; col < colsB; ++col) {
-    std::vector<int> rows;
-    for (const auto& pair : column_map[col]) {
-      if (pair.second != 0) {
-        rows.push_back(pair.first);
-      }
-    }
-    std::ranges::sort(rows);
-
-    for (int row : rows) {
-      C_values.push_back(column_map[col][row]);
-      C_row_indices.push_back(row);
-      count++;
-    }
-    C_col_ptr[col + 1] = count;
-  }
-
+  C_col_ptr = std::move(c.col_ptr);
+  C_row_indices = std::move(c.row_idx);
+  C_values = std::move(c.values);
   return true;
 }
 
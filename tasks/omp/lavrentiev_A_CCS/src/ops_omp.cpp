@@ -3,158 +3,78 @@
 #include <omp.h>
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/sparse/include/sparse.hpp"
 #include "core/util/include/util.hpp"
 
-lavrentiev_a_ccs_omp::Sparse lavrentiev_a_ccs_omp::CCSOMP::ConvertToSparse(std::pair<int, int> size,
-                                                                           const std::vector<double> &values) {
-  auto [nsize, elements, rows, columns_sum] = Sparse();
-  columns_sum.resize(size.second);
-  for (int i = 0; i < size.second; ++i) {
-    for (int j = 0; j < size.first; ++j) {
-      if (values[i + (size.second * j)] != 0) {
-        elements.emplace_back(values[i + (size.second * j)]);
-        rows.emplace_back(j);
-        columns_sum[i] += 1;
-      }
-    }
-    if (i != size.second - 1) {
-      columns_sum[i + 1] = columns_sum[i];
-    }
-  }
-  return {.size = size, .elements = elements, .rows = rows, .columnsSum = columns_sum};
-}
+namespace {
 
-lavrentiev_a_ccs_omp::Sparse lavrentiev_a_ccs_omp::CCSOMP::Transpose(const Sparse &sparse) {
-  auto [size, elements, rows, columns_sum] = Sparse();
-  size.first = sparse.size.second;
-  size.second = sparse.size.first;
-  int need_size = std::max(sparse.size.first, sparse.size.second);
-  std::vector<std::vector<double>> new_elements(need_size);
-  std::vector<std::vector<int>> new_indexes(need_size);
-  int counter = 0;
-  for (int i = 0; i < static_cast<int>(sparse.columnsSum.size()); ++i) {
-    for (int j = 0; j < GetElementsCount(i, sparse.columnsSum); ++j) {
-      new_elements[sparse.rows[counter]].emplace_back(sparse.elements[counter]);
-      new_indexes[sparse.rows[counter]].emplace_back(i);
-      counter++;
-    }
-  }
-  for (int i = 0; i < static_cast<int>(new_elements.size()); ++i) {
-    for (int j = 0; j < static_cast<int>(new_elements[i].size()); ++j) {
-      elements.emplace_back(new_elements[i][j]);
-      rows.emplace_back(new_indexes[i][j]);
-    }
-    if (i > 0) {
-      columns_sum.emplace_back(new_elements[i].size() + columns_sum[i - 1]);
+// Dot product of row i of A and column j of B, walking both sorted index lists at once.
+double RowTimesColumn(const ppc::core::CsrMatrix<double> &a, int i, const ppc::core::CscMatrix<double> &b, int j) {
+  double sum = 0.0;
+  int x = a.row_ptr[i];
+  int y = b.col_ptr[j];
+  while (x < a.row_ptr[i + 1] && y < b.col_ptr[j + 1]) {
+    if (a.col_idx[x] < b.row_idx[y]) {
+      ++x;
+    } else if (b.row_idx[y] < a.col_idx[x]) {
+      ++y;
     } else {
-      columns_sum.emplace_back(new_elements[i].size());
+      sum += a.values[x++] * b.values[y++];
     }
   }
-  return {.size = size, .elements = elements, .rows = rows, .columnsSum = columns_sum};
+  return sum;
 }
 
-int lavrentiev_a_ccs_omp::CCSOMP::CalculateStartIndex(int index, const std::vector<int> &columns_sum) {
-  if (index != 0) {
-    return columns_sum[index] - GetElementsCount(index, columns_sum);
-  }
-  return 0;
-}
+}  // namespace
 
-lavrentiev_a_ccs_omp::Sparse lavrentiev_a_ccs_omp::CCSOMP::MatMul(const Sparse &matrix1, const Sparse &matrix2) {
-  Sparse result_matrix;
-  result_matrix.columnsSum.resize(matrix2.size.second);
-  auto new_matrix1 = Transpose(matrix1);
-  std::vector<std::pair<std::vector<double>, std::vector<int>>> threads_data(
-      std::max(1, ppc::util::GetPPCNumThreads()));
-#pragma omp parallel
-  {
-    std::pair<std::vector<double>, std::vector<int>> current_thread_data;
-#pragma omp for
-    for (int i = 0; i < static_cast<int>(matrix2.columnsSum.size()); ++i) {
-      for (int j = 0; j < static_cast<int>(new_matrix1.columnsSum.size()); ++j) {
-        double sum = 0.0;
-        for (int n = 0; n < GetElementsCount(j, new_matrix1.columnsSum); n++) {
-          for (int n2 = 0; n2 < GetElementsCount(i, matrix2.columnsSum); n2++) {
-            if (new_matrix1.rows[CalculateStartIndex(j, new_matrix1.columnsSum) + n] ==
-                matrix2.rows[CalculateStartIndex(i, matrix2.columnsSum) + n2]) {
-              sum += new_matrix1.elements[n + CalculateStartIndex(j, new_matrix1.columnsSum)] *
-                     matrix2.elements[n2 + CalculateStartIndex(i, matrix2.columnsSum)];
-            }
-          }
-        }
-        if (sum != 0) {
-          current_thread_data.first.push_back(sum);
-          current_thread_data.second.push_back(j);
-          result_matrix.columnsSum[i]++;
-        }
+ppc::core::CscMatrix<double> lavrentiev_a_ccs_omp::CCSOMP::MatMul(const ppc::core::CsrMatrix<double> &matrix1,
+                                                                  const ppc::core::CscMatrix<double> &matrix2) {
+  std::vector<std::vector<std::pair<int, double>>> columns(matrix2.cols);
+#pragma omp parallel for schedule(dynamic)
+  for (int j = 0; j < matrix2.cols; ++j) {
+    for (int i = 0; i < matrix1.rows; ++i) {
+      double sum = RowTimesColumn(matrix1, i, matrix2, j);
+      if (sum != 0) {
+        columns[j].emplace_back(i, sum);
       }
     }
-    threads_data[omp_get_thread_num()] = std::move(current_thread_data);
-  }
-  for (size_t i = 1; i < result_matrix.columnsSum.size(); ++i) {
-    result_matrix.columnsSum[i] = result_matrix.columnsSum[i] + result_matrix.columnsSum[i - 1];
   }
-  if (!result_matrix.columnsSum.empty()) {
-    result_matrix.elements.resize(result_matrix.columnsSum.back());
-    result_matrix.rows.resize(result_matrix.columnsSum.back());
+  ppc::core::CscMatrix<double> result;
+  result.rows = matrix1.rows;
+  result.cols = matrix2.cols;
+  result.col_ptr.assign(matrix2.cols + 1, 0);
+  for (int j = 0; j < matrix2.cols; ++j) {
+    result.col_ptr[j + 1] = result.col_ptr[j] + static_cast<int>(columns[j].size());
   }
-  int count = 0;
-  for (size_t i = 0; i < threads_data.size(); ++i) {
-    std::ranges::copy(threads_data[i].first, result_matrix.elements.begin() + count);
-    std::ranges::copy(threads_data[i].second, result_matrix.rows.begin() + count);
-    count += static_cast<int>(threads_data[i].first.size());
-  }
-  result_matrix.size.first = matrix2.size.second;
-  result_matrix.size.second = matrix2.size.second;
-  return {.size = result_matrix.size,
-          .elements = result_matrix.elements,
-          .rows = result_matrix.rows,
-          .columnsSum = result_matrix.columnsSum};
-}
-
-int lavrentiev_a_ccs_omp::CCSOMP::GetElementsCount(int index, const std::vector<int> &columns_sum) {
-  if (index == 0) {
-    return columns_sum[index];
-  }
-  return columns_sum[index] - columns_sum[index - 1];
-}
-
-std::vector<double> lavrentiev_a_ccs_omp::CCSOMP::ConvertFromSparse(const Sparse &matrix) {
-  std::vector<double> nmatrix(matrix.size.first * matrix.size.second);
-  int counter = 0;
-  for (size_t i = 0; i < matrix.columnsSum.size(); ++i) {
-    for (int j = 0; j < GetElementsCount(static_cast<int>(i), matrix.columnsSum); ++j) {
-      nmatrix[i + (matrix.size.second * matrix.rows[counter])] = matrix.elements[counter];
-      counter++;
+  result.row_idx.resize(result.col_ptr.back());
+  result.values.resize(result.col_ptr.back());
+#pragma omp parallel for
+  for (int j = 0; j < matrix2.cols; ++j) {
+    for (std::size_t k = 0; k < columns[j].size(); ++k) {
+      result.row_idx[result.col_ptr[j] + k] = columns[j][k].first;
+      result.values[result.col_ptr[j] + k] = columns[j][k].second;
     }
   }
-  return nmatrix;
+  return result;
 }
 
 bool lavrentiev_a_ccs_omp::CCSOMP::PreProcessingImpl() {
-  A_.size = {static_cast<int>(task_data->inputs_count[0]), static_cast<int>(task_data->inputs_count[1])};
-  B_.size = {static_cast<int>(task_data->inputs_count[2]), static_cast<int>(task_data->inputs_count[3])};
-  if (IsEmpty()) {
-    return true;
-  }
-  auto *in_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
-  auto am = std::vector<double>(in_ptr, in_ptr + (A_.size.first * A_.size.second));
-  A_ = ConvertToSparse(A_.size, am);
-  auto *in_ptr2 = reinterpret_cast<double *>(task_data->inputs[1]);
-  auto bm = std::vector<double>(in_ptr2, in_ptr2 + (B_.size.first * B_.size.second));
-  B_ = ConvertToSparse(B_.size, bm);
+  const auto a_rows = static_cast<int>(task_data->inputs_count[0]);
+  const auto a_cols = static_cast<int>(task_data->inputs_count[1]);
+  const auto b_cols = static_cast<int>(task_data->inputs_count[3]);
+  const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+  A_ = ppc::core::CsrMatrix<double>::FromDense(a_rows, a_cols, reinterpret_cast<double *>(task_data->inputs[0]),
+                                               a_cols, 0.0, parts, ppc::core::OmpPartRunner());
+  B_ = ppc::core::CscMatrix<double>::FromDense(a_cols, b_cols, reinterpret_cast<double *>(task_data->inputs[1]),
+                                               b_cols, 0.0, parts, ppc::core::OmpPartRunner());
   return true;
 }
 
-bool lavrentiev_a_ccs_omp::CCSOMP::IsEmpty() const {
-  return A_.size.first * A_.size.second == 0 || B_.size.first * B_.size.second == 0;
-}
-
 bool lavrentiev_a_ccs_omp::CCSOMP::ValidationImpl() {
   return task_data->inputs_count[0] * task_data->inputs_count[3] == task_data->outputs_count[0] &&
          task_data->inputs_count[0] == task_data->inputs_count[3] &&
@@ -167,6 +87,6 @@ bool lavrentiev_a_ccs_omp::CCSOMP::RunImpl() {
 }
 
 bool lavrentiev_a_ccs_omp::CCSOMP::PostProcessingImpl() {
-  std::ranges::copy(ConvertFromSparse(Answer_), reinterpret_cast<double *>(task_data->outputs[0]));
+  Answer_.ToDense(reinterpret_cast<double *>(task_data->outputs[0]), Answer_.cols);
   return true;
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool moiseev_a_mult_mat_omp::MultMatOMP::PreProcessingImpl() {
   unsigned int input_size_a = task_data->inputs_count[0];
   unsigned int input_size_b = task_data->inputs_count[1];
@@ -47,17 +49,9 @@ bool moiseev_a_mult_mat_omp::MultMatOMP::RunImpl() {
         int a_j_start = a_block_j * block_size_;
         int b_i_start = b_block_i * block_size_;
 
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            double sum = 0.0;
-            for (int k = 0; k < block_size_; ++k) {
-              double a_val = matrix_a_[((i_start + i) * matrix_size_) + (a_j_start + k)];
-              double b_val = matrix_b_[((b_i_start + k) * matrix_size_) + (j_start + j)];
-              sum += a_val * b_val;
-            }
-            matrix_c_[((i_start + i) * matrix_size_) + (j_start + j)] += sum;
-          }
-        }
+        ppc::core::Gemm(block_size_, block_size_, block_size_, &matrix_a_[(i_start * matrix_size_) + a_j_start],
+                        matrix_size_, &matrix_b_[(b_i_start * matrix_size_) + j_start], matrix_size_,
+                        &matrix_c_[(i_start * matrix_size_) + j_start], matrix_size_);
       }
     }
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -18,21 +19,14 @@ class StrassenOmp : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static std::vector<double> AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static std::vector<double> SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static void MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static std::vector<double> PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size);
-  static std::vector<double> TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
-                                                      int padded_size);
-  static std::vector<double> StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size);
+  void StrassenMultiply();
 
   std::vector<double> input_matrix_a_, input_matrix_b_;
   std::vector<double> output_matrix_;
+  std::vector<double> workspace_;
+  std::size_t cutoff_{};
+  std::size_t depth_{};
   int matrix_size_{};
-  int original_size_{};
 };
 
 }  // namespace nasedkin_e_strassen_algorithm_omp
\ No newline at end of file
@@ -4,10 +4,35 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <functional>
 #include <vector>
 
+#include "core/strassen/include/strassen.hpp"
+#include "core/util/include/omp_nesting.hpp"
+
 namespace nasedkin_e_strassen_algorithm_omp {
 
+namespace {
+
+// Threads the products of the current recursion level share. Each product takes its part of them down into the
+// loop over its own products.
+thread_local int level_threads = 1;
+
+// OpenMP 2.0, the /openmp of MSVC, has no tasks: the seven products of a level are a parallel loop, nested in the
+// loop of the level above.
+void RunProducts(const std::function<void(std::size_t)>& product) {
+  const int team = std::min(level_threads, static_cast<int>(ppc::core::kStrassenProducts));
+  const int share = std::max(1, level_threads / team);
+#pragma omp parallel for num_threads(team) schedule(dynamic, 1)
+  for (int p = 0; p < static_cast<int>(ppc::core::kStrassenProducts); ++p) {
+    level_threads = share;
+    product(static_cast<std::size_t>(p));
+  }
+}
+
+}  // namespace
+
 bool StrassenOmp::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr_a = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -23,16 +48,11 @@ bool StrassenOmp::PreProcessingImpl() {
     input_matrix_b_[i] = in_ptr_b[i];
   }
 
-  if ((matrix_size_ & (matrix_size_ - 1)) != 0) {
-    original_size_ = matrix_size_;
-    input_matrix_a_ = PadMatrixToPowerOfTwo(input_matrix_a_, matrix_size_);
-    input_matrix_b_ = PadMatrixToPowerOfTwo(input_matrix_b_, matrix_size_);
-    matrix_size_ = static_cast<int>(std::sqrt(input_matrix_a_.size()));
-  } else {
-    original_size_ = matrix_size_;
-  }
-
   output_matrix_.resize(matrix_size_ * matrix_size_, 0.0);
+  const auto size = static_cast<std::size_t>(matrix_size_);
+  cutoff_ = ppc::core::StrassenWinogradCutoff();
+  depth_ = ppc::core::StrassenParallelDepth(omp_get_max_threads());
+  workspace_.resize(ppc::core::StrassenWinogradParallelWorkspaceSize(size, size, size, cutoff_, depth_));
   return true;
 }
 
@@ -49,15 +69,11 @@ bool StrassenOmp::ValidationImpl() {
 }
 
 bool StrassenOmp::RunImpl() {
-  output_matrix_ = StrassenMultiply(input_matrix_a_, input_matrix_b_, matrix_size_);
+  StrassenMultiply();
   return true;
 }
 
 bool StrassenOmp::PostProcessingImpl() {
-  if (original_size_ != matrix_size_) {
-    output_matrix_ = TrimMatrixToOriginalSize(output_matrix_, original_size_, matrix_size_);
-  }
-
   auto* out_ptr = reinterpret_cast<double*>(task_data->outputs[0]);
 #pragma omp parallel for
   for (int i = 0; i < static_cast<int>(output_matrix_.size()); i++) {
@@ -66,24 +82,6 @@ bool StrassenOmp::PostProcessingImpl() {
   return true;
 }
 
-std::vector<double> StrassenOmp::AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size) {
-  std::vector<double> result(size * size);
-#pragma omp parallel for
-  for (int i = 0; i < size * size; i++) {
-    result[i] = a[i] + b[i];
-  }
-  return result;
-}
-
-std::vector<double> StrassenOmp::SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b,
-                                                  int size) {
-  std::vector<double> result(size * size);
-#pragma omp parallel for
-  for (int i = 0; i < size * size; i++) {
-    result[i] = a[i] - b[i];
-  }
-  return result;
-}
 std::vector<double> StandardMultiply(const std::vector<double>& a, const std::vector<double>& b, int size) {
   std::vector<double> result(size * size, 0.0);
 #pragma omp parallel for
@@ -99,131 +97,15 @@ std::vector<double> StandardMultiply(const std::vector<double>& a, const std::ve
   return result;
 }
 
-std::vector<double> StrassenOmp::StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b,
-                                                  int size) {
-  if (size <= 32) {
-    return StandardMultiply(a, b, size);
-  }
-
-  int half_size = size / 2;
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
-
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
-
-#pragma omp parallel sections
-  {
-#pragma omp section
-    SplitMatrix(a, a11, 0, 0, size);
-#pragma omp section
-    SplitMatrix(a, a12, 0, half_size, size);
-#pragma omp section
-    SplitMatrix(a, a21, half_size, 0, size);
-#pragma omp section
-    SplitMatrix(a, a22, half_size, half_size, size);
-#pragma omp section
-    SplitMatrix(b, b11, 0, 0, size);
-#pragma omp section
-    SplitMatrix(b, b12, 0, half_size, size);
-#pragma omp section
-    SplitMatrix(b, b21, half_size, 0, size);
-#pragma omp section
-    SplitMatrix(b, b22, half_size, half_size, size);
-  }
-
-  std::vector<double> p1;
-  std::vector<double> p2;
-  std::vector<double> p3;
-  std::vector<double> p4;
-  std::vector<double> p5;
-  std::vector<double> p6;
-  std::vector<double> p7;
-
-#pragma omp parallel sections
-  {
-#pragma omp section
-    p1 = StrassenMultiply(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
-#pragma omp section
-    p2 = StrassenMultiply(AddMatrices(a21, a22, half_size), b11, half_size);
-#pragma omp section
-    p3 = StrassenMultiply(a11, SubtractMatrices(b12, b22, half_size), half_size);
-#pragma omp section
-    p4 = StrassenMultiply(a22, SubtractMatrices(b21, b11, half_size), half_size);
-#pragma omp section
-    p5 = StrassenMultiply(AddMatrices(a11, a12, half_size), b22, half_size);
-#pragma omp section
-    p6 = StrassenMultiply(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
-#pragma omp section
-    p7 = StrassenMultiply(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
-  }
-
-  std::vector<double> c11 = AddMatrices(SubtractMatrices(AddMatrices(p1, p4, half_size), p5, half_size), p7, half_size);
-  std::vector<double> c12 = AddMatrices(p3, p5, half_size);
-  std::vector<double> c21 = AddMatrices(p2, p4, half_size);
-  std::vector<double> c22 = AddMatrices(SubtractMatrices(AddMatrices(p1, p3, half_size), p2, half_size), p6, half_size);
-
-  std::vector<double> result(size * size);
-#pragma omp parallel sections
-  {
-#pragma omp section
-    MergeMatrix(result, c11, 0, 0, size);
-#pragma omp section
-    MergeMatrix(result, c12, 0, half_size, size);
-#pragma omp section
-    MergeMatrix(result, c21, half_size, 0, size);
-#pragma omp section
-    MergeMatrix(result, c22, half_size, half_size, size);
-  }
-
-  return result;
-}
-
-void StrassenOmp::SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(parent.begin() + (row_start + i) * parent_size + col_start,
-                      parent.begin() + (row_start + i) * parent_size + col_start + child_size,
-                      child.begin() + i * child_size);
-  }
-}
-
-void StrassenOmp::MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start,
-                              int col_start, int parent_size) {
-  int child_size = static_cast<int>(std::sqrt(child.size()));
-  for (int i = 0; i < child_size; ++i) {
-    std::ranges::copy(child.begin() + i * child_size, child.begin() + (i + 1) * child_size,
-                      parent.begin() + (row_start + i) * parent_size + col_start);
-  }
-}
-
-std::vector<double> StrassenOmp::PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size) {
-  int new_size = 1;
-  while (new_size < original_size) {
-    new_size *= 2;
-  }
-
-  std::vector<double> padded_matrix(new_size * new_size, 0);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * original_size, matrix.begin() + (i + 1) * original_size,
-                      padded_matrix.begin() + i * new_size);
-  }
-  return padded_matrix;
-}
-
-std::vector<double> StrassenOmp::TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
-                                                          int padded_size) {
-  std::vector<double> trimmed_matrix(original_size * original_size);
-  for (int i = 0; i < original_size; ++i) {
-    std::ranges::copy(matrix.begin() + i * padded_size, matrix.begin() + i * padded_size + original_size,
-                      trimmed_matrix.begin() + i * original_size);
-  }
-  return trimmed_matrix;
+// The top levels of the Strassen-Winograd recursion hand their seven products to parallel workers, as many levels
+// as it takes to give every thread work; each product recurses in its own slice of the workspace.
+void StrassenOmp::StrassenMultiply() {
+  const auto size = static_cast<std::size_t>(matrix_size_);
+  level_threads = omp_get_max_threads();
+  const int nested = ppc::util::AllowNestedRegions(static_cast<int>(depth_));
+  ppc::core::StrassenWinogradParallel(size, size, size, input_matrix_a_.data(), size, input_matrix_b_.data(), size,
+                                      output_matrix_.data(), size, workspace_.data(), cutoff_, depth_, RunProducts);
+  ppc::util::RestoreNestedRegions(nested);
 }
 
 }  // namespace nasedkin_e_strassen_algorithm_omp
\ No newline at end of file
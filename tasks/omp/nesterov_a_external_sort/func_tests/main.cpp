@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <ios>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "omp/nesterov_a_external_sort/include/ops_omp.hpp"
+
+namespace {
+template <typename T>
+void WriteVec(const std::string &path, const std::vector<T> &data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+
+template <typename T>
+std::vector<T> ReadVec(const std::string &path) {
+  std::vector<T> data(std::filesystem::file_size(path) / sizeof(T));
+  std::ifstream in(path, std::ios::binary);
+  in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+  return data;
+}
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / ("nesterov_a_external_sort_omp_" + name)).string();
+}
+
+ppc::core::TaskDataPtr CreateTaskData(std::string &input_path, std::size_t &budget, std::string &output_path) {
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_path.data()));
+  task_data_omp->inputs_count.emplace_back(input_path.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data_omp->inputs_count.emplace_back(1);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_path.data()));
+  task_data_omp->outputs_count.emplace_back(output_path.size());
+  return task_data_omp;
+}
+
+template <typename T>
+void RunAndCheck(const std::string &name, std::vector<T> in, std::size_t budget) {
+  std::string input_path = TempPath(name + ".in");
+  std::string output_path = TempPath(name + ".out");
+  WriteVec(input_path, in);
+
+  auto task_data_omp = CreateTaskData(input_path, budget, output_path);
+  nesterov_a_external_sort_omp::ExternalSortOpenMP<T> test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  ASSERT_TRUE(test_task_omp.PreProcessing());
+  ASSERT_TRUE(test_task_omp.Run());
+  ASSERT_TRUE(test_task_omp.PostProcessing());
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, ReadVec<T>(output_path));
+
+  for (const auto &entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+    EXPECT_EQ(entry.path().string().find(output_path + ".run"), std::string::npos);
+  }
+  std::filesystem::remove(input_path);
+  std::filesystem::remove(output_path);
+}
+
+std::vector<int> GenRandVec(std::size_t size, int min, int max) {
+  std::mt19937 gen(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<int> vec(size);
+  std::ranges::generate(vec, [&] { return dist(gen); });
+  return vec;
+}
+
+constexpr std::size_t kSmallBudget = nesterov_a_external_sort_omp::ExternalSortOpenMP<int>::kMinMemoryBudget;
+}  // namespace
+
+TEST(nesterov_a_external_sort_omp, test_empty_file) { RunAndCheck("empty", std::vector<int>{}, kSmallBudget); }
+
+TEST(nesterov_a_external_sort_omp, test_fits_into_memory) {
+  RunAndCheck("fits", GenRandVec(5000, -1000, 1000), std::size_t{1} << 24);
+}
+
+TEST(nesterov_a_external_sort_omp, test_few_runs) { RunAndCheck("few", GenRandVec(20000, -100000, 100000), 1 << 18); }
+
+TEST(nesterov_a_external_sort_omp, test_multi_pass_merge) {
+  RunAndCheck("multi_pass", GenRandVec(300000, -1000000, 1000000), kSmallBudget);
+}
+
+TEST(nesterov_a_external_sort_omp, test_duplicates) { RunAndCheck("dups", GenRandVec(100000, 0, 5), kSmallBudget); }
+
+TEST(nesterov_a_external_sort_omp, test_reverse_sorted) {
+  auto in = GenRandVec(100000, -100000, 100000);
+  std::ranges::sort(in, std::greater<>());
+  RunAndCheck("reverse", in, kSmallBudget);
+}
+
+TEST(nesterov_a_external_sort_omp, test_int64) {
+  std::mt19937_64 gen(3);
+  std::vector<std::int64_t> in(60000);
+  std::ranges::generate(in, [&] { return static_cast<std::int64_t>(gen()); });
+  RunAndCheck("int64", in, kSmallBudget);
+}
+
+TEST(nesterov_a_external_sort_omp, test_double) {
+  std::mt19937 gen(4);
+  std::uniform_real_distribution<double> dist(-1e3, 1e3);
+  std::vector<double> in(60000);
+  std::ranges::generate(in, [&] { return dist(gen); });
+  RunAndCheck("double", in, kSmallBudget);
+}
+
+TEST(nesterov_a_external_sort_omp, test_budget_too_small) {
+  std::string input_path = TempPath("small_budget.in");
+  std::string output_path = TempPath("small_budget.out");
+  WriteVec(input_path, GenRandVec(100, 0, 10));
+  std::size_t budget = kSmallBudget - 1;
+
+  auto task_data_omp = CreateTaskData(input_path, budget, output_path);
+  nesterov_a_external_sort_omp::ExternalSortOpenMP<int> test_task_omp(task_data_omp);
+  EXPECT_FALSE(test_task_omp.Validation());
+  std::filesystem::remove(input_path);
+}
+
+TEST(nesterov_a_external_sort_omp, test_missing_input_file) {
+  std::string input_path = TempPath("missing.in");
+  std::string output_path = TempPath("missing.out");
+  std::size_t budget = kSmallBudget;
+
+  auto task_data_omp = CreateTaskData(input_path, budget, output_path);
+  nesterov_a_external_sort_omp::ExternalSortOpenMP<int> test_task_omp(task_data_omp);
+  EXPECT_FALSE(test_task_omp.Validation());
+}
+
+TEST(nesterov_a_external_sort_omp, test_unreadable_input_file) {
+  std::string input_path = TempPath("unreadable.in");
+  std::string output_path = TempPath("unreadable.out");
+  WriteVec(input_path, GenRandVec(20000, -1000, 1000));
+  std::size_t budget = kSmallBudget;
+
+  auto task_data_omp = CreateTaskData(input_path, budget, output_path);
+  nesterov_a_external_sort_omp::ExternalSortOpenMP<int> test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  ASSERT_TRUE(test_task_omp.PreProcessing());
+  // the input is a directory by the time it is read
+  std::filesystem::remove(input_path);
+  std::filesystem::create_directory(input_path);
+  EXPECT_FALSE(test_task_omp.Run());
+
+  for (const auto &entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+    EXPECT_EQ(entry.path().string().find(output_path + ".run"), std::string::npos);
+  }
+  EXPECT_FALSE(std::filesystem::exists(output_path));
+  std::filesystem::remove(input_path);
+}
+
+TEST(nesterov_a_external_sort_omp, test_unwritable_output_file) {
+  std::string input_path = TempPath("unwritable.in");
+  std::string output_path = TempPath("missing_dir") + "/unwritable.out";
+  WriteVec(input_path, GenRandVec(20000, -1000, 1000));
+  std::size_t budget = kSmallBudget;
+
+  auto task_data_omp = CreateTaskData(input_path, budget, output_path);
+  nesterov_a_external_sort_omp::ExternalSortOpenMP<int> test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  ASSERT_TRUE(test_task_omp.PreProcessing());
+  EXPECT_FALSE(test_task_omp.Run());
+  std::filesystem::remove(input_path);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_external_sort_omp {
+
+// Sorts a raw binary file of T that does not have to fit into memory.
+// inputs[0]  - path of the input file (chars, inputs_count[0] is the path length)
+// inputs[1]  - memory budget in bytes (one std::size_t)
+// outputs[0] - path of the output file (chars, outputs_count[0] is the path length)
+// Runs that fit into the budget are sorted with the parallel sample sort and spilled next to the output
+// file, then merged in parallel: every thread merges its own key range of all runs with prefetched reads.
+template <typename T>
+class ExternalSortOpenMP : public ppc::core::Task {
+ public:
+  explicit ExternalSortOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // smallest budget that still leaves room for reasonably sized I/O blocks
+  static constexpr std::size_t kMinMemoryBudget = std::size_t{1} << 16;
+
+ private:
+  std::vector<std::string> GenerateRuns(int num_threads);
+  void MergeRuns(const std::vector<std::string>& runs, const std::string& destination, int num_threads) const;
+
+  std::string input_path_, output_path_;
+  std::size_t memory_budget_{};
+};
+
+}  // namespace nesterov_a_external_sort_omp
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/nesterov_a_external_sort/include/ops_omp.hpp"
+
+namespace {
+constexpr int kCount = 4000000;
+// a quarter of the input size, so the sort has to spill and merge several runs
+constexpr std::size_t kBudget = kCount * sizeof(int) / 4;
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / ("nesterov_a_external_sort_omp_perf_" + name)).string();
+}
+
+std::vector<int> PrepareInput(const std::string &path) {
+  std::mt19937 gen(kCount);
+  std::uniform_int_distribution<int> dist(-1000000, 1000000);
+  std::vector<int> vec(kCount);
+  std::ranges::generate(vec, [&] { return dist(gen); });
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(vec.data()), static_cast<std::streamsize>(vec.size() * sizeof(int)));
+  return vec;
+}
+
+std::vector<int> ReadOutput(const std::string &path) {
+  std::vector<int> data(std::filesystem::file_size(path) / sizeof(int));
+  std::ifstream in(path, std::ios::binary);
+  in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+}  // namespace
+
+TEST(nesterov_a_external_sort_omp, test_pipeline_run) {
+  std::string input_path = TempPath("pipeline.in");
+  std::string output_path = TempPath("pipeline.out");
+  std::size_t budget = kBudget;
+  std::vector<int> in = PrepareInput(input_path);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_path.data()));
+  task_data_omp->inputs_count.emplace_back(input_path.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data_omp->inputs_count.emplace_back(1);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_path.data()));
+  task_data_omp->outputs_count.emplace_back(output_path.size());
+
+  auto test_task_omp = std::make_shared<nesterov_a_external_sort_omp::ExternalSortOpenMP<int>>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::ranges::sort(in);
+  ASSERT_EQ(in, ReadOutput(output_path));
+  std::filesystem::remove(input_path);
+  std::filesystem::remove(output_path);
+}
+
+TEST(nesterov_a_external_sort_omp, test_task_run) {
+  std::string input_path = TempPath("task.in");
+  std::string output_path = TempPath("task.out");
+  std::size_t budget = kBudget;
+  std::vector<int> in = PrepareInput(input_path);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(input_path.data()));
+  task_data_omp->inputs_count.emplace_back(input_path.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data_omp->inputs_count.emplace_back(1);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(output_path.data()));
+  task_data_omp->outputs_count.emplace_back(output_path.size());
+
+  auto test_task_omp = std::make_shared<nesterov_a_external_sort_omp::ExternalSortOpenMP<int>>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::ranges::sort(in);
+  ASSERT_EQ(in, ReadOutput(output_path));
+  std::filesystem::remove(input_path);
+  std::filesystem::remove(output_path);
+}
@@ -0,0 +1,444 @@
+#include "omp/nesterov_a_external_sort/include/ops_omp.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <ios>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+#include "omp/nesterov_a_sample_sort/include/ops_omp.hpp"
+
+namespace {
+
+constexpr std::size_t kMinBlockElements = 1024;
+constexpr std::size_t kSamplesPerPartition = 32;
+
+std::string RunPath(const std::string& output_path, std::size_t pass, std::size_t index) {
+  return output_path + ".run" + std::to_string(pass) + "_" + std::to_string(index);
+}
+
+// Removes the runs spilled next to output_path by earlier passes, whatever state they were left in.
+void RemoveRuns(const std::string& output_path) {
+  const std::filesystem::path output(output_path);
+  const std::string prefix = output.filename().string() + ".run";
+  const std::filesystem::path dir = output.has_parent_path() ? output.parent_path() : std::filesystem::path(".");
+  std::error_code error;
+  std::vector<std::filesystem::path> runs;
+  for (std::filesystem::directory_iterator it(dir, error), end; !error && it != end; it.increment(error)) {
+    if (it->path().filename().string().starts_with(prefix)) {
+      runs.push_back(it->path());
+    }
+  }
+  for (const auto& run : runs) {
+    std::filesystem::remove(run, error);
+  }
+}
+
+// The helpers below throw std::runtime_error when a stream fails, and RunImpl turns that into a failed run.
+template <typename T>
+std::size_t FileElements(const std::string& path) {
+  return static_cast<std::size_t>(std::filesystem::file_size(path)) / sizeof(T);
+}
+
+std::ifstream OpenForReading(const std::string& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  return in;
+}
+
+// Reads up to count elements; fewer are returned only at the end of the file.
+template <typename T>
+std::vector<T> ReadChunk(std::ifstream& in, std::vector<T> buffer, std::size_t count) {
+  buffer.resize(count);
+  in.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(count * sizeof(T)));
+  if (in.bad()) {
+    throw std::runtime_error("read error");
+  }
+  buffer.resize(static_cast<std::size_t>(in.gcount()) / sizeof(T));
+  return buffer;
+}
+
+template <typename T>
+void WriteFile(const std::string& path, const std::vector<T>& data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+  out.close();
+  if (!out) {
+    throw std::runtime_error("cannot write " + path);
+  }
+}
+
+template <typename T>
+T ReadAt(std::ifstream& in, std::size_t index) {
+  T value{};
+  in.seekg(static_cast<std::streamoff>(index * sizeof(T)));
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  if (in.gcount() != static_cast<std::streamsize>(sizeof(T))) {
+    throw std::runtime_error("short read");
+  }
+  return value;
+}
+
+template <typename T>
+std::size_t LowerBoundInFile(std::ifstream& in, std::size_t size, const T& key) {
+  std::size_t lo = 0;
+  std::size_t hi = size;
+  while (lo < hi) {
+    const std::size_t mid = lo + ((hi - lo) / 2);
+    if (ReadAt<T>(in, mid) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+// Sequential reader over [begin, end) of a run file; the next block is read in the background
+// while the current one is being consumed.
+template <typename T>
+class RunReader {
+ public:
+  RunReader(const std::string& path, std::size_t begin, std::size_t end, std::size_t block)
+      : file_(OpenForReading(path)), pos_(begin), end_(end), block_(block) {
+    file_.seekg(static_cast<std::streamoff>(begin * sizeof(T)));
+    Prefetch(std::vector<T>{});
+    Advance();
+  }
+
+  RunReader(const RunReader&) = delete;
+  RunReader& operator=(const RunReader&) = delete;
+  RunReader(RunReader&&) = delete;
+  RunReader& operator=(RunReader&&) = delete;
+  ~RunReader() = default;
+
+  [[nodiscard]] bool Empty() const { return cur_ == buf_.size(); }
+  [[nodiscard]] const T& Front() const { return buf_[cur_]; }
+  void Pop() {
+    if (++cur_ == buf_.size()) {
+      Advance();
+    }
+  }
+
+ private:
+  void Prefetch(std::vector<T> spare) {
+    const std::size_t count = std::min(block_, end_ - pos_);
+    pos_ += count;
+    next_ = std::async(std::launch::async, [this, count, spare = std::move(spare)]() mutable {
+      std::vector<T> chunk = ReadChunk(file_, std::move(spare), count);
+      // the bounds come from the file sizes, so a run always holds every element asked for
+      if (chunk.size() != count) {
+        throw std::runtime_error("short read");
+      }
+      return chunk;
+    });
+  }
+
+  void Advance() {
+    std::vector<T> spare = std::move(buf_);
+    buf_ = next_.get();
+    cur_ = 0;
+    if (!buf_.empty()) {
+      Prefetch(std::move(spare));
+    }
+  }
+
+  std::ifstream file_;
+  std::size_t pos_, end_, block_;
+  std::vector<T> buf_;
+  std::size_t cur_ = 0;
+  std::future<std::vector<T>> next_;
+};
+
+// Writes consecutive elements starting at a given offset of an already sized file; full blocks
+// are flushed in the background.
+template <typename T>
+class BlockWriter {
+ public:
+  BlockWriter(const std::string& path, std::size_t offset, std::size_t block)
+      : file_(path, std::ios::binary | std::ios::in | std::ios::out), block_(block) {
+    if (!file_) {
+      throw std::runtime_error("cannot open " + path);
+    }
+    file_.seekp(static_cast<std::streamoff>(offset * sizeof(T)));
+    buf_.reserve(block_);
+  }
+
+  void Push(const T& value) {
+    buf_.push_back(value);
+    if (buf_.size() == block_) {
+      Flush();
+    }
+  }
+
+  void Finish() {
+    Flush();
+    if (pending_.valid()) {
+      pending_.get();
+    }
+    file_.close();
+    if (!file_) {
+      throw std::runtime_error("write error");
+    }
+  }
+
+ private:
+  void Flush() {
+    std::vector<T> spare;
+    if (pending_.valid()) {
+      spare = pending_.get();
+    }
+    if (buf_.empty()) {
+      return;
+    }
+    pending_ = std::async(std::launch::async, [this, data = std::move(buf_)]() mutable {
+      file_.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+      if (!file_) {
+        throw std::runtime_error("write error");
+      }
+      data.clear();
+      return std::move(data);
+    });
+    buf_ = std::move(spare);
+    buf_.reserve(block_);
+  }
+
+  std::ofstream file_;
+  std::size_t block_;
+  std::vector<T> buf_;
+  std::future<std::vector<T>> pending_;
+};
+
+// Keys of all runs that are used to cut the merge into independent key ranges.
+template <typename T>
+std::vector<T> PickSplitters(const std::vector<std::string>& runs, const std::vector<std::size_t>& sizes,
+                             std::size_t partitions) {
+  std::vector<T> sample;
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    std::ifstream in = OpenForReading(runs[r]);
+    const std::size_t count = std::min(sizes[r], partitions * kSamplesPerPartition);
+    for (std::size_t j = 0; j < count; ++j) {
+      sample.push_back(ReadAt<T>(in, (j * sizes[r]) / count));
+    }
+  }
+  std::ranges::sort(sample);
+
+  std::vector<T> splitters;
+  for (std::size_t i = 1; i < partitions && !sample.empty(); ++i) {
+    splitters.push_back(sample[(i * sample.size()) / partitions]);
+  }
+  return splitters;
+}
+
+// Merges key range [first[r], last[r]) of every run r into destination, starting at element offset.
+template <typename T>
+void MergeRange(const std::vector<std::string>& runs, const std::size_t* first, const std::size_t* last,
+                const std::string& destination, std::size_t offset, std::size_t block) {
+  std::vector<std::unique_ptr<RunReader<T>>> readers;
+  using Head = std::pair<T, std::size_t>;
+  std::priority_queue<Head, std::vector<Head>, std::greater<>> heads;
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    readers.push_back(std::make_unique<RunReader<T>>(runs[r], first[r], last[r], block));
+    if (!readers.back()->Empty()) {
+      heads.emplace(readers.back()->Front(), r);
+    }
+  }
+
+  BlockWriter<T> writer(destination, offset, block);
+  while (!heads.empty()) {
+    const std::size_t r = heads.top().second;
+    writer.Push(heads.top().first);
+    heads.pop();
+    readers[r]->Pop();
+    if (!readers[r]->Empty()) {
+      heads.emplace(readers[r]->Front(), r);
+    }
+  }
+  writer.Finish();
+}
+
+}  // namespace
+
+template <typename T>
+std::vector<std::string> nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::GenerateRuns(int num_threads) {
+  // a run is read, sorted (sample sort keeps a second copy and a 32-bit bucket id per key) and written
+  // concurrently with reading the next one
+  const std::size_t run_elements =
+      std::max(kMinBlockElements, memory_budget_ / ((4 * sizeof(T)) + sizeof(std::uint32_t)));
+
+  std::ifstream in = OpenForReading(input_path_);
+  std::vector<std::string> runs;
+  std::size_t read = 0;
+  auto next = std::async(std::launch::async, [&] { return ReadChunk(in, std::vector<T>{}, run_elements); });
+  std::future<void> pending_write;
+  while (true) {
+    std::vector<T> chunk = next.get();
+    if (chunk.empty()) {
+      break;
+    }
+    read += chunk.size();
+    next = std::async(std::launch::async, [&] { return ReadChunk(in, std::vector<T>{}, run_elements); });
+
+    nesterov_a_sample_sort_omp::SampleSortOpenMP<T>::Sort(chunk, num_threads);
+
+    if (pending_write.valid()) {
+      pending_write.get();
+    }
+    runs.push_back(RunPath(output_path_, 0, runs.size()));
+    pending_write = std::async(std::launch::async, [path = runs.back(), data = std::move(chunk)] {
+      WriteFile(path, data);
+    });
+  }
+  if (pending_write.valid()) {
+    pending_write.get();
+  }
+  if (read != FileElements<T>(input_path_)) {
+    throw std::runtime_error("short read of " + input_path_);
+  }
+  return runs;
+}
+
+template <typename T>
+void nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::MergeRuns(const std::vector<std::string>& runs,
+                                                                    const std::string& destination,
+                                                                    int num_threads) const {
+  std::vector<std::size_t> sizes(runs.size());
+  std::size_t total = 0;
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    sizes[r] = FileElements<T>(runs[r]);
+    total += sizes[r];
+  }
+  if (!std::ofstream(destination, std::ios::binary | std::ios::trunc)) {
+    throw std::runtime_error("cannot create " + destination);
+  }
+  std::filesystem::resize_file(destination, total * sizeof(T));
+
+  const std::size_t partitions =
+      std::clamp<std::size_t>(total / kMinBlockElements, 1, static_cast<std::size_t>(num_threads));
+  // every merging thread double-buffers each of its readers and its writer
+  const std::size_t block = std::max(
+      kMinBlockElements, memory_budget_ / (sizeof(T) * partitions * ((2 * runs.size()) + 2)));
+
+  const auto splitters = PickSplitters<T>(runs, sizes, partitions);
+  // bounds[(i * runs.size()) + r] is where key range i starts inside run r
+  std::vector<std::size_t> bounds((partitions + 1) * runs.size());
+  for (std::size_t r = 0; r < runs.size(); ++r) {
+    std::ifstream in = OpenForReading(runs[r]);
+    bounds[r] = 0;
+    for (std::size_t i = 1; i < partitions; ++i) {
+      bounds[(i * runs.size()) + r] = LowerBoundInFile(in, sizes[r], splitters[i - 1]);
+    }
+    bounds[(partitions * runs.size()) + r] = sizes[r];
+  }
+
+  // an exception must not leave the parallel region, so failures are collected and rethrown after it
+  std::atomic<bool> failed{false};
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+  for (int i = 0; i < static_cast<int>(partitions); ++i) {
+    const std::size_t* first = &bounds[i * runs.size()];
+    const std::size_t* last = &bounds[(i + 1) * runs.size()];
+
+    std::size_t offset = 0;
+    for (std::size_t r = 0; r < runs.size(); ++r) {
+      offset += first[r];
+    }
+    try {
+      MergeRange<T>(runs, first, last, destination, offset, block);
+    } catch (const std::runtime_error&) {
+      failed = true;
+    }
+  }
+  if (failed) {
+    throw std::runtime_error("cannot merge into " + destination);
+  }
+}
+
+template <typename T>
+bool nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::PreProcessingImpl() {
+  input_path_.assign(reinterpret_cast<const char*>(task_data->inputs[0]), task_data->inputs_count[0]);
+  output_path_.assign(reinterpret_cast<const char*>(task_data->outputs[0]), task_data->outputs_count[0]);
+  memory_budget_ = *reinterpret_cast<std::size_t*>(task_data->inputs[1]);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::ValidationImpl() {
+  if (task_data->inputs.size() != 2 || task_data->inputs_count.size() != 2 || task_data->outputs.size() != 1 ||
+      task_data->outputs_count.size() != 1 || task_data->inputs_count[1] != 1) {
+    return false;
+  }
+  const std::string input_path(reinterpret_cast<const char*>(task_data->inputs[0]), task_data->inputs_count[0]);
+  const std::size_t budget = *reinterpret_cast<std::size_t*>(task_data->inputs[1]);
+  return task_data->outputs_count[0] != 0 && std::filesystem::is_regular_file(input_path) &&
+         std::filesystem::file_size(input_path) % sizeof(T) == 0 && budget >= kMinMemoryBudget;
+}
+
+template <typename T>
+bool nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::RunImpl() {
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  try {
+    std::vector<std::string> runs = GenerateRuns(num_threads);
+
+    // the merge is done in several passes when the budget cannot hold a reasonable block for every run
+    const std::size_t blocks_per_thread = memory_budget_ / (sizeof(T) * num_threads * kMinBlockElements);
+    const std::size_t max_fan_in = std::max<std::size_t>(2, blocks_per_thread > 2 ? (blocks_per_thread - 2) / 2 : 0);
+    for (std::size_t pass = 1; runs.size() > max_fan_in; ++pass) {
+      std::vector<std::string> merged;
+      for (std::size_t first = 0; first < runs.size(); first += max_fan_in) {
+        const std::vector<std::string> group(runs.begin() + static_cast<std::ptrdiff_t>(first),
+                                             runs.begin() + static_cast<std::ptrdiff_t>(
+                                                                std::min(runs.size(), first + max_fan_in)));
+        merged.push_back(RunPath(output_path_, pass, merged.size()));
+        MergeRuns(group, merged.back(), num_threads);
+        for (const auto& run : group) {
+          std::filesystem::remove(run);
+        }
+      }
+      runs = std::move(merged);
+    }
+
+    if (runs.empty()) {
+      if (!std::ofstream(output_path_, std::ios::binary | std::ios::trunc)) {
+        throw std::runtime_error("cannot create " + output_path_);
+      }
+    } else if (runs.size() == 1) {
+      std::filesystem::rename(runs.front(), output_path_);
+    } else {
+      MergeRuns(runs, output_path_, num_threads);
+      for (const auto& run : runs) {
+        std::filesystem::remove(run);
+      }
+    }
+  } catch (const std::runtime_error&) {
+    // file system errors are std::runtime_errors too; no run or partial output is left behind
+    RemoveRuns(output_path_);
+    std::error_code ignored;
+    std::filesystem::remove(output_path_, ignored);
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_external_sort_omp::ExternalSortOpenMP<T>::PostProcessingImpl() {
+  // the result is written straight into the output file during Run
+  return true;
+}
+
+template class nesterov_a_external_sort_omp::ExternalSortOpenMP<int>;
+template class nesterov_a_external_sort_omp::ExternalSortOpenMP<std::int64_t>;
+template class nesterov_a_external_sort_omp::ExternalSortOpenMP<double>;
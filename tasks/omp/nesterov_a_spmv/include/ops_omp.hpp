@@ -0,0 +1,32 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_spmv_omp {
+
+// y = A * x for a sparse matrix A of doubles. inputs[0] holds A as a CSR matrix in the binary format of
+// core/sparse_io (inputs_count[0] is its size in bytes), inputs[1] holds the cols entries of x and outputs[0] receives
+// the rows entries of y. PreProcessing builds the storage picked at construction, so Run only multiplies and may be
+// repeated to time the kernel on its own. Threads take ranges of rows, or of SELL slices, holding about equal
+// numbers of entries.
+class SpmvOpenMP : public ppc::core::Task {
+ public:
+  explicit SpmvOpenMP(ppc::core::TaskDataPtr task_data, ppc::core::SpmvFormat format = ppc::core::SpmvFormat::kCsr)
+      : Task(std::move(task_data)), format_(format) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  ppc::core::SpmvFormat format_;
+  ppc::core::CsrMatrix<double> csr_;
+  ppc::core::SellMatrix<double> sell_;
+  std::vector<double> x_, y_;
+};
+
+}  // namespace nesterov_a_spmv_omp
@@ -0,0 +1,74 @@
+#include "omp/nesterov_a_spmv/include/ops_omp.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Rows of a SELL slice and the window they are sorted in: eight doubles fill an AVX-512 register or two AVX2 ones.
+constexpr int kSellChunk = 8;
+constexpr int kSellSigma = 256;
+
+bool OpenCsr(const uint8_t *data, std::size_t size, ppc::core::SparseFileView<double> &view) {
+  try {
+    view = ppc::core::SparseFileView<double>(reinterpret_cast<const std::byte *>(data), size);
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+  return view.Layout() == ppc::core::SparseLayout::kCsr;
+}
+
+}  // namespace
+
+bool nesterov_a_spmv_omp::SpmvOpenMP::PreProcessingImpl() {
+  const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+  ppc::core::SparseFileView<double> view;
+  if (!OpenCsr(task_data->inputs[0], task_data->inputs_count[0], view)) {
+    return false;
+  }
+  csr_ = view.ToCsr();
+  if (format_ == ppc::core::SpmvFormat::kSell) {
+    sell_ = ppc::core::SellMatrix<double>::FromCsr(csr_, kSellChunk, kSellSigma, parts, ppc::core::OmpPartRunner());
+    csr_ = {};
+  }
+  const auto *x = reinterpret_cast<const double *>(task_data->inputs[1]);
+  x_.assign(x, x + task_data->inputs_count[1]);
+  y_.assign(task_data->outputs_count[0], 0.0);
+  return true;
+}
+
+bool nesterov_a_spmv_omp::SpmvOpenMP::ValidationImpl() {
+  if (task_data->inputs.size() != 2 || task_data->inputs_count.size() != 2 || task_data->outputs.size() != 1 ||
+      task_data->outputs_count.size() != 1) {
+    return false;
+  }
+  // The whole encoding is checked, not just its header, since PreProcessing reads all of its arrays
+  ppc::core::SparseFileView<double> view;
+  return OpenCsr(task_data->inputs[0], task_data->inputs_count[0], view) &&
+         static_cast<std::size_t>(view.Cols()) == task_data->inputs_count[1] &&
+         static_cast<std::size_t>(view.Rows()) == task_data->outputs_count[0];
+}
+
+bool nesterov_a_spmv_omp::SpmvOpenMP::RunImpl() {
+  const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+  if (format_ == ppc::core::SpmvFormat::kSell) {
+    sell_.MultiplyVector(x_.data(), y_.data(), parts, ppc::core::OmpPartRunner());
+  } else {
+    csr_.MultiplyVector(x_.data(), y_.data(), parts, ppc::core::OmpPartRunner());
+  }
+  return true;
+}
+
+bool nesterov_a_spmv_omp::SpmvOpenMP::PostProcessingImpl() {
+  std::ranges::copy(y_, reinterpret_cast<double *>(task_data->outputs[0]));
+  return true;
+}
@@ -54,7 +54,7 @@ class HoareSortTest : public testing::TestWithParam<size_t> {
 TEST_P(HoareSortTest, sort_test) { CreateTest(GetParam()); }
 
 INSTANTIATE_TEST_SUITE_P(nikolaev_r_hoare_sort_simple_merge_omp, HoareSortTest,
-                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000));
+                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000, 300000));
 
 }  // namespace
 
@@ -119,4 +119,80 @@ TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_input_and_output_sizes_not_equ
 
   nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP hoare_sort_simple_merge_omp(task_data_omp);
   ASSERT_FALSE(hoare_sort_simple_merge_omp.Validation());
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_few_ascending_runs) {
+  std::vector<double> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<double>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP hoare_sort_simple_merge_omp(task_data_omp);
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.Validation());
+  hoare_sort_simple_merge_omp.PreProcessing();
+  hoare_sort_simple_merge_omp.Run();
+  hoare_sort_simple_merge_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_non_increasing) {
+  std::vector<double> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<double>(500 - (i / 3));
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP hoare_sort_simple_merge_omp(task_data_omp);
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.Validation());
+  hoare_sort_simple_merge_omp.PreProcessing();
+  hoare_sort_simple_merge_omp.Run();
+  hoare_sort_simple_merge_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_omp, test_few_unique_values) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dis(0, 3);
+  std::vector<double> in(200000);
+  for (auto &x : in) {
+    x = dis(gen);
+  }
+  std::vector<double> out(in.size(), 0.0);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP hoare_sort_simple_merge_omp(task_data_omp);
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.Validation());
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.PreProcessing());
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.Run());
+  ASSERT_TRUE(hoare_sort_simple_merge_omp.PostProcessing());
+
+  std::vector<double> ref(in.size());
+  std::ranges::copy(in, ref.begin());
+  std::ranges::sort(ref);
+
+  EXPECT_EQ(out, ref);
+}
@@ -3,11 +3,44 @@
 #include <omp.h>
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <functional>
 #include <random>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/util/include/omp_nesting.hpp"
+
+namespace {
+
+constexpr std::size_t kParallelPartitionThreshold = 1 << 16;
+
+std::minstd_rand &PivotGenerator() {
+  thread_local std::minstd_rand gen(std::random_device{}());
+  return gen;
+}
+
+int DepthLimit(std::size_t n) { return 2 * static_cast<int>(std::bit_width(n)); }
+
+double MedianOfThree(const double *first, std::size_t n) {
+  std::uniform_int_distribution<std::size_t> dist(0, n - 1);
+  const double a = first[dist(PivotGenerator())];
+  const double b = first[dist(PivotGenerator())];
+  const double c = first[dist(PivotGenerator())];
+  return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+// Gives every part of a block partition a thread of a team nested in the region of the calling range.
+void RunOnNestedTeam(std::size_t parts, const std::function<void(std::size_t)> &part) {
+#pragma omp parallel num_threads(static_cast<int>(parts))
+  part(static_cast<std::size_t>(omp_get_thread_num()));
+}
+
+}  // namespace
+
 bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -22,70 +55,14 @@ bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::Validat
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::RunImpl() {
-  int num_threads = omp_get_max_threads();
-  if (vect_size_ < static_cast<size_t>(num_threads)) {
-    num_threads = static_cast<int>(vect_size_);
-  }
-
-  std::vector<std::pair<size_t, size_t>> segments;
-  segments.reserve(num_threads);
-
-  size_t seg_size = vect_size_ / num_threads;
-  size_t remainder = vect_size_ % num_threads;
-  size_t start = 0;
-  for (int i = 0; i < num_threads; ++i) {
-    size_t extra = (i < static_cast<int>(remainder) ? 1 : 0);
-    size_t end = start + seg_size + extra - 1;
-    segments.emplace_back(start, end);
-    start = end + 1;
-  }
-
-#pragma omp parallel for schedule(static)
-  for (int i = 0; i < static_cast<int>(segments.size()); i++) {
-    QuickSort(segments[i].first, segments[i].second);
-  }
-
-  while (segments.size() > 1) {
-    size_t num_pairs = segments.size() / 2;
-    std::vector<std::pair<size_t, size_t>> new_segments;
-    new_segments.resize(num_pairs);
-
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < static_cast<int>(num_pairs); i++) {
-      size_t left_start = segments[2 * i].first;
-      size_t left_end = segments[2 * i].second;
-
-      size_t right_start = segments[(2 * i) + 1].first;
-      size_t right_end = segments[(2 * i) + 1].second;
-
-      size_t merged_size = right_end - left_start + 1;
-      std::vector<double> merged(merged_size);
-
-      size_t i1 = left_start;
-      size_t i2 = right_start;
-      size_t k = 0;
-      while (i1 <= left_end && i2 <= right_end) {
-        if (vect_[i1] < vect_[i2]) {
-          merged[k++] = vect_[i1++];
-        } else {
-          merged[k++] = vect_[i2++];
-        }
-      }
-      while (i1 <= left_end) {
-        merged[k++] = vect_[i1++];
-      }
-      while (i2 <= right_end) {
-        merged[k++] = vect_[i2++];
-      }
-
-      std::ranges::copy(merged, vect_.begin() + static_cast<std::ptrdiff_t>(left_start));
-      new_segments[i] = {left_start, right_end};
-    }
-    if (segments.size() % 2 == 1) {
-      new_segments.push_back(segments.back());
-    }
-    segments.swap(new_segments);
+  if (ppc::core::SortIfPresorted(vect_, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner())) {
+    return true;
   }
+  const int num_threads = omp_get_max_threads();
+  // Every split of the workers nests one more region, so there are at most as many levels as threads
+  const int nested = ppc::util::AllowNestedRegions(num_threads);
+  ParallelQuickSort(0, vect_size_ - 1, num_threads, DepthLimit(vect_size_));
+  ppc::util::RestoreNestedRegions(nested);
   return true;
 }
 
@@ -97,11 +74,8 @@ bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::PostPro
 }
 
 size_t nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::Partition(size_t low, size_t high) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(static_cast<int>(low), static_cast<int>(high));
-
-  size_t random_pivot_index = dist(gen);
+  std::uniform_int_distribution<size_t> dist(low, high);
+  size_t random_pivot_index = dist(PivotGenerator());
   double pivot = vect_[random_pivot_index];
 
   std::swap(vect_[random_pivot_index], vect_[low]);
@@ -122,9 +96,51 @@ void nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::QuickSo
   if (low >= high) {
     return;
   }
+  IntroSort(low, high, DepthLimit(high - low + 1));
+}
+
+void nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::IntroSort(size_t low, size_t high, int depth) {
+  if (low >= high) {
+    return;
+  }
+  if (depth == 0) {
+    // Too many unbalanced partitions on this path: finish the range with heapsort
+    const auto first = vect_.begin() + static_cast<std::ptrdiff_t>(low);
+    const auto last = vect_.begin() + static_cast<std::ptrdiff_t>(high) + 1;
+    std::make_heap(first, last);
+    std::sort_heap(first, last);
+    return;
+  }
   size_t pivot = Partition(low, high);
   if (pivot > low) {
-    QuickSort(low, pivot - 1);
+    IntroSort(low, pivot - 1, depth - 1);
   }
-  QuickSort(pivot + 1, high);
-}
\ No newline at end of file
+  IntroSort(pivot + 1, high, depth - 1);
+}
+
+// The top levels partition with all available workers; the two halves then split the workers in proportion
+// to their sizes until a range is small enough, or has a single worker, to be finished sequentially.
+void nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::ParallelQuickSort(size_t low, size_t high,
+                                                                                           int workers, int depth) {
+  const size_t n = high - low + 1;
+  if (workers <= 1 || n < kParallelPartitionThreshold || depth == 0) {
+    IntroSort(low, high, depth);
+    return;
+  }
+  double *first = vect_.data() + low;
+  const size_t split =
+      ppc::core::ParallelPartition(first, n, MedianOfThree(first, n), static_cast<size_t>(workers), RunOnNestedTeam);
+  if (split == 0 || split == n) {
+    IntroSort(low, high, depth - 1);
+    return;
+  }
+  const int left_workers = std::clamp(static_cast<int>(((workers * split) + (n / 2)) / n), 1, workers - 1);
+  // Each half goes on with a thread of its own, which leads the team of its share of the workers
+#pragma omp parallel sections num_threads(2)
+  {
+#pragma omp section
+    ParallelQuickSort(low, low + split - 1, left_workers, depth - 1);
+#pragma omp section
+    ParallelQuickSort(low + split, high, workers - left_workers, depth - 1);
+  }
+}
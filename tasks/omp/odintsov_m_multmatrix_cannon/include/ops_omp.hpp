@@ -24,8 +24,6 @@ class MulMatrixCannonOpenMP : public ppc::core::Task {
   void ShiftBlocksLeft(std::vector<double>& matrix, int root, int block_sz) const;
   static bool IsSquere(unsigned int num);
   static int GetBlockSize(int n);
-  static void CopyBlock(const std::vector<double>& matrix, std::vector<double>& block, int start, int root,
-                        int block_sz);
   static void InitializeShift(std::vector<double>& matrix, int root, int grid_size, int block_sz, bool is_row_shift);
   std::vector<double> matrixA_, matrixB_;
   unsigned int szA_ = 0, szB_ = 0;
@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 using namespace std;
 void odintsov_m_mulmatrix_cannon_omp::MulMatrixCannonOpenMP::ShiftRow(std::vector<double>& matrix, int root, int row,
                                                                       int shift) {
@@ -101,16 +103,6 @@ int odintsov_m_mulmatrix_cannon_omp::MulMatrixCannonOpenMP::GetBlockSize(int n)
   }
   return 1;
 }
-void odintsov_m_mulmatrix_cannon_omp::MulMatrixCannonOpenMP::CopyBlock(const std::vector<double>& matrix,
-                                                                       std::vector<double>& block, int start, int root,
-                                                                       int block_sz) {
-  for (int i = 0; i < block_sz; i++) {
-    for (int j = 0; j < block_sz; j++) {
-      int index = start + (i * root) + j;
-      block[(i * block_sz) + j] = matrix[index];
-    }
-  }
-}
 void odintsov_m_mulmatrix_cannon_omp::MulMatrixCannonOpenMP::InitializeShift(std::vector<double>& matrix, int root,
                                                                              int grid_size, int block_sz,
                                                                              bool is_row_shift) {
@@ -161,28 +153,12 @@ bool odintsov_m_mulmatrix_cannon_omp::MulMatrixCannonOpenMP::RunImpl() {
     // Распараллеливаем по внешнему циклу по блокам по строкам (bi)
 #pragma omp parallel for schedule(static)
     for (int bi = 0; bi < root / block_sz_; bi++) {
-      // Каждый поток получает свою локальную копию блоков
-      std::vector<double> local_block_a(block_sz_ * block_sz_, 0);
-      std::vector<double> local_block_b(block_sz_ * block_sz_, 0);
-
       // Внутренний цикл по столбцам блоков (bj) остается последовательным для каждого потока
       for (int bj = 0; bj < root / block_sz_; bj++) {
         int start = ((bi * block_sz_) * root) + (bj * block_sz_);
-
-        // Локальное копирование блоков из глобальных матриц
-        CopyBlock(matrixA_, local_block_a, start, root, block_sz_);
-        CopyBlock(matrixB_, local_block_b, start, root, block_sz_);
-
-        for (int i = 0; i < block_sz_; i++) {
-          for (int k = 0; k < block_sz_; k++) {
-            double a_ik = local_block_a[(i * block_sz_) + k];
-            for (int j = 0; j < block_sz_; j++) {
-              int index = ((bi * block_sz_ + i) * root) + (bj * block_sz_ + j);
-#pragma omp atomic
-              matrixC_[index] += a_ik * local_block_b[(k * block_sz_) + j];
-            }
-          }
-        }
+        // Каждый поток пишет только в свою полосу строк C, поэтому синхронизация не нужна
+        ppc::core::Gemm(block_sz_, block_sz_, block_sz_, &matrixA_[start], root, &matrixB_[start], root,
+                        &matrixC_[start], root);
       }
     }
     ShiftBlocksLeft(matrixA_, root, block_sz_);
@@ -1,12 +1,47 @@
 #include "omp/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse_omp.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <cstddef>
 #include <vector>
 
+#include "core/sparse/include/omp_part_runner.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+// The first c_n columns of matrix, which are all that the multiplication reads of it
+ppc::core::SplitCscMatrix<double> ToSplit(const solovev_a_matrix_omp::MatrixInCcsSparse& matrix) {
+  ppc::core::CscMatrix<std::complex<double>> csc;
+  csc.rows = matrix.r_n;
+  csc.cols = matrix.c_n;
+  csc.col_ptr.assign(matrix.col_p.begin(), matrix.col_p.begin() + matrix.c_n + 1);
+  csc.row_idx.assign(matrix.row.begin(), matrix.row.begin() + csc.col_ptr.back());
+  csc.values.assign(matrix.val.begin(), matrix.val.begin() + csc.col_ptr.back());
+  return ppc::core::SplitCscMatrix<double>::FromInterleaved(csc);
+}
+
+void StoreProduct(const ppc::core::SplitCscMatrix<double>& product, solovev_a_matrix_omp::MatrixInCcsSparse& result) {
+  result.r_n = product.rows;
+  result.c_n = product.cols;
+  result.n_z = static_cast<int>(product.NonZeros());
+  result.col_p = product.col_ptr;
+  result.row = product.row_idx;
+  result.val.resize(product.NonZeros());
+  for (std::size_t i = 0; i < product.NonZeros(); ++i) {
+    result.val[i] = {product.real[i], product.imag[i]};
+  }
+}
+}  // namespace
+
 bool solovev_a_matrix_omp::OMPMatMultCcs::PreProcessingImpl() {
   M1_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]);
   M2_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[1]);
   M3_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->outputs[0]);
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_m1_ = ToSplit(*M1_);
+    split_m2_ = ToSplit(*M2_);
+  }
   return true;
 }
 
@@ -17,6 +52,11 @@ bool solovev_a_matrix_omp::OMPMatMultCcs::ValidationImpl() {
 }
 
 bool solovev_a_matrix_omp::OMPMatMultCcs::RunImpl() {
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+    StoreProduct(split_m1_.Multiply(split_m2_, parts, ppc::core::OmpPartRunner()), *M3_);
+    return true;
+  }
   M3_->r_n = M1_->r_n;
   M3_->c_n = M2_->c_n;
   M3_->col_p.resize(M3_->c_n + 1);
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
@@ -200,4 +201,52 @@ TEST(solovyev_d_shell_sort_simple_omp, sort_rand_100) {
   task_omp.Run();
   task_omp.PostProcessing();
   ASSERT_TRUE(IsSorted(out));
-}
\ No newline at end of file
+}
+
+TEST(solovyev_d_shell_sort_simple_omp, sort_few_ascending_runs) {
+  std::vector<int> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<int>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  solovyev_d_shell_sort_simple_omp::TaskOMP task_omp(task_data_omp);
+  ASSERT_TRUE(task_omp.Validation());
+  task_omp.PreProcessing();
+  task_omp.Run();
+  task_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(solovyev_d_shell_sort_simple_omp, sort_non_increasing) {
+  std::vector<int> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<int>(500 - (i / 3));
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  solovyev_d_shell_sort_simple_omp::TaskOMP task_omp(task_data_omp);
+  ASSERT_TRUE(task_omp.Validation());
+  task_omp.PreProcessing();
+  task_omp.Run();
+  task_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
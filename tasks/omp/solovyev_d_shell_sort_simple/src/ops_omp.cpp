@@ -1,9 +1,15 @@
 #include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/omp_part_runner.hpp"
+
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -17,6 +23,9 @@ bool solovyev_d_shell_sort_simple_omp::TaskOMP::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::RunImpl() {
+  if (ppc::core::SortIfPresorted(input_, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner())) {
+    return true;
+  }
   for (int gap = (int)input_.size() / 2; gap > 0; gap /= 2) {
 #pragma omp parallel for
     for (int i = 0; i < gap; i++) {
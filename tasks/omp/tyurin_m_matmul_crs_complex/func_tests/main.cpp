@@ -4,9 +4,12 @@
 #include <complex>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_order/include/sparse_order.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/tyurin_m_matmul_crs_complex/include/ops_omp.hpp"
 
@@ -29,7 +32,8 @@ Matrix RandMatrix(uint32_t rows, uint32_t cols, double percentage) {
   });
   return res;
 }
-void TestMatrixCRS(Matrix &&lhs, Matrix &&rhs) {
+void TestMatrixCRS(Matrix &&lhs, Matrix &&rhs,
+                   ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved) {
   MatrixCRS crs_lhs = RegularToCRS(lhs);
   MatrixCRS crs_rhs = RegularToCRS(rhs);
   MatrixCRS crs_out;
@@ -40,7 +44,7 @@ void TestMatrixCRS(Matrix &&lhs, Matrix &&rhs) {
   data->outputs = {reinterpret_cast<uint8_t *>(&crs_out)};
   data->outputs_count = {1};
 
-  tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP task(data);
+  tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP task(data, storage);
   ASSERT_EQ(task.Validation(), true);
   task.PreProcessing();
   task.Run();
@@ -49,6 +53,59 @@ void TestMatrixCRS(Matrix &&lhs, Matrix &&rhs) {
   Matrix regular_out = CRSToRegular(crs_out);
   EXPECT_EQ(regular_out, MultiplyMat(lhs, rhs));
 }
+
+// 5-point stencil of a side x side grid with small integer entries, so that the product is exact in any order of
+// summation, and its vertices numbered at random
+Matrix ScrambledGrid(uint32_t side) {
+  const uint32_t n = side * side;
+  std::vector<uint32_t> place(n);
+  std::iota(place.begin(), place.end(), 0);
+  std::ranges::shuffle(place, std::mt19937(side));
+  Matrix res{.rows = n, .cols = n, .data = std::vector<std::complex<double>>(n * n)};
+  for (uint32_t y = 0; y < side; ++y) {
+    for (uint32_t x = 0; x < side; ++x) {
+      const uint32_t v = place[(y * side) + x];
+      res.Get(v, v) = {4.0, static_cast<double>(x)};
+      if (x + 1 < side) {
+        res.Get(v, place[(y * side) + x + 1]) = {-1.0, 1.0};
+        res.Get(place[(y * side) + x + 1], v) = {-1.0, -1.0};
+      }
+      if (y + 1 < side) {
+        res.Get(v, place[((y + 1) * side) + x]) = {-2.0, 0.0};
+        res.Get(place[((y + 1) * side) + x], v) = {-1.0, 2.0};
+      }
+    }
+  }
+  return res;
+}
+
+void TestReordered(ppc::core::SparseOrdering ordering,
+                   ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved) {
+  Matrix lhs = ScrambledGrid(12);
+  Matrix rhs = ScrambledGrid(12);
+  MatrixCRS crs_lhs = RegularToCRS(lhs);
+  MatrixCRS crs_rhs = RegularToCRS(rhs);
+  MatrixCRS crs_out;
+
+  auto data = std::make_shared<ppc::core::TaskData>();
+  data->inputs = {reinterpret_cast<uint8_t *>(&crs_lhs), reinterpret_cast<uint8_t *>(&crs_rhs)};
+  data->inputs_count = {lhs.rows, lhs.cols, rhs.rows, rhs.cols};
+  data->outputs = {reinterpret_cast<uint8_t *>(&crs_out)};
+  data->outputs_count = {1};
+
+  tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP task(data, storage, ordering);
+  ASSERT_EQ(task.Validation(), true);
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(CRSToRegular(crs_out), MultiplyMat(lhs, rhs));
+  // Nested dissection numbers each separator after its halves, so only the profile has to shrink
+  if (ordering == ppc::core::SparseOrdering::kReverseCuthillMcKee) {
+    EXPECT_LT(task.BandAfter().bandwidth, task.BandBefore().bandwidth);
+  }
+  EXPECT_LT(task.BandAfter().profile, task.BandBefore().profile);
+}
 }  // namespace
 
 // clang-format off
@@ -128,6 +185,38 @@ TEST(tyurin_m_matmul_crs_complex_omp, test_crs_random_30x1p70mul1x1p63) {
 TEST(tyurin_m_matmul_crs_complex_omp, test_crs_random_30x1p38mul1x1p63) {
   TestMatrixCRS(RandMatrix(30, 1, .38), RandMatrix(1, 30, .63));
 }
+TEST(tyurin_m_matmul_crs_complex_omp, test_crs_random_split_storage_50x70p30mul70x45p40) {
+  TestMatrixCRS(RandMatrix(50, 70, .30), RandMatrix(70, 45, .40), ppc::core::ComplexStorage::kSplit);
+}
+TEST(tyurin_m_matmul_crs_complex_omp, test_crs_reverse_cuthill_mckee_scrambled_grid) {
+  TestReordered(ppc::core::SparseOrdering::kReverseCuthillMcKee);
+}
+TEST(tyurin_m_matmul_crs_complex_omp, test_crs_nested_dissection_scrambled_grid_split_storage) {
+  TestReordered(ppc::core::SparseOrdering::kNestedDissection, ppc::core::ComplexStorage::kSplit);
+}
+TEST(tyurin_m_matmul_crs_complex_omp, test_crs_reordering_skips_rectangular_matrices) {
+  Matrix lhs = RandMatrix(30, 40, .5);
+  Matrix rhs = RandMatrix(40, 30, .5);
+  MatrixCRS crs_lhs = RegularToCRS(lhs);
+  MatrixCRS crs_rhs = RegularToCRS(rhs);
+  MatrixCRS crs_out;
+
+  auto data = std::make_shared<ppc::core::TaskData>();
+  data->inputs = {reinterpret_cast<uint8_t *>(&crs_lhs), reinterpret_cast<uint8_t *>(&crs_rhs)};
+  data->inputs_count = {lhs.rows, lhs.cols, rhs.rows, rhs.cols};
+  data->outputs = {reinterpret_cast<uint8_t *>(&crs_out)};
+  data->outputs_count = {1};
+
+  tyurin_m_matmul_crs_complex_omp::TestTaskOpenMP task(data, ppc::core::ComplexStorage::kInterleaved,
+                                                       ppc::core::SparseOrdering::kReverseCuthillMcKee);
+  ASSERT_EQ(task.Validation(), true);
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  EXPECT_EQ(CRSToRegular(crs_out), MultiplyMat(lhs, rhs));
+  EXPECT_EQ(task.BandAfter().bandwidth, task.BandBefore().bandwidth);
+}
 TEST(tyurin_m_matmul_crs_complex_omp, test_regular_matrix_mult_inv) {
   Matrix lhs{.rows = 3, .cols = 3, .data = {1, 0, 0, 1, -1, 0, 1, 0, 1}};
   Matrix rhs{.rows = 3, .cols = 3, .data = {1, 0, 0, 1, -1, 0, -1, 0, 1}};
@@ -5,9 +5,14 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_omp {
+// Element types: T for A and B, AccT for the accumulated C (float, or float inputs with a double result).
+// A, B and C can also be described by ppc::core::MatrixDesc values passed as an array of three in inputs[2]; the
+// task then reads A and B through those views in place and writes C into its view.
+template <typename T, typename AccT = T>
 class CannonOMP : public ppc::core::Task {
  public:
   explicit CannonOMP(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -21,12 +26,34 @@ class CannonOMP : public ppc::core::Task {
   int N_;
   int block_size_;
   int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
+  const T *A_{};
+  const T *B_{};
+  std::vector<AccT> C_;
+  ppc::core::MatrixDesc desc_a_;
+  ppc::core::MatrixDesc desc_b_;
+  ppc::core::MatrixDesc desc_c_;
 
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
+  void BlockMultiply(int step);
+};
+
+// Many small products at once: C_i = A_i * B_i for n x n matrices stored back to back in A, B and C. Where CannonOMP
+// splits one product among threads, here every thread multiplies a contiguous run of whole matrices. The task data
+// matches CannonOMP with n in place of the block count.
+template <typename T>
+class BatchedMatMulOMP : public ppc::core::Task {
+ public:
+  explicit BatchedMatMulOMP(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  int N_;
+  int batch_size_;
+  std::vector<T> A_;
+  std::vector<T> B_;
+  std::vector<T> C_;
 };
 }  // namespace vavilov_v_cannon_omp
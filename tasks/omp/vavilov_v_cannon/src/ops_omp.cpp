@@ -1,106 +1,163 @@
 #include "omp/vavilov_v_cannon/include/ops_omp.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
-bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
-  N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
-  block_size_ = N_ / num_blocks_;
+#include "core/batched_gemm/include/batched_gemm.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/tuning/include/tuning.hpp"
+#include "core/util/include/util.hpp"
 
-  auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
-  auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+namespace {
+
+// Descriptors of A, B and C if the caller passed them in inputs[2]
+const ppc::core::MatrixDesc *Layouts(const ppc::core::TaskData &data) {
+  return data.inputs.size() > 2 ? reinterpret_cast<const ppc::core::MatrixDesc *>(data.inputs[2]) : nullptr;
+}
 
+// All three views are n x n and stay inside their buffers.
+bool ValidLayouts(const ppc::core::TaskData &data, const ppc::core::MatrixDesc *layouts) {
+  const std::size_t n = layouts[0].rows;
+  const std::array<std::size_t, 3> sizes = {data.inputs_count[0], data.inputs_count[1], data.outputs_count[0]};
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    if (!layouts[i].IsValid() || layouts[i].rows != n || layouts[i].cols != n || layouts[i].Span() > sizes[i]) {
+      return false;
+    }
+  }
   return true;
 }
 
-bool vavilov_v_cannon_omp::CannonOMP::ValidationImpl() {
-  if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
-      task_data->outputs_count[0] != task_data->inputs_count[0]) {
-    return false;
+}  // namespace
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_omp::CannonOMP<T, AccT>::PreProcessingImpl() {
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    desc_a_ = layouts[0];
+    desc_b_ = layouts[1];
+    desc_c_ = layouts[2];
+  } else {
+    const auto n = static_cast<std::size_t>(std::sqrt(task_data->inputs_count[0]));
+    desc_a_ = desc_b_ = desc_c_ = ppc::core::RowMajorDesc(n, n);
   }
+  N_ = static_cast<int>(desc_a_.rows);
+  num_blocks_ = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  if (num_blocks_ == 0) {
+    const auto block = static_cast<int>(ppc::core::NearestDivisor(N_, ppc::core::TunedMatrixBlockSize()));
+    num_blocks_ = std::max<int>(N_ / block, 1);
+  }
+  block_size_ = N_ / num_blocks_;
 
-  auto n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  auto num_blocks = static_cast<int>(task_data->inputs_count[2]);
-  return n % num_blocks == 0;
-}
+  A_ = reinterpret_cast<const T *>(task_data->inputs[0]);
+  B_ = reinterpret_cast<const T *>(task_data->inputs[1]);
+  C_.assign(N_ * N_, 0);
 
-void vavilov_v_cannon_omp::CannonOMP::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
+  return true;
+}
 
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + bj) % num_blocks_;
-      int src_col = (bj + bi) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_omp::CannonOMP<T, AccT>::ValidationImpl() {
+  int n = 0;
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    if (!ValidLayouts(*task_data, layouts)) {
+      return false;
+    }
+    n = static_cast<int>(layouts[0].rows);
+  } else {
+    if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
+        task_data->outputs_count[0] != task_data->inputs_count[0]) {
+      return false;
     }
+    n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   }
+  // Without a block count, or with 0, PreProcessing picks one from the tuned block size
+  auto num_blocks = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  return num_blocks == 0 || n % num_blocks == 0;
 }
-void vavilov_v_cannon_omp::CannonOMP::BlockMultiply() {
+
+// Block (bi, bj) multiplies A(bi, k) by B(k, bj), k = (bi + bj + step) mod num_blocks: the skew and the shifts
+// are index arithmetic, so no block is copied between steps.
+template <typename T, typename AccT>
+void vavilov_v_cannon_omp::CannonOMP<T, AccT>::BlockMultiply(int step) {
+  const ppc::core::MatrixDesc block_a = desc_a_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_b = desc_b_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_c = ppc::core::RowMajorDesc(N_, N_).Block(block_size_, block_size_);
 #pragma omp parallel for
   for (int bi = 0; bi < num_blocks_; ++bi) {
     for (int bj = 0; bj < num_blocks_; ++bj) {
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          double temp = 0.0;
-          for (int k = 0; k < block_size_; ++k) {
-            int row = (bi * block_size_) + i;
-            int col = (bj * block_size_) + j;
-            int k_idx = (bj * block_size_) + k;
-            int k_row = (bi * block_size_) + k;
-            temp += A_[(row * N_) + k_idx] * B_[(k_row * N_) + col];
-          }
-          C_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] += temp;
-        }
-      }
+      const int k = (bi + bj + step) % num_blocks_;
+      ppc::core::Gemm(block_a, A_ + desc_a_.Offset(bi * block_size_, k * block_size_), block_b,
+                      B_ + desc_b_.Offset(k * block_size_, bj * block_size_), block_c,
+                      &C_[(bi * block_size_ * N_) + (bj * block_size_)]);
     }
   }
 }
 
-void vavilov_v_cannon_omp::CannonOMP::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
+template <typename T, typename AccT>
+bool vavilov_v_cannon_omp::CannonOMP<T, AccT>::RunImpl() {
+  for (int iter = 0; iter < num_blocks_; ++iter) {
+    BlockMultiply(iter);
+  }
+  return true;
+}
 
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + 1) % num_blocks_;
-      int src_col = (bj + 1) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_omp::CannonOMP<T, AccT>::PostProcessingImpl() {
+  ppc::core::CopyToMatrix(C_.data(), desc_c_, reinterpret_cast<AccT *>(task_data->outputs[0]));
+  return true;
+}
+
+template <typename T>
+bool vavilov_v_cannon_omp::BatchedMatMulOMP<T>::PreProcessingImpl() {
+  N_ = static_cast<int>(task_data->inputs_count[2]);
+  batch_size_ = static_cast<int>(task_data->inputs_count[0] / (N_ * N_));
+
+  auto *a = reinterpret_cast<T *>(task_data->inputs[0]);
+  auto *b = reinterpret_cast<T *>(task_data->inputs[1]);
+  A_.assign(a, a + task_data->inputs_count[0]);
+  B_.assign(b, b + task_data->inputs_count[1]);
+  C_.assign(task_data->outputs_count[0], 0);
+
+  return true;
+}
+
+template <typename T>
+bool vavilov_v_cannon_omp::BatchedMatMulOMP<T>::ValidationImpl() {
+  if (task_data->inputs_count.size() < 3 || task_data->inputs_count[0] != task_data->inputs_count[1] ||
+      task_data->outputs_count[0] != task_data->inputs_count[0]) {
+    return false;
   }
+
+  auto n = task_data->inputs_count[2];
+  return n > 0 && task_data->inputs_count[0] % (n * n) == 0;
 }
 
-bool vavilov_v_cannon_omp::CannonOMP::RunImpl() {
-  InitialShift();
-  for (int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply();
-    ShiftBlocks();
+template <typename T>
+bool vavilov_v_cannon_omp::BatchedMatMulOMP<T>::RunImpl() {
+  const auto stride = static_cast<std::size_t>(N_) * N_;
+  const int num_threads = std::min(ppc::util::GetPPCNumThreads(), std::max(batch_size_, 1));
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+  for (int t = 0; t < num_threads; ++t) {
+    const std::size_t first = static_cast<std::size_t>(batch_size_) * t / num_threads;
+    const std::size_t last = static_cast<std::size_t>(batch_size_) * (t + 1) / num_threads;
+    const std::size_t offset = first * stride;
+    ppc::core::GemmStridedBatched(last - first, N_, N_, N_, A_.data() + offset, N_, stride, B_.data() + offset, N_,
+                                  stride, C_.data() + offset, N_, stride);
   }
   return true;
 }
 
-bool vavilov_v_cannon_omp::CannonOMP::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double*>(task_data->outputs[0]));
+template <typename T>
+bool vavilov_v_cannon_omp::BatchedMatMulOMP<T>::PostProcessingImpl() {
+  std::ranges::copy(C_, reinterpret_cast<T *>(task_data->outputs[0]));
   return true;
 }
+
+template class vavilov_v_cannon_omp::CannonOMP<double>;
+template class vavilov_v_cannon_omp::CannonOMP<float>;
+template class vavilov_v_cannon_omp::CannonOMP<float, double>;
+template class vavilov_v_cannon_omp::BatchedMatMulOMP<double>;
+template class vavilov_v_cannon_omp::BatchedMatMulOMP<float>;
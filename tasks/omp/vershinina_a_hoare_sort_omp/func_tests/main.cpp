@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <random>
 #include <vector>
@@ -159,3 +160,130 @@ TEST(vershinina_a_hoare_sort_omp, test_random_odd_len_100) {
 
   ASSERT_TRUE(std::ranges::is_sorted(out));
 }
+
+TEST(vershinina_a_hoare_sort_omp, test_few_ascending_runs) {
+  std::vector<double> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<double>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  vershinina_a_hoare_sort_omp::TestTaskOpenMP test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_non_increasing) {
+  std::vector<double> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<double>(500 - (i / 3));
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_omp->inputs_count.emplace_back(in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  vershinina_a_hoare_sort_omp::TestTaskOpenMP test_task_omp(task_data_omp);
+  ASSERT_TRUE(test_task_omp.Validation());
+  test_task_omp.PreProcessing();
+  test_task_omp.Run();
+  test_task_omp.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_nth_element) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> distr(-1e6, 1e6);
+  std::vector<double> in(100000);
+  std::ranges::generate(in, [&] { return distr(gen); });
+  auto expected = in;
+  std::ranges::sort(expected);
+
+  for (std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{49999}, std::size_t{99999}}) {
+    auto data = in;
+    vershinina_a_hoare_sort_omp::NthElement(data, k);
+    ASSERT_EQ(data[k], expected[k]);
+    EXPECT_TRUE(std::all_of(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(k),
+                            [&](double x) { return x <= data[k]; }));
+    EXPECT_TRUE(std::all_of(data.begin() + static_cast<std::ptrdiff_t>(k), data.end(),
+                            [&](double x) { return x >= data[k]; }));
+  }
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_nth_element_many_duplicates) {
+  std::mt19937 gen(8);
+  std::uniform_int_distribution<> distr(0, 3);
+  std::vector<double> in(80000);
+  std::ranges::generate(in, [&] { return distr(gen); });
+  auto expected = in;
+  std::ranges::sort(expected);
+
+  vershinina_a_hoare_sort_omp::NthElement(in, 30000);
+  EXPECT_EQ(in[30000], expected[30000]);
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_partial_sort) {
+  std::mt19937 gen(9);
+  std::uniform_real_distribution<double> distr(-1e6, 1e6);
+  std::vector<double> in(60000);
+  std::ranges::generate(in, [&] { return distr(gen); });
+  auto expected = in;
+  std::ranges::sort(expected);
+
+  vershinina_a_hoare_sort_omp::PartialSort(in, 1000);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + 1000, in.begin()));
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_partial_sort_whole_array) {
+  auto in = GetRandomVector(5000);
+  auto expected = in;
+  std::ranges::sort(expected);
+
+  vershinina_a_hoare_sort_omp::PartialSort(in, in.size() + 10);
+  EXPECT_EQ(expected, in);
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_partial_sort_many_duplicates) {
+  // A long prefix of equal keys: the Lomuto recursion of HoareSort would go about k levels deep here
+  std::vector<double> in(400000, 1.0);
+  for (std::size_t i = 0; i < in.size(); i += 100) {
+    in[i] = static_cast<double>(i);
+  }
+  auto expected = in;
+  std::ranges::sort(expected);
+
+  vershinina_a_hoare_sort_omp::PartialSort(in, 300000);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.begin() + 300000, in.begin()));
+}
+
+TEST(vershinina_a_hoare_sort_omp, test_top_k) {
+  std::mt19937 gen(10);
+  std::uniform_real_distribution<double> distr(-1e6, 1e6);
+  std::vector<double> in(50000);
+  std::ranges::generate(in, [&] { return distr(gen); });
+  auto expected = in;
+  std::ranges::sort(expected, std::greater<>());
+  expected.resize(100);
+
+  EXPECT_EQ(expected, vershinina_a_hoare_sort_omp::TopK(in, 100));
+  EXPECT_TRUE(vershinina_a_hoare_sort_omp::TopK(in, 0).empty());
+  EXPECT_EQ(in.size(), vershinina_a_hoare_sort_omp::TopK(in, in.size() + 1).size());
+}
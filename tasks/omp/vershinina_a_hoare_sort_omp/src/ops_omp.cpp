@@ -1,10 +1,15 @@
 #include "omp/vershinina_a_hoare_sort_omp/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/omp_part_runner.hpp"
 #include "core/util/include/util.hpp"
 
 namespace {
@@ -51,6 +56,26 @@ void BatcherMerge(int thread_input_size, std::vector<double *> &pointers, std::v
     }
   }
 }
+// Sorts [data, data + n): blocks are sorted by HoareSort in parallel and then merged by BatcherMerge.
+void HoareSortParallel(double *data, int n) {
+  const auto numthreads = std::min(n, ppc::util::GetPPCNumThreads());
+  int thread_input_size = n / numthreads;
+  int thread_input_remainder_size = n % numthreads;
+
+  std::vector<double *> pointers(numthreads);
+  std::vector<int> sizes(numthreads);
+  for (int i = 0; i < numthreads; i++) {
+    pointers[i] = data + (i * thread_input_size);
+    sizes[i] = thread_input_size;
+  }
+  sizes[sizes.size() - 1] += thread_input_remainder_size;
+
+#pragma omp parallel for
+  for (int i = 0; i < numthreads; i++) {
+    HoareSort(pointers[i], 0, sizes[i] - 1);
+  }
+  BatcherMerge(thread_input_size, pointers, sizes, 32);
+}
 }  // namespace
 bool vershinina_a_hoare_sort_omp::TestTaskOpenMP::PreProcessingImpl() {
   input_.assign(reinterpret_cast<double *>(task_data->inputs[0]),
@@ -70,28 +95,27 @@ bool vershinina_a_hoare_sort_omp::TestTaskOpenMP::RunImpl() {
   }
   res_.resize(input_.size());
   std::ranges::copy(input_, res_.begin());
-
-  const auto numthreads = std::min(n, ppc::util::GetPPCNumThreads());
-  int thread_input_size = n / numthreads;
-  int thread_input_remainder_size = n % numthreads;
-
-  std::vector<double *> pointers(numthreads);
-  std::vector<int> sizes(numthreads);
-  for (int i = 0; i < numthreads; i++) {
-    pointers[i] = res_.data() + (i * thread_input_size);
-    sizes[i] = thread_input_size;
+  if (ppc::core::SortIfPresorted(res_, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner())) {
+    return true;
   }
-  sizes[sizes.size() - 1] += thread_input_remainder_size;
 
-#pragma omp parallel for
-  for (int i = 0; i < numthreads; i++) {
-    HoareSort(pointers[i], 0, sizes[i] - 1);
-  }
-  BatcherMerge(thread_input_size, pointers, sizes, 32);
+  HoareSortParallel(res_.data(), n);
   return true;
 }
 
 bool vershinina_a_hoare_sort_omp::TestTaskOpenMP::PostProcessingImpl() {
   std::ranges::copy(res_, reinterpret_cast<double *>(task_data->outputs[0]));
   return true;
-}
\ No newline at end of file
+}
+
+void vershinina_a_hoare_sort_omp::NthElement(std::vector<double> &data, std::size_t k) {
+  ppc::core::NthElement(data, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
+
+void vershinina_a_hoare_sort_omp::PartialSort(std::vector<double> &data, std::size_t k) {
+  ppc::core::PartialSort(data, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
+
+std::vector<double> vershinina_a_hoare_sort_omp::TopK(const std::vector<double> &data, std::size_t k) {
+  return ppc::core::TopK(data, k, static_cast<std::size_t>(omp_get_max_threads()), ppc::core::OmpPartRunner());
+}
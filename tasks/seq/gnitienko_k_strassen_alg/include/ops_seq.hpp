@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -20,14 +21,11 @@ class StrassenAlgSeq : public ppc::core::Task {
   std::vector<double> input_2_;
   std::vector<double> output_;
   int size_{};
-  int TRIVIAL_MULTIPLICATION_BOUND_ = 32;
-  int extend_ = 0;
-
-  static void TrivialMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c,
-                              int size);
-  void StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void AddMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void SubMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
+  std::size_t cutoff_{};
+
+  std::vector<double> workspace_;
+
+  void StrassenMultiply();
 };
 
 }  // namespace gnitienko_k_strassen_algorithm
\ No newline at end of file
@@ -2,8 +2,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+#include "core/tuning/include/tuning.hpp"
+
 bool gromov_a_fox_algorithm_seq::TestTaskSequential::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   if (input_size % 2 != 0) {
@@ -24,13 +28,7 @@ bool gromov_a_fox_algorithm_seq::TestTaskSequential::PreProcessingImpl() {
     return false;
   }
 
-  block_size_ = n_ / 2;
-  for (int i = 1; i <= n_; ++i) {
-    if (n_ % i == 0) {
-      block_size_ = i;
-      break;
-    }
-  }
+  block_size_ = std::min(static_cast<int>(ppc::core::TunedMatrixBlockSize()), n_);
   return block_size_ > 0;
 }
 
@@ -50,15 +48,9 @@ bool gromov_a_fox_algorithm_seq::TestTaskSequential::RunImpl() {
   for (int stage = 0; stage < num_blocks; ++stage) {
     for (int i = 0; i < n_; i += block_size_) {
       for (int j = 0; j < n_; j += block_size_) {
-        for (int bi = i; bi < i + block_size_ && bi < n_; ++bi) {
-          for (int bj = j; bj < j + block_size_ && bj < n_; ++bj) {
-            // Ensure the bk range covers all indices up to n_
-            int start_k = stage * block_size_;
-            for (int bk = start_k; bk < std::min((stage + 1) * block_size_, n_); ++bk) {
-              output_[(bi * n_) + bj] += A_[(bi * n_) + bk] * B_[(bk * n_) + bj];
-            }
-          }
-        }
+        const int k = stage * block_size_;
+        ppc::core::Gemm(std::min(block_size_, n_ - i), std::min(block_size_, n_ - j), std::min(block_size_, n_ - k),
+                        &A_[(i * n_) + k], n_, &B_[(k * n_) + j], n_, &output_[(i * n_) + j], n_);
       }
     }
   }
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -12,10 +14,9 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_only_real) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(3, 3);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(1, 0), 0);
   a.AddValue(0, Complex(2, 0), 2);
@@ -26,15 +27,8 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_only_real) {
   b.AddValue(0, Complex(6, 0), 1);
   b.AddValue(1, Complex(7, 0), 0);
   b.AddValue(2, Complex(8, 0), 2);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(6, 0), 1);
   c.AddValue(0, Complex(16, 0), 2);
   c.AddValue(1, Complex(21, 0), 0);
@@ -42,8 +36,10 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_only_real) {
   c.AddValue(2, Complex(35, 0), 0);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -54,7 +50,7 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_only_real) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
 }
 
@@ -62,10 +58,9 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_not_equal_rows_and_cols) {
   // Create data
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(5, 3);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(1, 0), 0);
   a.AddValue(0, Complex(2, 0), 2);
@@ -76,19 +71,14 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_not_equal_rows_and_cols) {
   b.AddValue(0, Complex(6, 0), 1);
   b.AddValue(1, Complex(7, 0), 0);
   b.AddValue(2, Complex(8, 0), 2);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -102,10 +92,9 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_imag) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(3, 3);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(1, 1), 0);
   a.AddValue(0, Complex(2, 2), 2);
@@ -116,15 +105,8 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_imag) {
   b.AddValue(0, Complex(6, 6), 1);
   b.AddValue(1, Complex(7, 7), 0);
   b.AddValue(2, Complex(8, 8), 2);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(0, 12), 1);
   c.AddValue(0, Complex(0, 32), 2);
   c.AddValue(1, Complex(0, 42), 0);
@@ -132,8 +114,10 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_imag) {
   c.AddValue(2, Complex(0, 70), 0);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -144,7 +128,7 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_imag) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
 }
 
@@ -153,10 +137,9 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_rectangular_matrix) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(2, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 4);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(2, 4);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(1, 0), 1);
   a.AddValue(0, Complex(2, 0), 2);
@@ -167,15 +150,8 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_rectangular_matrix) {
   b.AddValue(1, Complex(4, 0), 3);
   b.AddValue(2, Complex(7, 0), 0);
   b.AddValue(2, Complex(8, 0), 1);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(19, 0), 0);
   c.AddValue(0, Complex(4, 0), 3);
   c.AddValue(0, Complex(16, 0), 1);
@@ -183,8 +159,10 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_rectangular_matrix) {
   c.AddValue(1, Complex(12, 0), 3);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -195,7 +173,7 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_rectangular_matrix) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
 }
 
@@ -204,31 +182,25 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_negative_elems) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(2, 2);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(2, 2);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(2, 2);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(-1, -1), 0);
   a.AddValue(1, Complex(3, 3), 1);
 
   b.AddValue(0, Complex(6, 6), 1);
   b.AddValue(1, Complex(-7, -7), 0);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(0, -12), 1);
   c.AddValue(1, Complex(0, -42), 0);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -239,7 +211,7 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_negative_elems) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
 }
 
@@ -248,31 +220,25 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_double_elems) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(2, 2);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(2, 2);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(2, 2);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(-1.7, -1.5), 0);
   a.AddValue(1, Complex(3.7, 3.1), 1);
 
   b.AddValue(0, Complex(6.3, 6.1), 1);
   b.AddValue(1, Complex(-7.4, -7.7), 0);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(-1.56, -19.82), 1);
   c.AddValue(1, Complex(-3.51, -51.43), 0);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -283,7 +249,7 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_with_double_elems) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
 }
 
@@ -292,10 +258,9 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_row_by_col) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(1, 3);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 1);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(1, 1);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   a.AddValue(0, Complex(-1, 0), 0);
   a.AddValue(0, Complex(-2, 0), 1);
@@ -304,20 +269,15 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_row_by_col) {
   b.AddValue(0, Complex(1, 0), 0);
   b.AddValue(1, Complex(2, 0), 0);
   b.AddValue(2, Complex(3, 0), 0);
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
   c.AddValue(0, Complex(-14, 0), 0);
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -328,6 +288,125 @@ TEST(kolodkin_g_multiplication_seq, test_matmul_row_by_col) {
   test_task_sequential.Run();
   test_task_sequential.PostProcessing();
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
   ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
-}
\ No newline at end of file
+}
+
+TEST(kolodkin_g_multiplication_seq, test_matmul_compressed_indices) {
+  // Create data
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 3);
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS c(3, 3);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
+
+  a.AddValue(0, Complex(1, 1), 0);
+  a.AddValue(0, Complex(2, 2), 2);
+  a.AddValue(1, Complex(3, 3), 1);
+  a.AddValue(2, Complex(4, 4), 0);
+  a.AddValue(2, Complex(5, 5), 1);
+
+  b.AddValue(0, Complex(6, 6), 1);
+  b.AddValue(1, Complex(7, 7), 0);
+  b.AddValue(2, Complex(8, 8), 2);
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a, ppc::core::SparseIndexCoding::kDeltaVarint);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b, ppc::core::SparseIndexCoding::kDeltaVarint);
+  c.AddValue(0, Complex(0, 12), 1);
+  c.AddValue(0, Complex(0, 32), 2);
+  c.AddValue(1, Complex(0, 42), 0);
+  c.AddValue(2, Complex(0, 48), 1);
+  c.AddValue(2, Complex(0, 70), 0);
+  // Create task_data
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  kolodkin_g_multiplication_matrix_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
+  ASSERT_TRUE(kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(res, c));
+}
+
+TEST(kolodkin_g_multiplication_seq, test_matmul_output_buffer_too_small) {
+  // Create data
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 3);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(64);
+
+  a.AddValue(0, Complex(1, 1), 0);
+  a.AddValue(0, Complex(2, 2), 2);
+  a.AddValue(1, Complex(3, 3), 1);
+  a.AddValue(2, Complex(4, 4), 0);
+  a.AddValue(2, Complex(5, 5), 1);
+
+  b.AddValue(0, Complex(6, 6), 1);
+  b.AddValue(1, Complex(7, 7), 0);
+  b.AddValue(2, Complex(8, 8), 2);
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
+  // Create task_data
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  kolodkin_g_multiplication_matrix_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  ASSERT_FALSE(test_task_sequential.PostProcessing());
+}
+
+TEST(kolodkin_g_multiplication_seq, test_matmul_corrupt_encoding) {
+  // Create data
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(3, 3);
+  kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(3, 3);
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
+
+  a.AddValue(0, Complex(1, 1), 0);
+  a.AddValue(1, Complex(3, 3), 1);
+  a.AddValue(2, Complex(5, 5), 2);
+  b.AddValue(0, Complex(6, 6), 1);
+  b.AddValue(1, Complex(7, 7), 0);
+  b.AddValue(2, Complex(8, 8), 2);
+  std::vector<std::byte> in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
+
+  // The row pointers of a follow the 64-byte header; its column indices start at the next 64-byte boundary
+  std::vector<std::byte> bad_index = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  const int far_column = 1000;
+  std::memcpy(bad_index.data() + 128, &far_column, sizeof(far_column));
+  std::vector<std::byte> bad_pointer = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  const int far_entry = 1000;
+  std::memcpy(bad_pointer.data() + 64 + sizeof(int), &far_entry, sizeof(far_entry));
+
+  for (auto *in_a : {&bad_index, &bad_pointer}) {
+    // Create task_data
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a->data()));
+    task_data_seq->inputs_count.emplace_back(in_a->size());
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+    task_data_seq->inputs_count.emplace_back(in_b.size());
+    task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_seq->outputs_count.emplace_back(out.size());
+
+    // Create Task
+    kolodkin_g_multiplication_matrix_seq::TestTaskSequential test_task_sequential(task_data_seq);
+    ASSERT_EQ(test_task_sequential.Validation(), false);
+  }
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
@@ -13,10 +14,9 @@
 TEST(kolodkin_g_multiplication_matrix__task_seq, test_pipeline_run) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(400, 400);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(400, 400);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   for (unsigned int i = 0; i < 150; i++) {
     for (unsigned int j = 0; j < 150; j++) {
@@ -28,20 +28,15 @@ TEST(kolodkin_g_multiplication_matrix__task_seq, test_pipeline_run) {
       b.AddValue((int)i, Complex(-100 + (rand() % 100), -100 + (rand() % 100)), (int)j);
     }
   }
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
 
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -66,16 +61,15 @@ TEST(kolodkin_g_multiplication_matrix__task_seq, test_pipeline_run) {
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
 }
 
 TEST(kolodkin_g_multiplication_matrix__task_seq, test_task_run) {
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS a(400, 400);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS b(400, 400);
-  std::vector<Complex> in = {};
-  std::vector<Complex> in_a;
-  std::vector<Complex> in_b;
-  std::vector<Complex> out(a.numCols * b.numRows * 100, 0);
+  std::vector<std::byte> in_a;
+  std::vector<std::byte> in_b;
+  std::vector<std::byte> out(a.numCols * b.numRows * 100 * sizeof(Complex));
 
   for (unsigned int i = 0; i < 150; i++) {
     for (unsigned int j = 0; j < 150; j++) {
@@ -87,20 +81,15 @@ TEST(kolodkin_g_multiplication_matrix__task_seq, test_task_run) {
       b.AddValue((int)i, Complex(-100 + (rand() % 100), -100 + (rand() % 100)), (int)j);
     }
   }
-  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(a);
-  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(b);
-  in.reserve(in_a.size() + in_b.size());
-  for (unsigned int i = 0; i < in_a.size(); i++) {
-    in.emplace_back(in_a[i]);
-  }
-  for (unsigned int i = 0; i < in_b.size(); i++) {
-    in.emplace_back(in_b[i]);
-  }
+  in_a = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(a);
+  in_b = kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(b);
 
   // Create task_data
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_a.data()));
+  task_data_seq->inputs_count.emplace_back(in_a.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_b.data()));
+  task_data_seq->inputs_count.emplace_back(in_b.size());
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
@@ -125,5 +114,5 @@ TEST(kolodkin_g_multiplication_matrix__task_seq, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
   kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS res =
-      kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(out);
+      kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(out.data(), out.size());
 }
@@ -1,11 +1,34 @@
 #include "seq/kolodkin_g_multiplication_matrix_CRS/include/ops_seq.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <span>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+
+namespace {
+
+// Opens `view` over a buffer of the task data; false unless it holds a well-formed complex CSR matrix, whose
+// pointers and indices are then safe to follow
+bool OpenCsr(const uint8_t* data, std::size_t size, ppc::core::SparseFileView<Complex>& view) {
+  try {
+    view = ppc::core::SparseFileView<Complex>(reinterpret_cast<const std::byte*>(data), size);
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  return view.Layout() == ppc::core::SparseLayout::kCsr;
+}
+
+}  // namespace
+
 void kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; ++j) {
     if (colIndices[j] == col) {
@@ -32,24 +55,11 @@ bool kolodkin_g_multiplication_matrix_seq::AreEqualElems(const Complex& a, const
   return std::abs(a.real() - b.real()) < epsilon && std::abs(a.imag() - b.imag()) < epsilon;
 }
 
-std::vector<Complex> kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoVec(const SparseMatrixCRS& mat) {
-  std::vector<Complex> res = {};
-  res.reserve(5 + mat.values.size() + mat.colIndices.size() + mat.rowPtr.size());
-  res.emplace_back((double)mat.numRows);
-  res.emplace_back((double)mat.numCols);
-  res.emplace_back((double)mat.values.size());
-  res.emplace_back((double)mat.colIndices.size());
-  res.emplace_back((double)mat.rowPtr.size());
-  for (unsigned int i = 0; i < (unsigned int)mat.values.size(); i++) {
-    res.emplace_back(mat.values[i]);
-  }
-  for (unsigned int i = 0; i < (unsigned int)mat.colIndices.size(); i++) {
-    res.emplace_back(mat.colIndices[i]);
-  }
-  for (unsigned int i = 0; i < (unsigned int)mat.rowPtr.size(); i++) {
-    res.emplace_back(mat.rowPtr[i]);
-  }
-  return res;
+std::vector<std::byte> kolodkin_g_multiplication_matrix_seq::ParseMatrixIntoBytes(const SparseMatrixCRS& mat,
+                                                                                  ppc::core::SparseIndexCoding coding) {
+  const ppc::core::CsrMatrix<Complex> csr = {
+      .rows = mat.numRows, .cols = mat.numCols, .row_ptr = mat.rowPtr, .col_idx = mat.colIndices, .values = mat.values};
+  return ppc::core::EncodeSparse(csr, coding);
 }
 bool kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(
     const kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS& a,
@@ -80,79 +90,64 @@ bool kolodkin_g_multiplication_matrix_seq::CheckMatrixesEquality(
   }
   return true;
 }
-kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS kolodkin_g_multiplication_matrix_seq::ParseVectorIntoMatrix(
-    std::vector<Complex>& vec) {
+kolodkin_g_multiplication_matrix_seq::SparseMatrixCRS kolodkin_g_multiplication_matrix_seq::ParseBytesIntoMatrix(
+    const std::byte* data, std::size_t size) {
+  ppc::core::CsrMatrix<Complex> csr = ppc::core::SparseFileView<Complex>(data, size).ToCsr();
   SparseMatrixCRS res;
-  res.numRows = (int)vec[0].real();
-  res.numCols = (int)vec[1].real();
-  auto values_size = (unsigned int)vec[2].real();
-  auto col_indices_size = (unsigned int)vec[3].real();
-  auto row_ptr_size = (unsigned int)vec[4].real();
-  res.values.reserve(values_size);
-  res.colIndices.reserve(col_indices_size);
-  res.rowPtr.reserve(row_ptr_size);
-  for (unsigned int i = 0; i < values_size; i++) {
-    res.values.emplace_back(vec[5 + i]);
-  }
-  for (unsigned int i = 0; i < col_indices_size; i++) {
-    res.colIndices.emplace_back((int)vec[5 + values_size + i].real());
-  }
-  for (unsigned int i = 0; i < row_ptr_size; i++) {
-    res.rowPtr.emplace_back((int)vec[5 + values_size + col_indices_size + i].real());
-  }
+  res.numRows = csr.rows;
+  res.numCols = csr.cols;
+  res.values = std::move(csr.values);
+  res.colIndices = std::move(csr.col_idx);
+  res.rowPtr = std::move(csr.row_ptr);
   return res;
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PreProcessingImpl() {
-  // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
-  input_ = std::vector<Complex>(in_ptr, in_ptr + input_size);
-  std::vector<Complex> matrix_a = {};
-  std::vector<Complex> matrix_b = {};
-  matrix_a.reserve(5 + (unsigned int)(input_[2].real() + input_[3].real() + input_[4].real()));
-  matrix_b.reserve(input_.size() - (unsigned int)(5 + input_[2].real() + input_[3].real() + input_[4].real()));
-  for (unsigned int i = 0; i < (unsigned int)(5 + input_[2].real() + input_[3].real() + input_[4].real()); i++) {
-    matrix_a.emplace_back(input_[i]);
-  }
-  for (auto i = (unsigned int)(5 + input_[2].real() + input_[3].real() + input_[4].real());
-       i < (unsigned int)input_.size(); i++) {
-    matrix_b.emplace_back(input_[i]);
-  }
-  A_ = ParseVectorIntoMatrix(matrix_a);
-  B_ = ParseVectorIntoMatrix(matrix_b);
-  return true;
+  // The views point into the input buffers: nothing is copied or converted
+  return OpenCsr(task_data->inputs[0], task_data->inputs_count[0], A_) &&
+         OpenCsr(task_data->inputs[1], task_data->inputs_count[1], B_);
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::ValidationImpl() {
-  // Check equality of counts elements
-  unsigned int input_size = task_data->inputs_count[0];
-  auto* in_ptr = reinterpret_cast<Complex*>(task_data->inputs[0]);
-  std::vector<Complex> vec = std::vector<Complex>(in_ptr, in_ptr + input_size);
-  return !(vec[1] != vec[5 + (int)(vec[2].real() + vec[3].real() + vec[4].real())].real());
+  if (task_data->inputs.size() != 2 || task_data->inputs_count.size() != 2 || task_data->outputs.size() != 1 ||
+      task_data->outputs_count.size() != 1) {
+    return false;
+  }
+  // The whole encodings are checked, not just their headers, since RunImpl follows their pointers unchecked
+  ppc::core::SparseFileView<Complex> a;
+  ppc::core::SparseFileView<Complex> b;
+  return OpenCsr(task_data->inputs[0], task_data->inputs_count[0], a) &&
+         OpenCsr(task_data->inputs[1], task_data->inputs_count[1], b) && a.Cols() == b.Rows();
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-  for (unsigned int i = 0; i < (unsigned int)A_.numRows; ++i) {
-    for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-      unsigned int col_a = A_.colIndices[j];
-      Complex value_a = A_.values[j];
-      for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-        unsigned int col_b = B_.colIndices[k];
-        Complex value_b = B_.values[k];
-
-        c.AddValue((int)i, value_a * value_b, (int)col_b);
+  const std::span<const int> a_ptr = A_.Pointers();
+  const std::span<const int> a_idx = A_.Indices();
+  const std::span<const Complex> a_val = A_.Values();
+  const std::span<const int> b_ptr = B_.Pointers();
+  const std::span<const int> b_idx = B_.Indices();
+  const std::span<const Complex> b_val = B_.Values();
+  // Products are appended as triplets and summed once at the end, instead of searching the row on every insert
+  ppc::core::TripletBuilder<Complex> builder(A_.Rows(), B_.Cols());
+  for (int i = 0; i < A_.Rows(); ++i) {
+    for (int j = a_ptr[i]; j < a_ptr[i + 1]; ++j) {
+      const int col_a = a_idx[j];
+      const Complex value_a = a_val[j];
+      for (int k = b_ptr[col_a]; k < b_ptr[col_a + 1]; ++k) {
+        builder.Add(i, b_idx[k], value_a * b_val[k]);
       }
     }
   }
-  output_ = ParseMatrixIntoVec(c);
+  ppc::core::CsrMatrix<Complex> product = builder.BuildCsr();
+  output_ = ppc::core::EncodeSparse(product);
   return true;
 }
 
 bool kolodkin_g_multiplication_matrix_seq::TestTaskSequential::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<Complex*>(task_data->outputs[0])[i] = output_[i];
+  // outputs_count[0] is the size of the output buffer in bytes
+  if (output_.size() > task_data->outputs_count[0]) {
+    return false;
   }
+  std::ranges::copy(output_, reinterpret_cast<std::byte*>(task_data->outputs[0]));
   return true;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/kondratev_ya_ccs_complex_multiplication/include/ops_seq.hpp"
 
@@ -102,7 +103,7 @@ struct Matrices {
   kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix &out;
 };
 
-void RunTest(Matrices matrices) {
+void RunTest(Matrices matrices, ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved) {
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
 
   task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(&matrices.in1));
@@ -112,7 +113,7 @@ void RunTest(Matrices matrices) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(&matrices.out));
   task_data_seq->outputs_count.emplace_back(1);
 
-  kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential test_task_sequential(task_data_seq);
+  kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential test_task_sequential(task_data_seq, storage);
   ASSERT_TRUE(test_task_sequential.Validation());
   ASSERT_TRUE(test_task_sequential.PreProcessing());
   ASSERT_TRUE(test_task_sequential.Run());
@@ -274,6 +275,20 @@ TEST(kondratev_ya_ccs_complex_multiplication_seq, random_matrix_multiplication)
   CCSExpectEqual(ccs_c, ccs_expected);
 }
 
+TEST(kondratev_ya_ccs_complex_multiplication_seq, split_storage_random_matrix_multiplication) {
+  auto a = GenerateRandomSparseMatrix({60, 45}, 0.1);
+  auto b = GenerateRandomSparseMatrix({45, 70}, 0.1);
+
+  auto ccs_a = ConvertToCCS(a, {60, 45});
+  auto ccs_b = ConvertToCCS(b, {45, 70});
+  kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix interleaved({60, 70});
+  kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix split({60, 70});
+
+  RunTest({.in1 = ccs_a, .in2 = ccs_b, .out = interleaved});
+  RunTest({.in1 = ccs_a, .in2 = ccs_b, .out = split}, ppc::core::ComplexStorage::kSplit);
+  CCSExpectEqual(split, interleaved);
+}
+
 TEST(kondratev_ya_ccs_complex_multiplication_seq, test_incompatible_matrix_sizes) {
   auto a = GenerateRandomSparseMatrix({3, 2}, 0.2);
   auto b = GenerateRandomSparseMatrix({3, 4}, 0.2);
@@ -3,8 +3,40 @@
 #include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
+#include <functional>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+
+namespace kondratev_ya_ccs_complex_multiplication_seq {
+namespace {
+// Entries of the split product that are not IsZero, which are the ones CCSMatrix::operator* keeps
+CCSMatrix CollectNonZeros(const ppc::core::SplitCscMatrix<double> &product) {
+  CCSMatrix result({product.rows, product.cols});
+  for (int col = 0; col < product.cols; col++) {
+    for (int k = product.col_ptr[col]; k < product.col_ptr[col + 1]; k++) {
+      const std::complex<double> value(product.real[k], product.imag[k]);
+      if (!IsZero(value)) {
+        result.values.emplace_back(value);
+        result.row_index.emplace_back(product.row_idx[k]);
+      }
+    }
+    result.col_ptrs[col + 1] = static_cast<int>(result.values.size());
+  }
+  return result;
+}
+
+ppc::core::SplitCscMatrix<double> ToSplit(const CCSMatrix &matrix) {
+  return ppc::core::SplitCscMatrix<double>::FromInterleaved({.rows = matrix.rows,
+                                                             .cols = matrix.cols,
+                                                             .col_ptr = matrix.col_ptrs,
+                                                             .row_idx = matrix.row_index,
+                                                             .values = matrix.values});
+}
+}  // namespace
+}  // namespace kondratev_ya_ccs_complex_multiplication_seq
+
 bool kondratev_ya_ccs_complex_multiplication_seq::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
 }
@@ -26,6 +58,10 @@ bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::PreProcess
     return false;
   }
 
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_a_ = ToSplit(a_);
+    split_b_ = ToSplit(b_);
+  }
   return true;
 }
 
@@ -35,7 +71,11 @@ bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::Validation
 }
 
 bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::RunImpl() {
-  c_ = a_ * b_;
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    c_ = CollectNonZeros(split_a_.Multiply(split_b_));
+  } else {
+    c_ = a_ * b_;
+  }
   return true;
 }
 
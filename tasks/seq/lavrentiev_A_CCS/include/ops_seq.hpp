@@ -1,32 +1,20 @@
 #pragma once
 
-#include <cmath>
 #include <utility>
-#include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lavrentiev_a_ccs_seq {
 
-struct Sparse {
-  std::pair<int, int> size;
-  std::vector<double> elements;
-  std::vector<int> rows;
-  std::vector<int> columnsSum;
-};
-
 class CCSSequential : public ppc::core::Task {
  private:
-  [[nodiscard]] bool IsEmpty() const;
-  static Sparse ConvertToSparse(std::pair<int, int> bsize, const std::vector<double>& values);
-  static Sparse Transpose(const Sparse& sparse);
-  static Sparse MatMul(const Sparse& matrix1, const Sparse& matrix2);
-  static int GetElementsCount(int index, const std::vector<int>& columns_sum);
-  static std::vector<double> ConvertFromSparse(const Sparse& matrix);
+  static ppc::core::CscMatrix<double> MatMul(const ppc::core::CsrMatrix<double>& matrix1,
+                                             const ppc::core::CscMatrix<double>& matrix2);
 
-  Sparse A_;
-  Sparse B_;
-  Sparse Answer_;
+  ppc::core::CsrMatrix<double> A_;
+  ppc::core::CscMatrix<double> B_;
+  ppc::core::CscMatrix<double> Answer_;
 
  public:
   explicit CCSSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
@@ -36,4 +24,4 @@ class CCSSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 };
 
-}  // namespace lavrentiev_a_ccs_seq
\ No newline at end of file
+}  // namespace lavrentiev_a_ccs_seq
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool moiseev_a_mult_mat_seq::MultMatSequential::PreProcessingImpl() {
   unsigned int input_size_a = task_data->inputs_count[0];
   unsigned int input_size_b = task_data->inputs_count[1];
@@ -46,19 +48,10 @@ bool moiseev_a_mult_mat_seq::MultMatSequential::RunImpl() {
         int a_col_start = a_block_col * block_size_;
         int b_row_start = b_block_row * block_size_;
 
-        for (int row_offset = 0; row_offset < block_size_; ++row_offset) {
-          for (int col_offset = 0; col_offset < block_size_; ++col_offset) {
-            double block_result = 0.0;
-            for (int inner_dim_offset = 0; inner_dim_offset < block_size_; ++inner_dim_offset) {
-              double a_element =
-                  matrix_a_[((block_row_start + row_offset) * matrix_size_) + (a_col_start + inner_dim_offset)];
-              double b_element =
-                  matrix_b_[((b_row_start + inner_dim_offset) * matrix_size_) + (block_col_start + col_offset)];
-              block_result += a_element * b_element;
-            }
-            matrix_c_[((block_row_start + row_offset) * matrix_size_) + (block_col_start + col_offset)] += block_result;
-          }
-        }
+        ppc::core::Gemm(block_size_, block_size_, block_size_,
+                        &matrix_a_[(block_row_start * matrix_size_) + a_col_start], matrix_size_,
+                        &matrix_b_[(b_row_start * matrix_size_) + block_col_start], matrix_size_,
+                        &matrix_c_[(block_row_start * matrix_size_) + block_col_start], matrix_size_);
       }
     }
   }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sample_sort_seq {
+
+// Sample sort: splitters are taken from an oversampled random sample, every element is classified into
+// its bucket and the buckets are sorted one by one; reference version of the parallel sample sorts.
+template <typename T>
+class SampleSortSequential : public ppc::core::Task {
+ public:
+  explicit SampleSortSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  static void Sort(std::vector<T>& data);
+
+ private:
+  std::vector<T> data_;
+};
+
+}  // namespace nesterov_a_sample_sort_seq
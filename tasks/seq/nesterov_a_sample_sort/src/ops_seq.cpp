@@ -0,0 +1,111 @@
+#include "seq/nesterov_a_sample_sort/include/ops_seq.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kSequentialThreshold = 1 << 12;
+constexpr std::size_t kBuckets = 64;
+constexpr std::size_t kOversampling = 16;
+
+template <typename T>
+std::vector<T> PickSplitters(const std::vector<T>& data, std::size_t buckets) {
+  const std::size_t sample_size = std::min(data.size(), buckets * kOversampling);
+  std::mt19937_64 gen(data.size());
+  std::uniform_int_distribution<std::size_t> dist(0, data.size() - 1);
+
+  std::vector<T> sample(sample_size);
+  for (auto& s : sample) {
+    s = data[dist(gen)];
+  }
+  std::ranges::sort(sample);
+
+  std::vector<T> splitters;
+  splitters.reserve(buckets - 1);
+  for (std::size_t i = 1; i < buckets; ++i) {
+    const T& candidate = sample[(i * sample_size) / buckets];
+    if (splitters.empty() || splitters.back() < candidate) {
+      splitters.push_back(candidate);
+    }
+  }
+  return splitters;
+}
+
+// Buckets alternate between open intervals and single splitter values: bucket 2j holds keys lying
+// between splitters j-1 and j, bucket 2j+1 holds keys equal to splitter j and never needs sorting.
+template <typename T>
+std::uint32_t Classify(const std::vector<T>& splitters, const T& value) {
+  const auto it = std::ranges::lower_bound(splitters, value);
+  const auto j = static_cast<std::uint32_t>(it - splitters.begin());
+  return (it != splitters.end() && !(value < *it)) ? (2 * j) + 1 : 2 * j;
+}
+
+}  // namespace
+
+template <typename T>
+void nesterov_a_sample_sort_seq::SampleSortSequential<T>::Sort(std::vector<T>& data) {
+  const std::size_t n = data.size();
+  if (n < kSequentialThreshold) {
+    std::ranges::sort(data);
+    return;
+  }
+
+  const auto splitters = PickSplitters(data, kBuckets);
+  const std::size_t num_buckets = (2 * splitters.size()) + 1;
+
+  std::vector<std::uint32_t> bucket_of(n);
+  std::vector<std::size_t> bucket_begin(num_buckets + 1, 0);
+  for (std::size_t i = 0; i < n; ++i) {
+    bucket_of[i] = Classify(splitters, data[i]);
+    ++bucket_begin[bucket_of[i] + 1];
+  }
+  for (std::size_t b = 0; b < num_buckets; ++b) {
+    bucket_begin[b + 1] += bucket_begin[b];
+  }
+
+  std::vector<T> buffer(n);
+  std::vector<std::size_t> pos(bucket_begin.begin(), bucket_begin.end() - 1);
+  for (std::size_t i = 0; i < n; ++i) {
+    buffer[pos[bucket_of[i]]++] = data[i];
+  }
+
+  for (std::size_t b = 0; b < num_buckets; b += 2) {
+    std::sort(buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b]),
+              buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]));
+  }
+
+  data.swap(buffer);
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_seq::SampleSortSequential<T>::PreProcessingImpl() {
+  auto* in_ptr = reinterpret_cast<T*>(task_data->inputs[0]);
+  data_ = std::vector<T>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_seq::SampleSortSequential<T>::ValidationImpl() {
+  return task_data->inputs.size() == 1 && task_data->outputs.size() == 1 &&
+         task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_seq::SampleSortSequential<T>::RunImpl() {
+  Sort(data_);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_seq::SampleSortSequential<T>::PostProcessingImpl() {
+  std::ranges::copy(data_, reinterpret_cast<T*>(task_data->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sample_sort_seq::SampleSortSequential<int>;
+template class nesterov_a_sample_sort_seq::SampleSortSequential<std::int64_t>;
+template class nesterov_a_sample_sort_seq::SampleSortSequential<double>;
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+#include "core/task/include/task.hpp"
+#include "seq/nesterov_a_spmv/include/ops_seq.hpp"
+
+namespace {
+
+constexpr int kRows = 200000;
+constexpr int kEntriesPerRow = 20;
+
+ppc::core::CsrMatrix<double> GenerateMatrix() {
+  std::mt19937 gen(kRows);
+  std::uniform_int_distribution<int> col_dist(0, kRows - 1);
+  std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+  ppc::core::CsrMatrix<double> matrix;
+  matrix.rows = kRows;
+  matrix.cols = kRows;
+  std::vector<int> row(kEntriesPerRow);
+  for (int i = 0; i < kRows; ++i) {
+    std::ranges::generate(row, [&] { return col_dist(gen); });
+    std::ranges::sort(row);
+    const auto last = std::ranges::unique(row).begin();
+    for (auto it = row.begin(); it != last; ++it) {
+      matrix.col_idx.push_back(*it);
+      matrix.values.push_back(value_dist(gen));
+    }
+    matrix.row_ptr.push_back(static_cast<int>(matrix.col_idx.size()));
+  }
+  return matrix;
+}
+
+void RunPerf(ppc::core::SpmvFormat format, bool whole_pipeline) {
+  const ppc::core::CsrMatrix<double> matrix = GenerateMatrix();
+  std::vector<std::byte> encoded = ppc::core::EncodeSparse(matrix);
+  std::vector<double> x(kRows);
+  for (int j = 0; j < kRows; ++j) {
+    x[j] = std::sin(j);
+  }
+  std::vector<double> y(kRows);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(encoded.data()));
+  task_data_seq->inputs_count.emplace_back(encoded.size());
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_seq->inputs_count.emplace_back(x.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(y.data()));
+  task_data_seq->outputs_count.emplace_back(y.size());
+
+  auto test_task_seq = std::make_shared<nesterov_a_spmv_seq::SpmvSequential>(task_data_seq, format);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_seq);
+  if (whole_pipeline) {
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+  } else {
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+  }
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::vector<double> expected(kRows);
+  matrix.MultiplyVector(x.data(), expected.data());
+  for (int i = 0; i < kRows; ++i) {
+    ASSERT_NEAR(y[i], expected[i], 1e-12);
+  }
+}
+
+}  // namespace
+
+TEST(nesterov_a_spmv_seq, test_pipeline_run) { RunPerf(ppc::core::SpmvFormat::kCsr, true); }
+
+TEST(nesterov_a_spmv_seq, test_task_run) { RunPerf(ppc::core::SpmvFormat::kCsr, false); }
+
+TEST(nesterov_a_spmv_seq, test_task_run_sell) { RunPerf(ppc::core::SpmvFormat::kSell, false); }
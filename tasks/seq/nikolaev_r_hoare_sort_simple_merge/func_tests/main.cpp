@@ -124,4 +124,33 @@ TEST(nikolaev_r_hoare_sort_simple_merge_seq, test_input_and_output_sizes_not_equ
   nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential hoare_sort_simple_merge_sequential(
       task_data_seq);
   ASSERT_FALSE(hoare_sort_simple_merge_sequential.Validation());
-}
\ No newline at end of file
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_seq, test_few_unique_values) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dis(0, 3);
+  std::vector<double> in(200000);
+  for (auto &x : in) {
+    x = dis(gen);
+  }
+  std::vector<double> out(in.size(), 0.0);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_seq->inputs_count.emplace_back(in.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential hoare_sort_simple_merge_sequential(
+      task_data_seq);
+  ASSERT_TRUE(hoare_sort_simple_merge_sequential.Validation());
+  ASSERT_TRUE(hoare_sort_simple_merge_sequential.PreProcessing());
+  ASSERT_TRUE(hoare_sort_simple_merge_sequential.Run());
+  ASSERT_TRUE(hoare_sort_simple_merge_sequential.PostProcessing());
+
+  std::vector<double> ref(in.size());
+  std::ranges::copy(in, ref.begin());
+  std::ranges::sort(ref);
+
+  EXPECT_EQ(out, ref);
+}
@@ -1,10 +1,22 @@
 #include "../include/ops_seq.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <random>
 #include <vector>
 
+namespace {
+
+std::minstd_rand &PivotGenerator() {
+  thread_local std::minstd_rand gen(std::random_device{}());
+  return gen;
+}
+
+int DepthLimit(std::size_t n) { return 2 * static_cast<int>(std::bit_width(n)); }
+
+}  // namespace
+
 bool nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -31,11 +43,8 @@ bool nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential::Pos
 }
 
 size_t nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential::Partition(size_t low, size_t high) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(static_cast<int>(low), static_cast<int>(high));
-
-  size_t random_pivot_index = dist(gen);
+  std::uniform_int_distribution<size_t> dist(low, high);
+  size_t random_pivot_index = dist(PivotGenerator());
   double pivot = vect_[random_pivot_index];
 
   std::swap(vect_[random_pivot_index], vect_[low]);
@@ -56,9 +65,25 @@ void nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential::Qui
   if (low >= high) {
     return;
   }
+  IntroSort(low, high, DepthLimit(high - low + 1));
+}
+
+void nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential::IntroSort(size_t low, size_t high,
+                                                                                       int depth) {
+  if (low >= high) {
+    return;
+  }
+  if (depth == 0) {
+    // Too many unbalanced partitions on this path: finish the range with heapsort
+    const auto first = vect_.begin() + static_cast<std::ptrdiff_t>(low);
+    const auto last = vect_.begin() + static_cast<std::ptrdiff_t>(high) + 1;
+    std::make_heap(first, last);
+    std::sort_heap(first, last);
+    return;
+  }
   size_t pivot = Partition(low, high);
   if (pivot > low) {
-    QuickSort(low, pivot - 1);
+    IntroSort(low, pivot - 1, depth - 1);
   }
-  QuickSort(pivot + 1, high);
+  IntroSort(pivot + 1, high, depth - 1);
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <cmath>
 #include <cstddef>
 #include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
 using namespace std;
 void odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::ShiftRow(std::vector<double>& matrix, int root,
                                                                           int row, int shift) {
@@ -100,16 +103,6 @@ int odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::GetBlockSize(int
   }
   return 1;
 }
-void odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::CopyBlock(const std::vector<double>& matrix,
-                                                                           std::vector<double>& block, int start,
-                                                                           int root, int block_sz) {
-  for (int i = 0; i < block_sz; i++) {
-    for (int j = 0; j < block_sz; j++) {
-      int index = start + (i * root) + j;
-      block[(i * block_sz) + j] = matrix[index];
-    }
-  }
-}
 void odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::InitializeShift(std::vector<double>& matrix, int root,
                                                                                  int grid_size, int block_sz,
                                                                                  bool is_row_shift) {
@@ -152,9 +145,6 @@ bool odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::ValidationImpl(
 bool odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::RunImpl() {
   int root = static_cast<int>(sqrt(szA_));
 
-  std::vector<double> block_a(block_sz_ * block_sz_, 0);
-  std::vector<double> block_b(block_sz_ * block_sz_, 0);
-
   int grid_size = root / block_sz_;
 
   InitializeShift(matrixA_, root, grid_size, block_sz_, true);
@@ -164,19 +154,8 @@ bool odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::RunImpl() {
     for (int bi = 0; bi < root / block_sz_; bi++) {
       for (int bj = 0; bj < root / block_sz_; bj++) {
         int start = ((bi * block_sz_) * root) + (bj * block_sz_);
-
-        CopyBlock(matrixA_, block_a, start, root, block_sz_);
-        CopyBlock(matrixB_, block_b, start, root, block_sz_);
-
-        for (int i = 0; i < block_sz_; i++) {
-          for (int k = 0; k < block_sz_; k++) {
-            double a_ik = block_a[(i * block_sz_) + k];
-            for (int j = 0; j < block_sz_; j++) {
-              int index = (((bi * block_sz_) + i) * root) + ((bj * block_sz_) + j);
-              matrixC_[index] += a_ik * block_b[(k * block_sz_) + j];
-            }
-          }
-        }
+        ppc::core::Gemm(block_sz_, block_sz_, block_sz_, &matrixA_[start], root, &matrixB_[start], root,
+                        &matrixC_[start], root);
       }
     }
 
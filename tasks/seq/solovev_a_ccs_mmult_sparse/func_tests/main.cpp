@@ -8,6 +8,7 @@
 #include <random>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse.hpp"
 
@@ -23,6 +24,42 @@ bool AreComplexNumbersApproxEqual(const std::complex<double>& c1, const std::com
                                   double tolerance = 1e-6) {
   return std::abs(c1.real() - c2.real()) < tolerance && std::abs(c1.imag() - c2.imag()) < tolerance;
 }
+
+// rows x cols with up to per_col random entries in every column, at distinct rows in increasing order
+solovev_a_matrix::MatrixInCcsSparse GenerateRandomMatrix(int rows, int cols, int per_col) {
+  static std::mt19937 gen(std::random_device{}());
+  std::bernoulli_distribution take(static_cast<double>(per_col) / rows);
+  solovev_a_matrix::MatrixInCcsSparse matrix(rows, cols);
+  matrix.col_p.assign(cols + 1, 0);
+  for (int j = 0; j < cols; j++) {
+    for (int i = 0; i < rows; i++) {
+      if (take(gen)) {
+        matrix.row.push_back(i);
+        matrix.val.push_back(GenerateRandomComplex(-10.0, 10.0));
+      }
+    }
+    matrix.col_p[j + 1] = static_cast<int>(matrix.row.size());
+  }
+  matrix.n_z = static_cast<int>(matrix.row.size());
+  return matrix;
+}
+
+solovev_a_matrix::MatrixInCcsSparse Multiply(solovev_a_matrix::MatrixInCcsSparse& m1,
+                                             solovev_a_matrix::MatrixInCcsSparse& m2,
+                                             ppc::core::ComplexStorage storage) {
+  solovev_a_matrix::MatrixInCcsSparse m3;
+  std::shared_ptr<ppc::core::TaskData> task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&m1));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&m2));
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(&m3));
+
+  solovev_a_matrix::SeqMatMultCcs task(task_data, storage);
+  EXPECT_TRUE(task.ValidationImpl());
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+  return m3;
+}
 }  // namespace
 
 TEST(solovev_a_ccs_mmult_sparse, test_I) {
@@ -292,3 +329,18 @@ TEST(solovev_a_ccs_mmult_sparse, test_identity_multiplication) {
     ASSERT_EQ(result.val[i], a.val[i]);
   }
 }
+
+TEST(solovev_a_ccs_mmult_sparse, test_split_storage_random) {
+  auto m1 = GenerateRandomMatrix(60, 40, 4);
+  auto m2 = GenerateRandomMatrix(40, 70, 5);
+
+  const auto interleaved = Multiply(m1, m2, ppc::core::ComplexStorage::kInterleaved);
+  const auto split = Multiply(m1, m2, ppc::core::ComplexStorage::kSplit);
+
+  ASSERT_EQ(split.n_z, interleaved.n_z);
+  ASSERT_EQ(split.col_p, interleaved.col_p);
+  ASSERT_EQ(split.row, interleaved.row);
+  for (int i = 0; i < split.n_z; i++) {
+    ASSERT_TRUE(AreComplexNumbersApproxEqual(split.val[i], interleaved.val[i], 1e-12));
+  }
+}
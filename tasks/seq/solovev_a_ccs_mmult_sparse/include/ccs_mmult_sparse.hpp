@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace solovev_a_matrix {
@@ -27,9 +28,13 @@ struct MatrixInCcsSparse {
   }
 };
 
+// With ComplexStorage::kSplit the product is formed on split real and imaginary arrays by the SIMD kernels of
+// ppc::core::SplitCscMatrix. Its structure and values are those of the default path, explicit zeros included.
 class SeqMatMultCcs : public ppc::core::Task {
  public:
-  explicit SeqMatMultCcs(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+  explicit SeqMatMultCcs(std::shared_ptr<ppc::core::TaskData> task_data,
+                         ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved)
+      : Task(std::move(task_data)), storage_(storage) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
@@ -37,5 +42,8 @@ class SeqMatMultCcs : public ppc::core::Task {
 
  private:
   MatrixInCcsSparse *M1_, *M2_, *M3_;
+  ppc::core::ComplexStorage storage_;
+  ppc::core::SplitCscMatrix<double> split_m1_;
+  ppc::core::SplitCscMatrix<double> split_m2_;
 };
 }  // namespace solovev_a_matrix
@@ -1,37 +1,37 @@
 #include "seq/tyurin_m_matmul_crs_complex/include/ops_seq.hpp"
 
-#include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
-#include <cstdio>
 #include <vector>
 
-namespace {
-MatrixCRS TransposeMatrixCRS(const MatrixCRS &crs) {
-  const auto new_cols = crs.GetRows();
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_order/include/sparse_order.hpp"
 
-  MatrixCRS res;
-  res.cols_count = new_cols;
-  res.rowptr.resize(crs.GetCols() + 2);
-  res.colind.resize(crs.colind.size(), 0);
-  res.data.resize(crs.data.size(), 0);
+namespace {
+ppc::core::CsrMatrix<std::complex<double>> ToCsrMatrix(const MatrixCRS &crs) {
+  ppc::core::CsrMatrix<std::complex<double>> matrix;
+  matrix.rows = static_cast<int>(crs.GetRows());
+  matrix.cols = static_cast<int>(crs.GetCols());
+  matrix.row_ptr.assign(crs.rowptr.begin(), crs.rowptr.end());
+  matrix.col_idx.assign(crs.colind.begin(), crs.colind.end());
+  matrix.values = crs.data;
+  return matrix;
+}
 
-  for (uint32_t i = 0; i < crs.data.size(); ++i) {
-    ++res.rowptr[crs.colind[i] + 2];
-  }
-  for (uint32_t i = 2; i < res.rowptr.size(); ++i) {
-    res.rowptr[i] += res.rowptr[i - 1];
-  }
-  for (uint32_t i = 0; i < new_cols; ++i) {
-    for (uint32_t j = crs.rowptr[i]; j < crs.rowptr[i + 1]; ++j) {
-      const auto new_index = res.rowptr[crs.colind[j] + 1]++;
-      res.data[new_index] = crs.data[j];
-      res.colind[new_index] = i;
+// Copies the product into res without the entries that sum to zero; value_at(e) is entry e of the product
+template <typename Product, typename ValueAt>
+void CopyNonZeros(const Product &product, const ValueAt &value_at, MatrixCRS &res) {
+  res.rowptr.assign(product.row_ptr.size(), 0);
+  for (std::size_t i = 0; i + 1 < product.row_ptr.size(); ++i) {
+    for (int e = product.row_ptr[i]; e < product.row_ptr[i + 1]; ++e) {
+      if (const std::complex<double> value = value_at(e); value != 0.0) {
+        res.data.push_back(value);
+        res.colind.push_back(static_cast<uint32_t>(product.col_idx[e]));
+      }
     }
+    res.rowptr[i + 1] = static_cast<uint32_t>(res.data.size());
   }
-  res.rowptr.pop_back();
-
-  return res;
 }
 }  // namespace
 
@@ -43,44 +43,47 @@ bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::ValidationImpl() {
 }
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::PreProcessingImpl() {
-  lhs_ = *reinterpret_cast<MatrixCRS *>(task_data->inputs[0]);
-  rhs_ = TransposeMatrixCRS(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  lhs_ = ToCsrMatrix(*reinterpret_cast<MatrixCRS *>(task_data->inputs[0]));
+  rhs_ = ToCsrMatrix(*reinterpret_cast<MatrixCRS *>(task_data->inputs[1]));
+  perm_.clear();
+  band_before_ = ppc::core::MeasureBandProfile(lhs_);
+  band_after_ = band_before_;
+  if (ordering_ != ppc::core::SparseOrdering::kNatural && lhs_.rows == lhs_.cols) {
+    perm_ = ppc::core::ComputeOrdering(lhs_, ordering_);
+    lhs_ = ppc::core::Permute(lhs_, perm_, perm_);
+    rhs_ = ppc::core::Permute(rhs_, perm_, {});
+    band_after_ = ppc::core::MeasureBandProfile(lhs_);
+  }
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_lhs_ = ppc::core::SplitCsrMatrix<double>::FromInterleaved(lhs_);
+    split_rhs_ = ppc::core::SplitCsrMatrix<double>::FromInterleaved(rhs_);
+  }
   res_ = {};
-  res_.rowptr.resize(lhs_.GetRows() + 1);
-  res_.cols_count = rhs_.GetRows();
+  res_.cols_count = static_cast<uint32_t>(rhs_.cols);
   return true;
 }
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::RunImpl() {
-  const auto rows = lhs_.GetRows();
-  const auto cols = rhs_.GetRows();
-
-  for (uint32_t i = 0; i < rows; ++i) {
-    for (uint32_t j = 0; j < cols; ++j) {
-      auto ii = lhs_.rowptr[i];
-      auto ij = rhs_.rowptr[j];
-      std::complex<double> summul = 0.0;
-      while (ii < lhs_.rowptr[i + 1] && ij < rhs_.rowptr[j + 1]) {
-        if (lhs_.colind[ii] < rhs_.colind[ij]) {
-          ++ii;
-        } else if (lhs_.colind[ii] > rhs_.colind[ij]) {
-          ++ij;
-        } else {
-          summul += lhs_.data[ii++] * rhs_.data[ij++];
-        }
-      }
-      if (summul != 0.0) {
-        res_.data.push_back(summul);
-        res_.colind.push_back(j);
-      }
-    }
-    res_.rowptr[i + 1] = res_.data.size();
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    const auto product = split_lhs_.Multiply(split_rhs_);
+    CopyNonZeros(product, [&](int e) { return std::complex<double>(product.real[e], product.imag[e]); }, res_);
+  } else {
+    const auto product = lhs_.Multiply(rhs_);
+    CopyNonZeros(product, [&](int e) { return product.values[e]; }, res_);
   }
-
   return true;
 }
 
 bool tyurin_m_matmul_crs_complex_seq::TestTaskSequential::PostProcessingImpl() {
-  *reinterpret_cast<MatrixCRS *>(task_data->outputs[0]) = res_;
+  auto &out = *reinterpret_cast<MatrixCRS *>(task_data->outputs[0]);
+  if (perm_.empty()) {
+    out = res_;
+    return true;
+  }
+  // Row i of the product is row perm_[i] of the result
+  const auto product = ppc::core::Permute(ToCsrMatrix(res_), ppc::core::InvertPermutation(perm_), {});
+  out = {};
+  out.cols_count = res_.cols_count;
+  CopyNonZeros(product, [&](int e) { return product.values[e]; }, out);
   return true;
 }
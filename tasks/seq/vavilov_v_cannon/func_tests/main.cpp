@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/vavilov_v_cannon/include/ops_seq.hpp"
 
@@ -53,7 +57,7 @@ TEST(vavilov_v_cannon_seq, test_random) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -81,7 +85,7 @@ TEST(vavilov_v_cannon_seq, test_fixed_4x4) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -107,7 +111,7 @@ TEST(vavilov_v_cannon_seq, test_invalid_size_1) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_FALSE(task_seq.Validation());
 }
 
@@ -128,7 +132,7 @@ TEST(vavilov_v_cannon_seq, test_225) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -161,7 +165,7 @@ TEST(vavilov_v_cannon_seq, test_identity_matrix) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -189,7 +193,7 @@ TEST(vavilov_v_cannon_seq, test_zero_matrix) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -217,7 +221,7 @@ TEST(vavilov_v_cannon_seq, test_15) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_TRUE(task_seq.Validation());
   task_seq.PreProcessing();
   task_seq.Run();
@@ -245,7 +249,205 @@ TEST(vavilov_v_cannon_seq, test_15_error_validation) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
   task_data_seq->outputs_count.emplace_back(c.size());
 
-  vavilov_v_cannon_seq::CannonSequential task_seq(task_data_seq);
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
   ASSERT_FALSE(task_seq.Validation());
 }
+// Runs the task on inputs rounded to T and compares against the double product of the rounded values
+template <typename T, typename AccT>
+void CheckPrecision(unsigned int n, unsigned int num_blocks, double tolerance) {
+  const std::vector<double> a_ref = GenerateRandomMatrix(n, -1.0, 1.0);
+  const std::vector<double> b_ref = GenerateRandomMatrix(n, -1.0, 1.0);
+  std::vector<T> a(a_ref.begin(), a_ref.end());
+  std::vector<T> b(b_ref.begin(), b_ref.end());
+  std::vector<AccT> c(n * n, 0);
+  const std::vector<double> expected_output =
+      MultMat(std::vector<double>(a.begin(), a.end()), std::vector<double>(b.begin(), b.end()), n);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.emplace_back(a.size());
+  task_data_seq->inputs_count.emplace_back(b.size());
+  task_data_seq->inputs_count.emplace_back(num_blocks);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+  task_data_seq->outputs_count.emplace_back(c.size());
+
+  vavilov_v_cannon_seq::CannonSequential<T, AccT> task_seq(task_data_seq);
+  ASSERT_TRUE(task_seq.Validation());
+  task_seq.PreProcessing();
+  task_seq.Run();
+  task_seq.PostProcessing();
+
+  for (unsigned int i = 0; i < n * n; i++) {
+    EXPECT_NEAR(expected_output[i], c[i], tolerance * n);
+  }
+}
+
+TEST(vavilov_v_cannon_seq, test_float) { CheckPrecision<float, float>(96, 4, 1e-6); }
+
+TEST(vavilov_v_cannon_seq, test_float_inputs_double_accumulation) { CheckPrecision<float, double>(96, 4, 1e-13); }
+
+TEST(vavilov_v_cannon_seq, test_tuned_block_count) {
+  constexpr unsigned int kN = 300;
+  std::vector<double> a(kN * kN, 1.0);
+  std::vector<double> b(kN * kN, 2.0);
+  std::vector<double> c(kN * kN, 0.0);
+  std::vector<double> expected_output(kN * kN, 2.0 * kN);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.emplace_back(a.size());
+  task_data_seq->inputs_count.emplace_back(b.size());
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+  task_data_seq->outputs_count.emplace_back(c.size());
+
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
+  ASSERT_TRUE(task_seq.Validation());
+  task_seq.PreProcessing();
+  task_seq.Run();
+  task_seq.PostProcessing();
+
+  for (unsigned int i = 0; i < kN * kN; i++) {
+    EXPECT_EQ(expected_output[i], c[i]);
+  }
+}
+
+template <typename T>
+std::shared_ptr<ppc::core::TaskData> BatchedTaskData(std::vector<T>& a, std::vector<T>& b, std::vector<T>& c, int n) {
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.emplace_back(a.size());
+  task_data_seq->inputs_count.emplace_back(b.size());
+  task_data_seq->inputs_count.emplace_back(n);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+  task_data_seq->outputs_count.emplace_back(c.size());
+  return task_data_seq;
+}
+
+// Every product of the batch is compared with MultMat on the same (rounded) values.
+template <typename T>
+void CheckBatched(int batch, int n, double tolerance) {
+  const auto size = static_cast<std::size_t>(n) * n;
+  std::vector<T> a(batch * size);
+  std::vector<T> b(batch * size);
+  std::vector<T> c(batch * size, 0);
+  for (int s = 0; s < batch; ++s) {
+    const std::vector<double> a_s = GenerateRandomMatrix(n, -1.0, 1.0);
+    const std::vector<double> b_s = GenerateRandomMatrix(n, -1.0, 1.0);
+    std::ranges::copy(a_s, a.begin() + static_cast<std::ptrdiff_t>(s * size));
+    std::ranges::copy(b_s, b.begin() + static_cast<std::ptrdiff_t>(s * size));
+  }
+
+  vavilov_v_cannon_seq::BatchedMatMulSequential<T> task_seq(BatchedTaskData(a, b, c, n));
+  ASSERT_TRUE(task_seq.Validation());
+  task_seq.PreProcessing();
+  task_seq.Run();
+  task_seq.PostProcessing();
+
+  for (int s = 0; s < batch; ++s) {
+    const auto first = a.begin() + static_cast<std::ptrdiff_t>(s * size);
+    const auto first_b = b.begin() + static_cast<std::ptrdiff_t>(s * size);
+    const std::vector<double> expected_output =
+        MultMat(std::vector<double>(first, first + static_cast<std::ptrdiff_t>(size)),
+                std::vector<double>(first_b, first_b + static_cast<std::ptrdiff_t>(size)), n);
+    for (std::size_t i = 0; i < size; i++) {
+      ASSERT_NEAR(expected_output[i], c[(s * size) + i], tolerance * n);
+    }
+  }
+}
+
 }  // namespace
+
+TEST(vavilov_v_cannon_seq, test_batched_fixed_size) { CheckBatched<double>(100, 8, 1e-14); }
+
+TEST(vavilov_v_cannon_seq, test_batched_other_size) { CheckBatched<double>(7, 13, 1e-14); }
+
+TEST(vavilov_v_cannon_seq, test_batched_float) { CheckBatched<float>(33, 16, 1e-6); }
+
+TEST(vavilov_v_cannon_seq, test_batched_single_matrix) { CheckBatched<double>(1, 64, 1e-14); }
+
+TEST(vavilov_v_cannon_seq, test_batched_validation) {
+  std::vector<double> a(40);
+  std::vector<double> b(40);
+  std::vector<double> c(40);
+  vavilov_v_cannon_seq::BatchedMatMulSequential<double> not_whole_matrices(BatchedTaskData(a, b, c, 4));
+  EXPECT_FALSE(not_whole_matrices.Validation());
+  vavilov_v_cannon_seq::BatchedMatMulSequential<double> zero_size(BatchedTaskData(a, b, c, 0));
+  EXPECT_FALSE(zero_size.Validation());
+  std::vector<double> c_short(32);
+  vavilov_v_cannon_seq::BatchedMatMulSequential<double> short_output(BatchedTaskData(a, b, c_short, 2));
+  EXPECT_FALSE(short_output.Validation());
+}
+
+// A is the 24 x 24 block at (3, 5) of a 40 x 40 matrix, B is passed as its transpose and C is column-major with
+// three padding rows, which must keep their value.
+TEST(vavilov_v_cannon_seq, test_views) {
+  constexpr int kN = 24;
+  constexpr int kNumblocks = 4;
+  constexpr int kBig = 40;
+  constexpr int kLdc = kN + 3;
+  std::vector<double> big = GenerateRandomMatrix(kBig);
+  std::vector<double> b_transposed = GenerateRandomMatrix(kN);
+  std::vector<double> c(kLdc * kN, -1.0);
+  std::array<ppc::core::MatrixDesc, 3> layouts = {
+      ppc::core::MatrixDesc{.rows = kN, .cols = kN, .ld = kBig},
+      ppc::core::MatrixDesc{.rows = kN, .cols = kN, .ld = kN, .transpose = true},
+      ppc::core::MatrixDesc{
+          .rows = kN, .cols = kN, .ld = kLdc, .transpose = false, .layout = ppc::core::MatrixLayout::kColumnMajor},
+  };
+  const int a_offset = (3 * kBig) + 5;
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(big.data() + a_offset));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b_transposed.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(layouts.data()));
+  task_data_seq->inputs_count.emplace_back(big.size() - a_offset);
+  task_data_seq->inputs_count.emplace_back(b_transposed.size());
+  task_data_seq->inputs_count.emplace_back(kNumblocks);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+  task_data_seq->outputs_count.emplace_back(c.size());
+
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
+  ASSERT_TRUE(task_seq.Validation());
+  task_seq.PreProcessing();
+  task_seq.Run();
+  task_seq.PostProcessing();
+
+  for (int j = 0; j < kN; j++) {
+    for (int i = 0; i < kLdc; i++) {
+      double expected = -1.0;
+      if (i < kN) {
+        expected = 0.0;
+        for (int p = 0; p < kN; p++) {
+          expected += big[a_offset + (i * kBig) + p] * b_transposed[(j * kN) + p];
+        }
+      }
+      EXPECT_NEAR(expected, c[(j * kLdc) + i], 1e-9);
+    }
+  }
+}
+
+TEST(vavilov_v_cannon_seq, test_view_outside_buffer) {
+  constexpr int kN = 8;
+  std::vector<double> a(kN * kN, 1.0);
+  std::vector<double> b(kN * kN, 1.0);
+  std::vector<double> c(kN * kN, 0.0);
+  // The leading dimension of A reaches past the end of its buffer
+  std::array<ppc::core::MatrixDesc, 3> layouts = {ppc::core::MatrixDesc{.rows = kN, .cols = kN, .ld = kN + 1},
+                                                  ppc::core::RowMajorDesc(kN, kN), ppc::core::RowMajorDesc(kN, kN)};
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(layouts.data()));
+  task_data_seq->inputs_count.emplace_back(a.size());
+  task_data_seq->inputs_count.emplace_back(b.size());
+  task_data_seq->inputs_count.emplace_back(2);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(c.data()));
+  task_data_seq->outputs_count.emplace_back(c.size());
+
+  vavilov_v_cannon_seq::CannonSequential<double> task_seq(task_data_seq);
+  EXPECT_FALSE(task_seq.Validation());
+}
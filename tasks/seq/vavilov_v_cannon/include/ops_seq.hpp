@@ -5,9 +5,15 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_seq {
+// A and B hold T values; C is accumulated and returned as AccT. CannonSequential<float> works in single
+// precision, CannonSequential<float, double> reads float inputs and accumulates in double.
+// Operands may be views: if inputs[2] is set it points to three ppc::core::MatrixDesc for A, B and C, which then
+// describe n x n submatrices, transposes or column-major matrices inside the buffers, and the counts only bound them.
+template <typename T, typename AccT = T>
 class CannonSequential : public ppc::core::Task {
  public:
   explicit CannonSequential(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -21,12 +27,33 @@ class CannonSequential : public ppc::core::Task {
   unsigned int N_;
   unsigned int block_size_;
   unsigned int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
+  const T *A_{};
+  const T *B_{};
+  std::vector<AccT> C_;
+  ppc::core::MatrixDesc desc_a_;
+  ppc::core::MatrixDesc desc_b_;
+  ppc::core::MatrixDesc desc_c_;
 
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
+  void BlockMultiply(unsigned int step);
+};
+
+// Strided batch of independent n x n products C_i = A_i * B_i, the matrices of each operand stored back to back.
+// Same inputs as CannonSequential except that inputs_count[2] holds n, so the batch size is inputs_count[0] / (n * n).
+template <typename T>
+class BatchedMatMulSequential : public ppc::core::Task {
+ public:
+  explicit BatchedMatMulSequential(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  int N_;
+  int batch_size_;
+  std::vector<T> A_;
+  std::vector<T> B_;
+  std::vector<T> C_;
 };
 }  // namespace vavilov_v_cannon_seq
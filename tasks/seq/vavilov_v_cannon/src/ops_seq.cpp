@@ -1,106 +1,155 @@
 #include "seq/vavilov_v_cannon/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
-bool vavilov_v_cannon_seq::CannonSequential::PreProcessingImpl() {
-  N_ = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
-  num_blocks_ = static_cast<unsigned int>(task_data->inputs_count[2]);
-  block_size_ = N_ / num_blocks_;
+#include "core/batched_gemm/include/batched_gemm.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/tuning/include/tuning.hpp"
 
-  auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
-  auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+namespace {
 
-  return true;
+// Descriptors of A, B and C if the caller passed them in inputs[2]
+const ppc::core::MatrixDesc *Layouts(const ppc::core::TaskData &data) {
+  return data.inputs.size() > 2 ? reinterpret_cast<const ppc::core::MatrixDesc *>(data.inputs[2]) : nullptr;
 }
 
-bool vavilov_v_cannon_seq::CannonSequential::ValidationImpl() {
-  if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
-      task_data->outputs_count[0] != task_data->inputs_count[0]) {
-    return false;
+// All three views are n x n and stay inside their buffers.
+bool ValidLayouts(const ppc::core::TaskData &data, const ppc::core::MatrixDesc *layouts) {
+  const std::size_t n = layouts[0].rows;
+  const std::array<std::size_t, 3> sizes = {data.inputs_count[0], data.inputs_count[1], data.outputs_count[0]};
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    if (!layouts[i].IsValid() || layouts[i].rows != n || layouts[i].cols != n || layouts[i].Span() > sizes[i]) {
+      return false;
+    }
   }
-
-  auto n = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
-  auto num_blocks = static_cast<unsigned int>(task_data->inputs_count[2]);
-  return n % num_blocks == 0;
+  return true;
 }
 
-void vavilov_v_cannon_seq::CannonSequential::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
+}  // namespace
 
-  for (unsigned int bi = 0; bi < num_blocks_; ++bi) {
-    for (unsigned int bj = 0; bj < num_blocks_; ++bj) {
-      unsigned int src_row = (bi + bj) % num_blocks_;
-      unsigned int src_col = (bj + bi) % num_blocks_;
-      for (unsigned int i = 0; i < block_size_; ++i) {
-        for (unsigned int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_seq::CannonSequential<T, AccT>::PreProcessingImpl() {
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    desc_a_ = layouts[0];
+    desc_b_ = layouts[1];
+    desc_c_ = layouts[2];
+  } else {
+    const auto n = static_cast<std::size_t>(std::sqrt(task_data->inputs_count[0]));
+    desc_a_ = desc_b_ = desc_c_ = ppc::core::RowMajorDesc(n, n);
+  }
+  N_ = static_cast<unsigned int>(desc_a_.rows);
+  num_blocks_ = task_data->inputs_count.size() > 2 ? static_cast<unsigned int>(task_data->inputs_count[2]) : 0;
+  if (num_blocks_ == 0) {
+    const auto block = static_cast<unsigned int>(ppc::core::NearestDivisor(N_, ppc::core::TunedMatrixBlockSize()));
+    num_blocks_ = std::max<unsigned int>(N_ / block, 1);
   }
+  block_size_ = N_ / num_blocks_;
+
+  A_ = reinterpret_cast<const T *>(task_data->inputs[0]);
+  B_ = reinterpret_cast<const T *>(task_data->inputs[1]);
+  C_.assign(N_ * N_, 0);
+
+  return true;
 }
 
-void vavilov_v_cannon_seq::CannonSequential::BlockMultiply() {
-  for (unsigned int bi = 0; bi < N_; bi += block_size_) {
-    for (unsigned int bj = 0; bj < N_; bj += block_size_) {
-      for (unsigned int i = bi; i < bi + block_size_; i++) {
-        for (unsigned int j = bj; j < bj + block_size_; j++) {
-          double temp = 0.0;
-          for (unsigned int k = 0; k < block_size_; k++) {
-            unsigned int row_a = bi + (i - bi);
-            unsigned int col_a = bj + k;
-            unsigned int row_b = bi + k;
-            unsigned int col_b = bj + (j - bj);
-
-            temp += A_[(row_a * N_) + col_a] * B_[(row_b * N_) + col_b];
-          }
-
-          C_[(i * N_) + j] += temp;
-        }
-      }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_seq::CannonSequential<T, AccT>::ValidationImpl() {
+  unsigned int n = 0;
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    if (!ValidLayouts(*task_data, layouts)) {
+      return false;
     }
+    n = static_cast<unsigned int>(layouts[0].rows);
+  } else {
+    if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
+        task_data->outputs_count[0] != task_data->inputs_count[0]) {
+      return false;
+    }
+    n = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
   }
+  // Without a block count, or with 0, PreProcessing picks one from the tuned block size
+  auto num_blocks = task_data->inputs_count.size() > 2 ? static_cast<unsigned int>(task_data->inputs_count[2]) : 0;
+  return num_blocks == 0 || n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_seq::CannonSequential::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
+// The skew and the shifts of Cannon's algorithm are applied to block indices instead of data: after the skew
+// and `step` shifts block (bi, bj) would hold A(bi, k) and B(k, bj) with k = (bi + bj + step) mod num_blocks,
+// so those blocks are read where they already are and A and B are never moved.
+template <typename T, typename AccT>
+void vavilov_v_cannon_seq::CannonSequential<T, AccT>::BlockMultiply(unsigned int step) {
+  const ppc::core::MatrixDesc block_a = desc_a_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_b = desc_b_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_c = ppc::core::RowMajorDesc(N_, N_).Block(block_size_, block_size_);
   for (unsigned int bi = 0; bi < num_blocks_; ++bi) {
     for (unsigned int bj = 0; bj < num_blocks_; ++bj) {
-      unsigned int src_row = (bi + 1) % num_blocks_;
-      unsigned int src_col = (bj + 1) % num_blocks_;
-      for (unsigned int i = 0; i < block_size_; ++i) {
-        for (unsigned int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
+      const unsigned int k = (bi + bj + step) % num_blocks_;
+      ppc::core::Gemm(block_a, A_ + desc_a_.Offset(bi * block_size_, k * block_size_), block_b,
+                      B_ + desc_b_.Offset(k * block_size_, bj * block_size_), block_c,
+                      &C_[(bi * block_size_ * N_) + (bj * block_size_)]);
     }
   }
 }
 
-bool vavilov_v_cannon_seq::CannonSequential::RunImpl() {
-  InitialShift();
+template <typename T, typename AccT>
+bool vavilov_v_cannon_seq::CannonSequential<T, AccT>::RunImpl() {
   for (unsigned int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply();
-    ShiftBlocks();
+    BlockMultiply(iter);
   }
   return true;
 }
 
-bool vavilov_v_cannon_seq::CannonSequential::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double*>(task_data->outputs[0]));
+template <typename T, typename AccT>
+bool vavilov_v_cannon_seq::CannonSequential<T, AccT>::PostProcessingImpl() {
+  ppc::core::CopyToMatrix(C_.data(), desc_c_, reinterpret_cast<AccT *>(task_data->outputs[0]));
   return true;
 }
+
+template <typename T>
+bool vavilov_v_cannon_seq::BatchedMatMulSequential<T>::PreProcessingImpl() {
+  N_ = static_cast<int>(task_data->inputs_count[2]);
+  batch_size_ = static_cast<int>(task_data->inputs_count[0] / (N_ * N_));
+
+  auto *a = reinterpret_cast<T *>(task_data->inputs[0]);
+  auto *b = reinterpret_cast<T *>(task_data->inputs[1]);
+  A_.assign(a, a + task_data->inputs_count[0]);
+  B_.assign(b, b + task_data->inputs_count[1]);
+  C_.assign(task_data->outputs_count[0], 0);
+
+  return true;
+}
+
+template <typename T>
+bool vavilov_v_cannon_seq::BatchedMatMulSequential<T>::ValidationImpl() {
+  if (task_data->inputs_count.size() < 3 || task_data->inputs_count[0] != task_data->inputs_count[1] ||
+      task_data->outputs_count[0] != task_data->inputs_count[0]) {
+    return false;
+  }
+
+  auto n = task_data->inputs_count[2];
+  return n > 0 && task_data->inputs_count[0] % (n * n) == 0;
+}
+
+template <typename T>
+bool vavilov_v_cannon_seq::BatchedMatMulSequential<T>::RunImpl() {
+  const auto stride = static_cast<std::size_t>(N_) * N_;
+  ppc::core::GemmStridedBatched(batch_size_, N_, N_, N_, A_.data(), N_, stride, B_.data(), N_, stride, C_.data(), N_,
+                                stride);
+  return true;
+}
+
+template <typename T>
+bool vavilov_v_cannon_seq::BatchedMatMulSequential<T>::PostProcessingImpl() {
+  std::ranges::copy(C_, reinterpret_cast<T *>(task_data->outputs[0]));
+  return true;
+}
+
+template class vavilov_v_cannon_seq::CannonSequential<double>;
+template class vavilov_v_cannon_seq::CannonSequential<float>;
+template class vavilov_v_cannon_seq::CannonSequential<float, double>;
+template class vavilov_v_cannon_seq::BatchedMatMulSequential<double>;
+template class vavilov_v_cannon_seq::BatchedMatMulSequential<float>;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace sort_bench {
+
+enum class Distribution : uint8_t { kUniform, kSorted, kReverse, kOrganPipe, kFewUnique, kZipf, kAllEqual };
+
+inline constexpr Distribution kAllDistributions[] = {
+    Distribution::kUniform,   Distribution::kSorted, Distribution::kReverse,  Distribution::kOrganPipe,
+    Distribution::kFewUnique, Distribution::kZipf,   Distribution::kAllEqual,
+};
+
+std::string_view DistributionName(Distribution distribution);
+std::optional<Distribution> ParseDistribution(std::string_view name);
+
+// Input of n keys with the given shape; the same seed always gives the same array.
+template <typename T>
+std::vector<T> Generate(Distribution distribution, std::size_t n, std::uint64_t seed);
+
+// Sorts data in place by running the full task pipeline on it. Returns the time of
+// PreProcessing + Run + PostProcessing in seconds, or nothing if the task rejected the input in Validation.
+template <typename T>
+using SortRunner = std::optional<double> (*)(std::vector<T>& data);
+
+struct SortEntry {
+  std::string name;  // "<backend>/<task directory>"
+  std::variant<SortRunner<std::int32_t>, SortRunner<std::int64_t>, SortRunner<double>> run;
+};
+
+std::string_view KeyName(const SortEntry& entry);
+
+// Every sort task of the seq/omp/tbb/stl backends whose input is a flat array of keys.
+const std::vector<SortEntry>& RegisteredSorts();
+
+}  // namespace sort_bench
@@ -0,0 +1,128 @@
+#include "sort_bench/include/sort_bench.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kFewUniqueValues = 16;
+constexpr std::size_t kZipfValues = 1 << 16;
+constexpr double kZipfExponent = 1.0;
+
+// Keys span a wide range of both signs, but stay far enough from the type limits for tasks that shift or
+// negate them.
+template <typename T>
+T RandomKey(std::mt19937_64& gen) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::uniform_real_distribution<T>(-1e9, 1e9)(gen);
+  } else {
+    constexpr T kBound = std::numeric_limits<T>::max() / 4;
+    return std::uniform_int_distribution<T>(-kBound, kBound)(gen);
+  }
+}
+
+template <typename T>
+std::vector<T> RandomKeys(std::size_t n, std::mt19937_64& gen) {
+  std::vector<T> keys(n);
+  std::ranges::generate(keys, [&gen] { return RandomKey<T>(gen); });
+  return keys;
+}
+
+// Draws every element from a small alphabet of distinct random keys with the given rank weights.
+template <typename T>
+std::vector<T> DrawFromAlphabet(std::size_t n, const std::vector<double>& weights, std::mt19937_64& gen) {
+  const std::vector<T> alphabet = RandomKeys<T>(weights.size(), gen);
+  std::discrete_distribution<std::size_t> rank(weights.begin(), weights.end());
+  std::vector<T> keys(n);
+  std::ranges::generate(keys, [&] { return alphabet[rank(gen)]; });
+  return keys;
+}
+
+}  // namespace
+
+std::string_view sort_bench::DistributionName(Distribution distribution) {
+  switch (distribution) {
+    case Distribution::kUniform:
+      return "uniform";
+    case Distribution::kSorted:
+      return "sorted";
+    case Distribution::kReverse:
+      return "reverse";
+    case Distribution::kOrganPipe:
+      return "organ_pipe";
+    case Distribution::kFewUnique:
+      return "few_unique";
+    case Distribution::kZipf:
+      return "zipf";
+    case Distribution::kAllEqual:
+      return "all_equal";
+  }
+  return "unknown";
+}
+
+std::optional<sort_bench::Distribution> sort_bench::ParseDistribution(std::string_view name) {
+  for (const Distribution distribution : kAllDistributions) {
+    if (DistributionName(distribution) == name) {
+      return distribution;
+    }
+  }
+  return std::nullopt;
+}
+
+template <typename T>
+std::vector<T> sort_bench::Generate(Distribution distribution, std::size_t n, std::uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> keys;
+  switch (distribution) {
+    case Distribution::kUniform:
+      keys = RandomKeys<T>(n, gen);
+      break;
+    case Distribution::kSorted:
+      keys = RandomKeys<T>(n, gen);
+      std::ranges::sort(keys);
+      break;
+    case Distribution::kReverse:
+      keys = RandomKeys<T>(n, gen);
+      std::ranges::sort(keys, std::greater<>());
+      break;
+    case Distribution::kOrganPipe: {
+      // Ascending first half followed by its mirror image
+      keys = RandomKeys<T>(n, gen);
+      std::ranges::sort(keys);
+      std::vector<T> pipe(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        pipe[(i % 2 == 0) ? i / 2 : n - 1 - (i / 2)] = keys[i];
+      }
+      keys.swap(pipe);
+      break;
+    }
+    case Distribution::kFewUnique:
+      keys = DrawFromAlphabet<T>(n, std::vector<double>(kFewUniqueValues, 1.0), gen);
+      break;
+    case Distribution::kZipf: {
+      std::vector<double> weights(std::min(kZipfValues, std::max<std::size_t>(n, 1)));
+      for (std::size_t k = 0; k < weights.size(); ++k) {
+        weights[k] = 1.0 / std::pow(static_cast<double>(k + 1), kZipfExponent);
+      }
+      keys = DrawFromAlphabet<T>(n, weights, gen);
+      break;
+    }
+    case Distribution::kAllEqual:
+      keys.assign(n, RandomKey<T>(gen));
+      break;
+  }
+  return keys;
+}
+
+template std::vector<std::int32_t> sort_bench::Generate<std::int32_t>(Distribution, std::size_t, std::uint64_t);
+template std::vector<std::int64_t> sort_bench::Generate<std::int64_t>(Distribution, std::size_t, std::uint64_t);
+template std::vector<double> sort_bench::Generate<double>(Distribution, std::size_t, std::uint64_t);
@@ -0,0 +1,162 @@
+#include <oneapi/tbb/global_control.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+#include "sort_bench/include/sort_bench.hpp"
+
+namespace {
+
+struct Options {
+  bool list = false;
+  std::vector<std::string> tasks;  // substrings of task names, empty for all
+  std::vector<std::string> keys;   // key names, empty for all
+  std::vector<sort_bench::Distribution> distributions{std::begin(sort_bench::kAllDistributions),
+                                                      std::end(sort_bench::kAllDistributions)};
+  std::vector<std::size_t> sizes{1 << 16, 1 << 20};
+  int repeats = 3;
+  std::uint64_t seed = 42;
+};
+
+std::vector<std::string> SplitList(std::string_view value) {
+  std::vector<std::string> items;
+  while (!value.empty()) {
+    const std::size_t comma = value.find(',');
+    if (comma != 0) {
+      items.emplace_back(value.substr(0, comma));
+    }
+    value.remove_prefix(comma == std::string_view::npos ? value.size() : comma + 1);
+  }
+  return items;
+}
+
+void PrintUsage() {
+  std::cerr << "usage: sort_bench [--list] [--task=NAME,...] [--key=int32,int64,double]\n"
+               "                  [--dist=uniform,sorted,reverse,organ_pipe,few_unique,zipf,all_equal]\n"
+               "                  [--sizes=N,...] [--repeats=R] [--seed=S]\n"
+               "Runs every registered sort task on every selected input and prints one CSV row per case.\n"
+               "The thread count is taken from OMP_NUM_THREADS, as in the tests.\n";
+}
+
+std::optional<Options> ParseOptions(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const std::size_t eq = arg.find('=');
+    const std::string_view name = arg.substr(0, eq);
+    const std::string_view value = eq == std::string_view::npos ? std::string_view() : arg.substr(eq + 1);
+    if (name == "--list") {
+      options.list = true;
+    } else if (name == "--task") {
+      options.tasks = SplitList(value);
+    } else if (name == "--key") {
+      options.keys = SplitList(value);
+    } else if (name == "--dist") {
+      options.distributions.clear();
+      for (const std::string& item : SplitList(value)) {
+        const auto distribution = sort_bench::ParseDistribution(item);
+        if (!distribution) {
+          std::cerr << "unknown distribution: " << item << '\n';
+          return std::nullopt;
+        }
+        options.distributions.push_back(*distribution);
+      }
+    } else if (name == "--sizes") {
+      options.sizes.clear();
+      for (const std::string& item : SplitList(value)) {
+        options.sizes.push_back(std::stoull(item));
+      }
+    } else if (name == "--repeats") {
+      options.repeats = std::max(1, std::stoi(std::string(value)));
+    } else if (name == "--seed") {
+      options.seed = std::stoull(std::string(value));
+    } else {
+      return std::nullopt;
+    }
+  }
+  return options;
+}
+
+bool Selected(const std::vector<std::string>& filter, std::string_view name, bool substring) {
+  return filter.empty() || std::ranges::any_of(filter, [&](const std::string& item) {
+           return substring ? name.find(item) != std::string_view::npos : name == item;
+         });
+}
+
+struct Measurement {
+  double seconds = 0.0;  // median over the repeats
+  std::string_view status;
+};
+
+// Every repeat sorts a fresh copy of the same input; the result of each one is checked against std::sort.
+template <typename T>
+Measurement Measure(sort_bench::SortRunner<T> run, sort_bench::Distribution distribution, std::size_t n,
+                    const Options& options) {
+  const std::vector<T> input = sort_bench::Generate<T>(distribution, n, options.seed);
+  std::vector<T> expected = input;
+  std::ranges::sort(expected);
+
+  std::vector<double> times;
+  for (int r = 0; r < options.repeats; ++r) {
+    std::vector<T> data = input;
+    const auto seconds = run(data);
+    if (!seconds) {
+      return {.seconds = 0.0, .status = "rejected"};
+    }
+    if (data != expected) {
+      return {.seconds = *seconds, .status = "wrong"};
+    }
+    times.push_back(*seconds);
+  }
+  std::ranges::nth_element(times, times.begin() + static_cast<std::ptrdiff_t>(times.size() / 2));
+  return {.seconds = times[times.size() / 2], .status = "ok"};
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto options = ParseOptions(argc, argv);
+  if (!options) {
+    PrintUsage();
+    return EXIT_FAILURE;
+  }
+
+  const auto& entries = sort_bench::RegisteredSorts();
+  if (options->list) {
+    for (const auto& entry : entries) {
+      std::cout << entry.name << ',' << sort_bench::KeyName(entry) << '\n';
+    }
+    return EXIT_SUCCESS;
+  }
+
+  const int threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::global_control control(oneapi::tbb::global_control::max_allowed_parallelism, threads);
+
+  std::cout << "task,key,distribution,size,threads,seconds,keys_per_sec,status\n";
+  for (const auto& entry : entries) {
+    if (!Selected(options->tasks, entry.name, true) || !Selected(options->keys, sort_bench::KeyName(entry), false)) {
+      continue;
+    }
+    for (const sort_bench::Distribution distribution : options->distributions) {
+      for (const std::size_t n : options->sizes) {
+        const Measurement m =
+            std::visit([&](auto run) { return Measure(run, distribution, n, *options); }, entry.run);
+        const double keys_per_sec = m.seconds > 0.0 ? static_cast<double>(n) / m.seconds : 0.0;
+        std::cout << entry.name << ',' << sort_bench::KeyName(entry) << ','
+                  << sort_bench::DistributionName(distribution) << ',' << n << ',' << threads << ',' << m.seconds
+                  << ',' << keys_per_sec << ',' << m.status << std::endl;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,362 @@
+#include "sort_bench/include/sort_bench.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "omp/Konstantinov_I_Sort_Batcher/include/ops_omp.hpp"
+#include "omp/belov_a_radix_sort_with_batcher_mergesort/include/ops_omp.hpp"
+#include "omp/burykin_m_radix/include/ops_omp.hpp"
+#include "omp/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_omp.hpp"
+#include "omp/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_omp.hpp"
+#include "omp/gusev_n_sorting_int_simple_merging/include/ops_omp.hpp"
+#include "omp/kalyakina_a_Shell_with_simple_merge/include/ops_omp.hpp"
+#include "omp/khovansky_d_double_radix_batcher/include/ops_omp.hpp"
+#include "omp/korovin_n_qsort_batcher/include/ops_omp.hpp"
+#include "omp/koshkin_m_radix_int_simple_merge/include/ops_omp.hpp"
+#include "omp/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "omp/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherOMP.hpp"
+#include "omp/malyshev_v_radix_sort/include/ops_omp.hpp"
+#include "omp/nesterov_a_sample_sort/include/ops_omp.hpp"
+#include "omp/nikolaev_r_hoare_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/opolin_d_radix_sort_betcher_merge/include/ops_omp.hpp"
+#include "omp/petrov_a_radix_double_batcher/include/ops_omp.hpp"
+#include "omp/smirnov_i_radix_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
+#include "omp/sorochkin_d_radix_double_sort_simple_merge/include/ops.hpp"
+#include "omp/sotskov_a_shell_sorting_with_simple_merging/include/ops_omp.hpp"
+#include "omp/tsatsyn_a_radix_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/tyshkevich_a_hoare_simple_merge/include/ops_omp.hpp"
+#include "omp/vershinina_a_hoare_sort_omp/include/ops_omp.hpp"
+#include "omp/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_omp.hpp"
+#include "seq/Konstantinov_I_Sort_Batcher/include/ops_seq.hpp"
+#include "seq/belov_a_radix_sort_with_batcher_mergesort/include/ops_seq.hpp"
+#include "seq/bessonov_e_radix_sort_simple_merging/include/ops_seq.hpp"
+#include "seq/burykin_m_radix/include/ops_seq.hpp"
+#include "seq/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_seq.hpp"
+#include "seq/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_seq.hpp"
+#include "seq/gusev_n_sorting_int_simple_merging/include/ops_seq.hpp"
+#include "seq/kalyakina_a_Shell_with_simple_merge/include/ops_seq.hpp"
+#include "seq/khovansky_d_double_radix_batcher/include/ops_seq.hpp"
+#include "seq/korovin_n_qsort_batcher/include/ops_seq.hpp"
+#include "seq/koshkin_m_radix_int_simple_merge/include/ops_seq.hpp"
+#include "seq/koshkin_n_shell_sort_batchers_even_odd_merge/include/ops_seq.hpp"
+#include "seq/kovalchuk_a_shell_sort/include/ops_seq.hpp"
+#include "seq/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "seq/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherSeq.hpp"
+#include "seq/malyshev_v_radix_sort/include/ops_seq.hpp"
+#include "seq/nesterov_a_sample_sort/include/ops_seq.hpp"
+#include "seq/nikolaev_r_hoare_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/opolin_d_radix_sort_betcher_merge/include/ops_seq.hpp"
+#include "seq/shlyakov_m_shell_sort/include/ops_seq.hpp"
+#include "seq/shuravina_o_hoare_simple_merger/include/ops_seq.hpp"
+#include "seq/smirnov_i_radix_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/solovyev_d_shell_sort_simple/include/ops_seq.hpp"
+#include "seq/sorochkin_d_radix_double_sort_simple_merge/include/ops.hpp"
+#include "seq/sotskov_a_shell_sorting_with_simple_merging/include/ops_seq.hpp"
+#include "seq/tsatsyn_a_radix_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/tyshkevich_a_hoare_simple_merge/include/ops_seq.hpp"
+#include "seq/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_seq.hpp"
+#include "stl/Konstantinov_I_Sort_Batcher/include/ops_stl.hpp"
+#include "stl/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_stl.hpp"
+#include "stl/gusev_n_sorting_int_simple_merging/include/ops_stl.hpp"
+#include "stl/kalyakina_a_Shell_with_simple_merge/include/ops_stl.hpp"
+#include "stl/korovin_n_qsort_batcher/include/ops_stl.hpp"
+#include "stl/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherSTL.hpp"
+#include "stl/nesterov_a_sample_sort/include/ops_stl.hpp"
+#include "stl/nikolaev_r_hoare_sort_simple_merge/include/ops_stl.hpp"
+#include "stl/smirnov_i_radix_sort_simple_merge/include/ops_stl.hpp"
+#include "stl/sotskov_a_shell_sorting_with_simple_merging/include/ops_stl.hpp"
+#include "stl/tsatsyn_a_radix_sort_simple_merge/include/ops_stl.hpp"
+#include "tbb/Konstantinov_I_Sort_Batcher/include/ops_tbb.hpp"
+#include "tbb/belov_a_radix_sort_with_batcher_mergesort/include/ops_tbb.hpp"
+#include "tbb/burykin_m_radix/include/ops_tbb.hpp"
+#include "tbb/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_tbb.hpp"
+#include "tbb/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_tbb.hpp"
+#include "tbb/gusev_n_sorting_int_simple_merging/include/ops_tbb.hpp"
+#include "tbb/kalyakina_a_Shell_with_simple_merge/include/ops_tbb.hpp"
+#include "tbb/khovansky_d_double_radix_batcher/include/ops_tbb.hpp"
+#include "tbb/korovin_n_qsort_batcher/include/ops_tbb.hpp"
+#include "tbb/koshkin_m_radix_int_simple_merge/include/ops_tbb.hpp"
+#include "tbb/kovalchuk_a_shell_sort_tbb/include/ops_tbb.hpp"
+#include "tbb/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "tbb/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherTBB.hpp"
+#include "tbb/mezhuev_m_bitwise_integer_sort_with_simple_merge/include/ops_tbb.hpp"
+#include "tbb/nesterov_a_sample_sort/include/ops_tbb.hpp"
+#include "tbb/nikolaev_r_hoare_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/opolin_d_radix_sort_batcher_merge/include/ops_tbb.hpp"
+#include "tbb/petrov_a_radix_double_batcher/include/ops_tbb.hpp"
+#include "tbb/shlyakov_m_shell_sort/include/ops_tbb.hpp"
+#include "tbb/smirnov_i_radix_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/solovyev_d_shell_sort_simple/include/ops_tbb.hpp"
+#include "tbb/sorochkin_d_radix_double_sort_simple_merge/include/ops.hpp"
+#include "tbb/sotskov_a_shell_sorting_with_simple_merging/include/ops_tbb.hpp"
+#include "tbb/tsatsyn_a_radix_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/tyshkevich_a_hoare_simple_merge/include/ops_tbb.hpp"
+#include "tbb/vershinina_a_hoare_sort_tbb/include/ops_tbb.hpp"
+#include "tbb/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_tbb.hpp"
+
+namespace {
+
+// Times PreProcessing + Run + PostProcessing like Perf::PipelineRun, but without the func-test time limit
+// that the task applies by default.
+std::optional<double> TimePipeline(ppc::core::Task& task) {
+  task.GetData()->state_of_testing = ppc::core::TaskData::StateOfTesting::kPerf;
+  if (!task.Validation()) {
+    return std::nullopt;
+  }
+  const auto start = std::chrono::high_resolution_clock::now();
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+// inputs[0] / outputs[0] are flat arrays of n keys: the layout of nearly every sort task.
+template <typename TaskType, typename T>
+std::optional<double> RunFlatTask(std::vector<T>& data) {
+  std::vector<T> out(data.size());
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(data.data()));
+  task_data->inputs_count.emplace_back(data.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  TaskType task(task_data);
+  const auto seconds = TimePipeline(task);
+  data.swap(out);
+  return seconds;
+}
+
+// Same as RunFlatTask for the tasks that read inputs_count[1] as a second copy of the size.
+template <typename TaskType, typename T>
+std::optional<double> RunSizeTwiceTask(std::vector<T>& data) {
+  std::vector<T> out(data.size());
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(data.data()));
+  task_data->inputs_count.emplace_back(data.size());
+  task_data->inputs_count.emplace_back(data.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  TaskType task(task_data);
+  const auto seconds = TimePipeline(task);
+  data.swap(out);
+  return seconds;
+}
+
+// inputs[1] holds a bool: true for ascending order.
+template <typename TaskType>
+std::optional<double> RunOrderedTask(std::vector<std::int32_t>& data) {
+  std::vector<std::int32_t> out(data.size());
+  bool ascending = true;
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(data.data()));
+  task_data->inputs_count.emplace_back(data.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(&ascending));
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  TaskType task(task_data);
+  const auto seconds = TimePipeline(task);
+  data.swap(out);
+  return seconds;
+}
+
+// The tyshkevich tasks take the order as a comparator; the bench sorts ascending.
+template <template <typename, typename> class TaskType, typename T>
+class AscendingTask : public TaskType<T, std::less<>> {
+ public:
+  explicit AscendingTask(ppc::core::TaskDataPtr task_data)
+      : TaskType<T, std::less<>>(std::move(task_data), std::less<>()) {}
+};
+
+template <typename T>
+using TyshkevichSeq = AscendingTask<tyshkevich_a_hoare_simple_merge_seq::HoareSortTask, T>;
+template <typename T>
+using TyshkevichOmp = AscendingTask<tyshkevich_a_hoare_simple_merge_omp::HoareSortTask, T>;
+template <typename T>
+using TyshkevichTbb = AscendingTask<tyshkevich_a_hoare_simple_merge_tbb::HoareSortTask, T>;
+
+// Tasks templated on the key type run with every key type of the bench.
+template <template <typename> class TaskType>
+void AddTypedSort(std::vector<sort_bench::SortEntry>& entries, const char* name) {
+  entries.push_back({name, &RunFlatTask<TaskType<std::int32_t>, std::int32_t>});
+  entries.push_back({name, &RunFlatTask<TaskType<std::int64_t>, std::int64_t>});
+  entries.push_back({name, &RunFlatTask<TaskType<double>, double>});
+}
+
+// The deryabin_m_hoare_sort_simple_merge tasks are not registered: their ValidationImpl truncates the size to
+// unsigned short, the OpenMP one computes chunk offsets in short, and their HoaraSort does not terminate on repeated
+// keys, so none of the bench sizes and only some of its distributions could be measured.
+std::vector<sort_bench::SortEntry> MakeRegistry() {
+  using Int = std::int32_t;
+  using Long = std::int64_t;
+  std::vector<sort_bench::SortEntry> entries = {
+      {"seq/Konstantinov_I_Sort_Batcher", &RunFlatTask<konstantinov_i_sort_batcher_seq::RadixSortBatcherSeq, double>},
+      {"seq/belov_a_radix_sort_with_batcher_mergesort",
+       &RunSizeTwiceTask<belov_a_radix_batcher_mergesort_seq::RadixBatcherMergesortSequential, Long>},
+      {"seq/bessonov_e_radix_sort_simple_merging",
+       &RunFlatTask<bessonov_e_radix_sort_simple_merging_seq::TestTaskSequential, double>},
+      {"seq/burykin_m_radix", &RunFlatTask<burykin_m_radix_seq::RadixSequential, Int>},
+      {"seq/ermilova_d_shell_sort_batcher_even_odd_merger",
+       &RunFlatTask<ermilova_d_shell_sort_batcher_even_odd_merger_seq::SequentialTask, Int>},
+      {"seq/fyodorov_m_shell_sort_with_even_odd_batcher_merge",
+       &RunFlatTask<fyodorov_m_shell_sort_with_even_odd_batcher_merge_seq::TestTaskSequential, Int>},
+      {"seq/gusev_n_sorting_int_simple_merging",
+       &RunFlatTask<gusev_n_sorting_int_simple_merging_seq::TestTaskSequential, Int>},
+      {"seq/kalyakina_a_Shell_with_simple_merge",
+       &RunFlatTask<kalyakina_a_shell_with_simple_merge_seq::ShellSortSequential, Int>},
+      {"seq/khovansky_d_double_radix_batcher", &RunFlatTask<khovansky_d_double_radix_batcher_seq::RadixSeq, double>},
+      {"seq/korovin_n_qsort_batcher", &RunFlatTask<korovin_n_qsort_batcher_seq::TestTaskSequential, Int>},
+      {"seq/koshkin_m_radix_int_simple_merge", &RunFlatTask<koshkin_m_radix_int_simple_merge::SeqT, Int>},
+      {"seq/koshkin_n_shell_sort_batchers_even_odd_merge",
+       &RunOrderedTask<koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential>},
+      {"seq/kovalchuk_a_shell_sort", &RunFlatTask<kovalchuk_a_shell_sort::ShellSortSequential, Int>},
+      {"seq/kovalev_k_radix_sort_batcher_merge",
+       &RunFlatTask<kovalev_k_radix_sort_batcher_merge_seq::RadixSortBatcherMerge, Long>},
+      {"seq/kudryashova_i_radix_batcher", &RunFlatTask<kudryashova_i_radix_batcher_seq::TestTaskSequential, double>},
+      {"seq/malyshev_v_radix_sort", &RunFlatTask<malyshev_v_radix_sort_seq::RadixSortSequential, double>},
+      {"seq/nikolaev_r_hoare_sort_simple_merge",
+       &RunFlatTask<nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential, double>},
+      {"seq/opolin_d_radix_sort_betcher_merge",
+       &RunFlatTask<opolin_d_radix_betcher_sort_seq::RadixBetcherSortTaskSequential, Int>},
+      {"seq/shlyakov_m_shell_sort", &RunFlatTask<shlyakov_m_shell_sort_seq::TestTaskSequential, Int>},
+      {"seq/shuravina_o_hoare_simple_merger", &RunFlatTask<shuravina_o_hoare_simple_merger::TestTaskSequential, Int>},
+      {"seq/smirnov_i_radix_sort_simple_merge",
+       &RunFlatTask<smirnov_i_radix_sort_simple_merge_seq::TestTaskSequential, Int>},
+      {"seq/solovyev_d_shell_sort_simple", &RunFlatTask<solovyev_d_shell_sort_simple_seq::TaskSequential, Int>},
+      {"seq/sorochkin_d_radix_double_sort_simple_merge",
+       &RunFlatTask<sorochkin_d_radix_double_sort_simple_merge_seq::SortTask, double>},
+      {"seq/sotskov_a_shell_sorting_with_simple_merging",
+       &RunFlatTask<sotskov_a_shell_sorting_with_simple_merging_seq::TestTaskSequential, Int>},
+      {"seq/tsatsyn_a_radix_sort_simple_merge",
+       &RunFlatTask<tsatsyn_a_radix_sort_simple_merge_seq::TestTaskSequential, double>},
+      {"seq/volochaev_s_Shell_sort_with_Batchers_even-odd_merge",
+       &RunFlatTask<volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential, Int>},
+
+      {"omp/Konstantinov_I_Sort_Batcher", &RunFlatTask<konstantinov_i_sort_batcher_omp::RadixSortBatcherOmp, double>},
+      {"omp/belov_a_radix_sort_with_batcher_mergesort",
+       &RunSizeTwiceTask<belov_a_radix_batcher_mergesort_omp::RadixBatcherMergesortParallel, Long>},
+      {"omp/burykin_m_radix", &RunFlatTask<burykin_m_radix_omp::RadixOMP, Int>},
+      {"omp/ermilova_d_shell_sort_batcher_even_odd_merger",
+       &RunFlatTask<ermilova_d_shell_sort_batcher_even_odd_merger_omp::OmpTask, Int>},
+      {"omp/fyodorov_m_shell_sort_with_even_odd_batcher_merge",
+       &RunFlatTask<fyodorov_m_shell_sort_with_even_odd_batcher_merge_omp::TestTaskOpenmp, Int>},
+      {"omp/gusev_n_sorting_int_simple_merging",
+       &RunFlatTask<gusev_n_sorting_int_simple_merging_omp::TestTaskOpenMP, Int>},
+      {"omp/kalyakina_a_Shell_with_simple_merge",
+       &RunFlatTask<kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP, Int>},
+      {"omp/khovansky_d_double_radix_batcher", &RunFlatTask<khovansky_d_double_radix_batcher_omp::RadixOMP, double>},
+      {"omp/korovin_n_qsort_batcher", &RunFlatTask<korovin_n_qsort_batcher_omp::TestTaskOpenMP, Int>},
+      {"omp/koshkin_m_radix_int_simple_merge", &RunFlatTask<koshkin_m_radix_int_simple_merge::OmpT, Int>},
+      {"omp/kovalev_k_radix_sort_batcher_merge",
+       &RunFlatTask<kovalev_k_radix_sort_batcher_merge_omp::TestTaskOpenMP, Long>},
+      {"omp/kudryashova_i_radix_batcher", &RunFlatTask<kudryashova_i_radix_batcher_omp::TestTaskOpenMP, double>},
+      {"omp/malyshev_v_radix_sort", &RunFlatTask<malyshev_v_radix_sort_omp::RadixSortDoubleOMP, double>},
+      {"omp/nikolaev_r_hoare_sort_simple_merge",
+       &RunFlatTask<nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP, double>},
+      {"omp/opolin_d_radix_sort_betcher_merge",
+       &RunFlatTask<opolin_d_radix_batcher_sort_omp::RadixBatcherSortTaskOpenMP, Int>},
+      {"omp/petrov_a_radix_double_batcher",
+       &RunFlatTask<petrov_a_radix_double_batcher_omp::TestTaskParallelOmp, double>},
+      {"omp/smirnov_i_radix_sort_simple_merge",
+       &RunFlatTask<smirnov_i_radix_sort_simple_merge_omp::TestTaskOpenMP, Int>},
+      {"omp/solovyev_d_shell_sort_simple", &RunFlatTask<solovyev_d_shell_sort_simple_omp::TaskOMP, Int>},
+      {"omp/sorochkin_d_radix_double_sort_simple_merge",
+       &RunFlatTask<sorochkin_d_radix_double_sort_simple_merge_omp::SortTask, double>},
+      {"omp/sotskov_a_shell_sorting_with_simple_merging",
+       &RunFlatTask<sotskov_a_shell_sorting_with_simple_merging_omp::TestTaskOpenMP, Int>},
+      {"omp/tsatsyn_a_radix_sort_simple_merge",
+       &RunFlatTask<tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP, double>},
+      {"omp/vershinina_a_hoare_sort_omp", &RunFlatTask<vershinina_a_hoare_sort_omp::TestTaskOpenMP, double>},
+      {"omp/volochaev_s_Shell_sort_with_Batchers_even-odd_merge",
+       &RunFlatTask<volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP, Int>},
+
+      {"tbb/Konstantinov_I_Sort_Batcher", &RunFlatTask<konstantinov_i_sort_batcher_tbb::RadixSortBatcherTBB, double>},
+      {"tbb/belov_a_radix_sort_with_batcher_mergesort",
+       &RunSizeTwiceTask<belov_a_radix_batcher_mergesort_tbb::RadixBatcherMergesortParallel, Long>},
+      {"tbb/burykin_m_radix", &RunFlatTask<burykin_m_radix_tbb::RadixTBB, Int>},
+      {"tbb/ermilova_d_shell_sort_batcher_even_odd_merger",
+       &RunFlatTask<ermilova_d_shell_sort_batcher_even_odd_merger_tbb::TbbTask, Int>},
+      {"tbb/fyodorov_m_shell_sort_with_even_odd_batcher_merge",
+       &RunFlatTask<fyodorov_m_shell_sort_with_even_odd_batcher_merge_tbb::TestTaskTBB, Int>},
+      {"tbb/gusev_n_sorting_int_simple_merging",
+       &RunFlatTask<gusev_n_sorting_int_simple_merging_tbb::SortingIntSimpleMergingTBB, Int>},
+      {"tbb/kalyakina_a_Shell_with_simple_merge",
+       &RunFlatTask<kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB, Int>},
+      {"tbb/khovansky_d_double_radix_batcher", &RunFlatTask<khovansky_d_double_radix_batcher_tbb::RadixTBB, double>},
+      {"tbb/korovin_n_qsort_batcher", &RunFlatTask<korovin_n_qsort_batcher_tbb::TestTaskTBB, Int>},
+      {"tbb/koshkin_m_radix_int_simple_merge", &RunFlatTask<koshkin_m_radix_int_simple_merge::TbbT, Int>},
+      {"tbb/kovalchuk_a_shell_sort_tbb", &RunFlatTask<kovalchuk_a_shell_sort_tbb::ShellSortTBB, Int>},
+      {"tbb/kovalev_k_radix_sort_batcher_merge",
+       &RunFlatTask<kovalev_k_radix_sort_batcher_merge_tbb::TestTaskTBB, Long>},
+      {"tbb/kudryashova_i_radix_batcher", &RunFlatTask<kudryashova_i_radix_batcher_tbb::TestTaskTBB, double>},
+      {"tbb/mezhuev_m_bitwise_integer_sort_with_simple_merge",
+       &RunFlatTask<mezhuev_m_bitwise_integer_sort_tbb::SortTBB, Int>},
+      {"tbb/nikolaev_r_hoare_sort_simple_merge",
+       &RunFlatTask<nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB, double>},
+      {"tbb/opolin_d_radix_sort_batcher_merge",
+       &RunFlatTask<opolin_d_radix_batcher_sort_tbb::RadixBatcherSortTaskTbb, Int>},
+      {"tbb/petrov_a_radix_double_batcher",
+       &RunFlatTask<petrov_a_radix_double_batcher_tbb::TestTaskParallelTbb, double>},
+      {"tbb/shlyakov_m_shell_sort", &RunFlatTask<shlyakov_m_shell_sort_tbb::TestTaskTBB, Int>},
+      {"tbb/smirnov_i_radix_sort_simple_merge", &RunFlatTask<smirnov_i_radix_sort_simple_merge_tbb::TestTaskTBB, Int>},
+      {"tbb/solovyev_d_shell_sort_simple", &RunFlatTask<solovyev_d_shell_sort_simple_tbb::TaskTBB, Int>},
+      {"tbb/sorochkin_d_radix_double_sort_simple_merge",
+       &RunFlatTask<sorochkin_d_radix_double_sort_simple_merge_tbb::SortTask, double>},
+      {"tbb/sotskov_a_shell_sorting_with_simple_merging",
+       &RunFlatTask<sotskov_a_shell_sorting_with_simple_merging_tbb::TestTaskTBB, Int>},
+      {"tbb/tsatsyn_a_radix_sort_simple_merge",
+       &RunFlatTask<tsatsyn_a_radix_sort_simple_merge_tbb::TestTaskTBB, double>},
+      {"tbb/vershinina_a_hoare_sort_tbb", &RunFlatTask<vershinina_a_hoare_sort_tbb::TestTaskTBB, double>},
+      {"tbb/volochaev_s_Shell_sort_with_Batchers_even-odd_merge",
+       &RunFlatTask<volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB, Int>},
+
+      {"stl/Konstantinov_I_Sort_Batcher", &RunFlatTask<konstantinov_i_sort_batcher_stl::RadixSortBatcherSTL, double>},
+      {"stl/ermilova_d_shell_sort_batcher_even_odd_merger",
+       &RunFlatTask<ermilova_d_shell_sort_batcher_even_odd_merger_stl::StlTask, Int>},
+      {"stl/gusev_n_sorting_int_simple_merging",
+       &RunFlatTask<gusev_n_sorting_int_simple_merging_stl::TestTaskSTL, Int>},
+      {"stl/kalyakina_a_Shell_with_simple_merge",
+       &RunFlatTask<kalyakina_a_shell_with_simple_merge_stl::ShellSortSTL, Int>},
+      {"stl/korovin_n_qsort_batcher", &RunFlatTask<korovin_n_qsort_batcher_stl::TestTaskSTL, Int>},
+      {"stl/kudryashova_i_radix_batcher", &RunFlatTask<kudryashova_i_radix_batcher_stl::TestTaskSTL, double>},
+      {"stl/nikolaev_r_hoare_sort_simple_merge",
+       &RunFlatTask<nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL, double>},
+      {"stl/smirnov_i_radix_sort_simple_merge", &RunFlatTask<smirnov_i_radix_sort_simple_merge_stl::TestTaskSTL, Int>},
+      {"stl/sotskov_a_shell_sorting_with_simple_merging",
+       &RunFlatTask<sotskov_a_shell_sorting_with_simple_merging_stl::TestTaskSTL, Int>},
+      {"stl/tsatsyn_a_radix_sort_simple_merge",
+       &RunFlatTask<tsatsyn_a_radix_sort_simple_merge_stl::TestTaskSTL, double>},
+  };
+  AddTypedSort<nesterov_a_sample_sort_seq::SampleSortSequential>(entries, "seq/nesterov_a_sample_sort");
+  AddTypedSort<nesterov_a_sample_sort_omp::SampleSortOpenMP>(entries, "omp/nesterov_a_sample_sort");
+  AddTypedSort<nesterov_a_sample_sort_tbb::SampleSortTBB>(entries, "tbb/nesterov_a_sample_sort");
+  AddTypedSort<nesterov_a_sample_sort_stl::SampleSortSTL>(entries, "stl/nesterov_a_sample_sort");
+  AddTypedSort<TyshkevichSeq>(entries, "seq/tyshkevich_a_hoare_simple_merge");
+  AddTypedSort<TyshkevichOmp>(entries, "omp/tyshkevich_a_hoare_simple_merge");
+  AddTypedSort<TyshkevichTbb>(entries, "tbb/tyshkevich_a_hoare_simple_merge");
+  return entries;
+}
+
+}  // namespace
+
+std::string_view sort_bench::KeyName(const SortEntry& entry) {
+  constexpr std::string_view kNames[] = {"int32", "int64", "double"};
+  return kNames[entry.run.index()];
+}
+
+const std::vector<sort_bench::SortEntry>& sort_bench::RegisteredSorts() {
+  static const std::vector<SortEntry> kEntries = MakeRegistry();
+  return kEntries;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+
+namespace spmv_bench {
+
+// Shapes of generated matrices, all square:
+//   uniform         every row has about the same number of entries at random columns;
+//   banded          entries on the diagonals closest to the main one, as from a 1-D stencil;
+//   power_law       row lengths follow a Zipf law, so a few rows hold a large share of the entries;
+//   block_diagonal  dense-ish diagonal blocks of 64 rows with a few random entries outside them.
+enum class Pattern : uint8_t { kUniform, kBanded, kPowerLaw, kBlockDiagonal };
+
+inline constexpr Pattern kAllPatterns[] = {Pattern::kUniform, Pattern::kBanded, Pattern::kPowerLaw,
+                                           Pattern::kBlockDiagonal};
+
+std::string_view PatternName(Pattern pattern);
+std::optional<Pattern> ParsePattern(std::string_view name);
+
+// A rows x rows matrix of the given shape with about entries_per_row entries per row on average; the same seed
+// always gives the same matrix.
+ppc::core::CsrMatrix<double> Generate(Pattern pattern, int rows, int entries_per_row, std::uint64_t seed);
+
+using SpmvFactory = std::unique_ptr<ppc::core::Task> (*)(ppc::core::TaskDataPtr task_data,
+                                                         ppc::core::SpmvFormat format);
+
+struct SpmvEntry {
+  std::string name;  // "<backend>/<task directory>"
+  SpmvFactory make;
+};
+
+// Every SpMV task of the seq/omp/tbb/stl backends taking the matrix in the core/sparse_io format.
+const std::vector<SpmvEntry>& RegisteredSpmvs();
+
+}  // namespace spmv_bench
@@ -0,0 +1,107 @@
+#include "spmv_bench/include/spmv_bench.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+
+namespace {
+
+constexpr int kBlockRows = 64;
+// Share of the entries of a block-diagonal row that lie inside its block.
+constexpr double kInBlockShare = 0.75;
+constexpr double kZipfExponent = 1.0;
+
+constexpr std::string_view kNames[] = {"uniform", "banded", "power_law", "block_diagonal"};
+
+// Appends a row with the given columns, sorted and without repeats, and random values.
+void AppendRow(ppc::core::CsrMatrix<double>& matrix, std::vector<int>& cols, std::mt19937_64& gen) {
+  std::ranges::sort(cols);
+  cols.erase(std::ranges::unique(cols).begin(), cols.end());
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  for (const int col : cols) {
+    matrix.col_idx.push_back(col);
+    matrix.values.push_back(value(gen));
+  }
+  matrix.row_ptr.push_back(static_cast<int>(matrix.col_idx.size()));
+}
+
+// Lengths of the rows of a power_law matrix: the row of rank r gets c / (r + 1)^kZipfExponent entries, with c such
+// that they add up to about rows * entries_per_row, and the ranks are shuffled over the rows.
+std::vector<int> ZipfLengths(int rows, int entries_per_row, std::mt19937_64& gen) {
+  double harmonic = 0.0;
+  for (int r = 0; r < rows; ++r) {
+    harmonic += 1.0 / std::pow(r + 1.0, kZipfExponent);
+  }
+  const double scale = static_cast<double>(rows) * entries_per_row / harmonic;
+  std::vector<int> lengths(rows);
+  for (int r = 0; r < rows; ++r) {
+    const double length = scale / std::pow(r + 1.0, kZipfExponent);
+    lengths[r] = static_cast<int>(std::clamp(std::round(length), 1.0, static_cast<double>(rows)));
+  }
+  std::ranges::shuffle(lengths, gen);
+  return lengths;
+}
+
+}  // namespace
+
+std::string_view spmv_bench::PatternName(Pattern pattern) { return kNames[static_cast<std::size_t>(pattern)]; }
+
+std::optional<spmv_bench::Pattern> spmv_bench::ParsePattern(std::string_view name) {
+  for (const Pattern pattern : kAllPatterns) {
+    if (PatternName(pattern) == name) {
+      return pattern;
+    }
+  }
+  return std::nullopt;
+}
+
+ppc::core::CsrMatrix<double> spmv_bench::Generate(Pattern pattern, int rows, int entries_per_row,
+                                                  std::uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::uniform_int_distribution<int> any_col(0, std::max(0, rows - 1));
+  ppc::core::CsrMatrix<double> matrix;
+  matrix.rows = rows;
+  matrix.cols = rows;
+  matrix.row_ptr.reserve(static_cast<std::size_t>(rows) + 1);
+  matrix.col_idx.reserve(static_cast<std::size_t>(rows) * entries_per_row);
+  matrix.values.reserve(static_cast<std::size_t>(rows) * entries_per_row);
+
+  const std::vector<int> lengths = pattern == Pattern::kPowerLaw ? ZipfLengths(rows, entries_per_row, gen)
+                                                                 : std::vector<int>(rows, entries_per_row);
+  std::vector<int> cols;
+  for (int i = 0; i < rows; ++i) {
+    cols.clear();
+    switch (pattern) {
+      case Pattern::kUniform:
+      case Pattern::kPowerLaw:
+        for (int k = 0; k < lengths[i]; ++k) {
+          cols.push_back(any_col(gen));
+        }
+        break;
+      case Pattern::kBanded:
+        for (int j = std::max(0, i - (entries_per_row / 2)); j <= std::min(rows - 1, i + (entries_per_row / 2));
+             ++j) {
+          cols.push_back(j);
+        }
+        break;
+      case Pattern::kBlockDiagonal: {
+        const int first = (i / kBlockRows) * kBlockRows;
+        std::uniform_int_distribution<int> block_col(first, std::min(rows, first + kBlockRows) - 1);
+        const auto in_block = static_cast<int>(std::lround(kInBlockShare * entries_per_row));
+        for (int k = 0; k < entries_per_row; ++k) {
+          cols.push_back(k < in_block ? block_col(gen) : any_col(gen));
+        }
+        break;
+      }
+    }
+    AppendRow(matrix, cols, gen);
+  }
+  return matrix;
+}
@@ -0,0 +1,262 @@
+#include <oneapi/tbb/global_control.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+#include "spmv_bench/include/spmv_bench.hpp"
+
+namespace {
+
+struct Options {
+  bool list = false;
+  std::vector<std::string> tasks;  // substrings of task names, empty for all
+  std::vector<ppc::core::SpmvFormat> formats{ppc::core::SpmvFormat::kCsr, ppc::core::SpmvFormat::kSell};
+  std::vector<spmv_bench::Pattern> patterns{std::begin(spmv_bench::kAllPatterns), std::end(spmv_bench::kAllPatterns)};
+  std::vector<int> sizes{1 << 17, 1 << 20};
+  int entries_per_row = 16;
+  std::vector<std::string> mtx_files;
+  int repeats = 10;
+  std::uint64_t seed = 42;
+};
+
+constexpr std::string_view kFormatNames[] = {"csr", "sell"};
+
+std::vector<std::string> SplitList(std::string_view value) {
+  std::vector<std::string> items;
+  while (!value.empty()) {
+    const std::size_t comma = value.find(',');
+    if (comma != 0) {
+      items.emplace_back(value.substr(0, comma));
+    }
+    value.remove_prefix(comma == std::string_view::npos ? value.size() : comma + 1);
+  }
+  return items;
+}
+
+void PrintUsage() {
+  std::cerr << "usage: spmv_bench [--list] [--task=NAME,...] [--format=csr,sell]\n"
+               "                  [--pattern=uniform,banded,power_law,block_diagonal] [--sizes=ROWS,...]\n"
+               "                  [--nnz_per_row=K] [--mtx=FILE,...] [--repeats=R] [--seed=S]\n"
+               "Multiplies every selected matrix by a vector with every registered SpMV task in every storage format\n"
+               "and prints one CSV row per case. Matrix Market files given with --mtx are run after the generated\n"
+               "matrices; pass --pattern= to run them alone. The thread count is taken from OMP_NUM_THREADS.\n";
+}
+
+std::optional<Options> ParseOptions(int argc, char** argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    const std::size_t eq = arg.find('=');
+    const std::string_view name = arg.substr(0, eq);
+    const std::string_view value = eq == std::string_view::npos ? std::string_view() : arg.substr(eq + 1);
+    if (name == "--list") {
+      options.list = true;
+    } else if (name == "--task") {
+      options.tasks = SplitList(value);
+    } else if (name == "--format") {
+      options.formats.clear();
+      for (const std::string& item : SplitList(value)) {
+        const auto* it = std::ranges::find(kFormatNames, item);
+        if (it == std::end(kFormatNames)) {
+          std::cerr << "unknown format: " << item << '\n';
+          return std::nullopt;
+        }
+        options.formats.push_back(static_cast<ppc::core::SpmvFormat>(it - std::begin(kFormatNames)));
+      }
+    } else if (name == "--pattern") {
+      options.patterns.clear();
+      for (const std::string& item : SplitList(value)) {
+        const auto pattern = spmv_bench::ParsePattern(item);
+        if (!pattern) {
+          std::cerr << "unknown pattern: " << item << '\n';
+          return std::nullopt;
+        }
+        options.patterns.push_back(*pattern);
+      }
+    } else if (name == "--sizes") {
+      options.sizes.clear();
+      for (const std::string& item : SplitList(value)) {
+        options.sizes.push_back(std::stoi(item));
+      }
+    } else if (name == "--nnz_per_row") {
+      options.entries_per_row = std::max(1, std::stoi(std::string(value)));
+    } else if (name == "--mtx") {
+      options.mtx_files = SplitList(value);
+    } else if (name == "--repeats") {
+      options.repeats = std::max(1, std::stoi(std::string(value)));
+    } else if (name == "--seed") {
+      options.seed = std::stoull(std::string(value));
+    } else {
+      return std::nullopt;
+    }
+  }
+  return options;
+}
+
+bool Selected(const std::vector<std::string>& filter, std::string_view name) {
+  return filter.empty() || std::ranges::any_of(filter, [&](const std::string& item) {
+           return name.find(item) != std::string_view::npos;
+         });
+}
+
+// A matrix with everything the runs on it compare against.
+struct Case {
+  std::string name;
+  ppc::core::CsrMatrix<double> matrix;
+  std::vector<std::byte> encoded;
+  std::vector<double> x;
+  std::vector<double> expected;
+  // Bound on the rounding error of every entry of y: the sum of |a_ij * x_j| over its row times a few ulps.
+  std::vector<double> tolerance;
+  // Entries a SELL copy stores per nonzero, with the chunk and sigma the tasks use.
+  double sell_fill = 1.0;
+};
+
+Case MakeCase(std::string name, ppc::core::CsrMatrix<double> matrix, std::uint64_t seed) {
+  Case c;
+  c.name = std::move(name);
+  c.matrix = std::move(matrix);
+  c.encoded = ppc::core::EncodeSparse(c.matrix);
+  std::mt19937_64 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  c.x.resize(c.matrix.cols);
+  std::ranges::generate(c.x, [&] { return dist(gen); });
+  c.expected.resize(c.matrix.rows);
+  c.matrix.MultiplyVector(c.x.data(), c.expected.data());
+  c.tolerance.assign(c.matrix.rows, 0.0);
+  for (int i = 0; i < c.matrix.rows; ++i) {
+    for (int e = c.matrix.row_ptr[i]; e < c.matrix.row_ptr[i + 1]; ++e) {
+      c.tolerance[i] += std::abs(c.matrix.values[e] * c.x[c.matrix.col_idx[e]]);
+    }
+    c.tolerance[i] *= 1e-12;
+  }
+  if (c.matrix.NonZeros() != 0) {
+    const auto sell = ppc::core::SellMatrix<double>::FromCsr(c.matrix);
+    c.sell_fill = static_cast<double>(sell.StoredEntries()) / static_cast<double>(sell.NonZeros());
+  }
+  return c;
+}
+
+struct Measurement {
+  double prep_seconds = 0.0;  // PreProcessing, which builds the storage
+  double run_seconds = 0.0;   // median of the repeated Run calls
+  std::string_view status;
+};
+
+// PreProcessing runs once and Run `repeats` times on the same task, so the median is the cost of one product.
+Measurement Measure(const spmv_bench::SpmvEntry& entry, ppc::core::SpmvFormat format, Case& c, int repeats) {
+  std::vector<double> y(c.matrix.rows, 0.0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(c.encoded.data()));
+  task_data->inputs_count.emplace_back(c.encoded.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(c.x.data()));
+  task_data->inputs_count.emplace_back(c.x.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(y.data()));
+  task_data->outputs_count.emplace_back(y.size());
+
+  const auto task = entry.make(task_data, format);
+  // Without the func-test time limit the task applies by default
+  task_data->state_of_testing = ppc::core::TaskData::StateOfTesting::kPerf;
+  Measurement m;
+  if (!task->Validation()) {
+    m.status = "rejected";
+    return m;
+  }
+  const auto start = std::chrono::high_resolution_clock::now();
+  task->PreProcessing();
+  m.prep_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+  std::vector<double> times;
+  for (int r = 0; r < repeats; ++r) {
+    const auto run_start = std::chrono::high_resolution_clock::now();
+    task->Run();
+    times.push_back(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - run_start).count());
+  }
+  task->PostProcessing();
+  std::ranges::nth_element(times, times.begin() + static_cast<std::ptrdiff_t>(times.size() / 2));
+  m.run_seconds = times[times.size() / 2];
+
+  m.status = "ok";
+  for (std::size_t i = 0; i < y.size(); ++i) {
+    if (!(std::abs(y[i] - c.expected[i]) <= c.tolerance[i])) {
+      m.status = "wrong";
+      break;
+    }
+  }
+  return m;
+}
+
+void RunCase(Case& c, const Options& options, int threads) {
+  for (const auto& entry : spmv_bench::RegisteredSpmvs()) {
+    if (!Selected(options.tasks, entry.name)) {
+      continue;
+    }
+    for (const ppc::core::SpmvFormat format : options.formats) {
+      const Measurement m = Measure(entry, format, c, options.repeats);
+      const double flops = 2.0 * static_cast<double>(c.matrix.NonZeros());
+      const double gflops = m.run_seconds > 0.0 ? flops / m.run_seconds * 1e-9 : 0.0;
+      const double fill = format == ppc::core::SpmvFormat::kSell ? c.sell_fill : 1.0;
+      std::cout << c.name << ',' << c.matrix.rows << ',' << c.matrix.NonZeros() << ',' << entry.name << ','
+                << kFormatNames[static_cast<std::size_t>(format)] << ',' << threads << ',' << m.prep_seconds << ','
+                << m.run_seconds << ',' << gflops << ',' << fill << ',' << m.status << std::endl;
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto options = ParseOptions(argc, argv);
+  if (!options) {
+    PrintUsage();
+    return EXIT_FAILURE;
+  }
+
+  if (options->list) {
+    for (const auto& entry : spmv_bench::RegisteredSpmvs()) {
+      std::cout << entry.name << '\n';
+    }
+    return EXIT_SUCCESS;
+  }
+
+  const int threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::global_control control(oneapi::tbb::global_control::max_allowed_parallelism, threads);
+
+  std::cout << "matrix,rows,nnz,task,format,threads,prep_seconds,run_seconds,gflops,stored_per_nnz,status\n";
+  for (const spmv_bench::Pattern pattern : options->patterns) {
+    for (const int rows : options->sizes) {
+      Case c = MakeCase(std::string(spmv_bench::PatternName(pattern)),
+                        spmv_bench::Generate(pattern, rows, options->entries_per_row, options->seed), options->seed);
+      RunCase(c, *options, threads);
+    }
+  }
+  for (const std::string& path : options->mtx_files) {
+    try {
+      Case c = MakeCase(std::filesystem::path(path).stem().string(),
+                        ppc::core::ReadMatrixMarket<double>(path).ToCsr(), options->seed);
+      RunCase(c, *options, threads);
+    } catch (const std::exception& e) {
+      std::cerr << path << ": " << e.what() << '\n';
+    }
+  }
+  return EXIT_SUCCESS;
+}
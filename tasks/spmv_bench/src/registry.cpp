@@ -0,0 +1,31 @@
+#include "spmv_bench/include/spmv_bench.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/nesterov_a_spmv/include/ops_omp.hpp"
+#include "seq/nesterov_a_spmv/include/ops_seq.hpp"
+#include "stl/nesterov_a_spmv/include/ops_stl.hpp"
+#include "tbb/nesterov_a_spmv/include/ops_tbb.hpp"
+
+namespace {
+
+template <typename TaskType>
+std::unique_ptr<ppc::core::Task> Make(ppc::core::TaskDataPtr task_data, ppc::core::SpmvFormat format) {
+  return std::make_unique<TaskType>(std::move(task_data), format);
+}
+
+}  // namespace
+
+const std::vector<spmv_bench::SpmvEntry>& spmv_bench::RegisteredSpmvs() {
+  static const std::vector<SpmvEntry> kEntries = {
+      {"seq/nesterov_a_spmv", &Make<nesterov_a_spmv_seq::SpmvSequential>},
+      {"omp/nesterov_a_spmv", &Make<nesterov_a_spmv_omp::SpmvOpenMP>},
+      {"tbb/nesterov_a_spmv", &Make<nesterov_a_spmv_tbb::SpmvTBB>},
+      {"stl/nesterov_a_spmv", &Make<nesterov_a_spmv_stl::SpmvSTL>},
+  };
+  return kEntries;
+}
@@ -6,6 +6,7 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/util/include/util.hpp"
 
 bool moiseev_a_mult_mat_stl::MultMatSTL::PreProcessingImpl() {
@@ -49,17 +50,9 @@ void moiseev_a_mult_mat_stl::MultMatSTL::MultiplyBlock(const BlockDesc &desc) {
   int a_col_base = a_block_col * block_size_;
   int b_row_base = b_block_row * block_size_;
 
-  for (int i = 0; i < block_size_; ++i) {
-    for (int j = 0; j < block_size_; ++j) {
-      double sum = 0.0;
-      for (int k = 0; k < block_size_; ++k) {
-        double a = matrix_a_[((row_base + i) * matrix_size_) + (a_col_base + k)];
-        double b = matrix_b_[((b_row_base + k) * matrix_size_) + (col_base + j)];
-        sum += a * b;
-      }
-      matrix_c_[((row_base + i) * matrix_size_) + (col_base + j)] += sum;
-    }
-  }
+  ppc::core::Gemm(block_size_, block_size_, block_size_, &matrix_a_[(row_base * matrix_size_) + a_col_base],
+                  matrix_size_, &matrix_b_[(b_row_base * matrix_size_) + col_base], matrix_size_,
+                  &matrix_c_[(row_base * matrix_size_) + col_base], matrix_size_);
 }
 
 bool moiseev_a_mult_mat_stl::MultMatSTL::RunImpl() {
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace nesterov_a_sample_sort_stl {
+
+// Sample sort: splitters are taken from an oversampled random sample, every element is classified
+// into its bucket in parallel and the buckets are sorted independently, so there is no merge phase.
+template <typename T>
+class SampleSortSTL : public ppc::core::Task {
+ public:
+  explicit SampleSortSTL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  static void Sort(std::vector<T>& data, int num_threads);
+
+ private:
+  std::vector<T> data_;
+};
+
+}  // namespace nesterov_a_sample_sort_stl
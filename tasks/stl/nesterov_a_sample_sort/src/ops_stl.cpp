@@ -0,0 +1,150 @@
+#include "stl/nesterov_a_sample_sort/include/ops_stl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr std::size_t kSequentialThreshold = 1 << 12;
+constexpr std::size_t kBucketsPerThread = 4;
+constexpr std::size_t kOversampling = 16;
+
+template <typename T>
+std::vector<T> PickSplitters(const std::vector<T>& data, std::size_t buckets) {
+  const std::size_t sample_size = std::min(data.size(), buckets * kOversampling);
+  std::mt19937_64 gen(data.size());
+  std::uniform_int_distribution<std::size_t> dist(0, data.size() - 1);
+
+  std::vector<T> sample(sample_size);
+  for (auto& s : sample) {
+    s = data[dist(gen)];
+  }
+  std::ranges::sort(sample);
+
+  std::vector<T> splitters;
+  splitters.reserve(buckets - 1);
+  for (std::size_t i = 1; i < buckets; ++i) {
+    const T& candidate = sample[(i * sample_size) / buckets];
+    if (splitters.empty() || splitters.back() < candidate) {
+      splitters.push_back(candidate);
+    }
+  }
+  return splitters;
+}
+
+// Buckets alternate between open intervals and single splitter values: bucket 2j holds keys lying
+// between splitters j-1 and j, bucket 2j+1 holds keys equal to splitter j and never needs sorting.
+template <typename T>
+std::uint32_t Classify(const std::vector<T>& splitters, const T& value) {
+  const auto it = std::ranges::lower_bound(splitters, value);
+  const auto j = static_cast<std::uint32_t>(it - splitters.begin());
+  return (it != splitters.end() && !(value < *it)) ? (2 * j) + 1 : 2 * j;
+}
+
+void RunInThreads(int num_threads, const std::function<void(int)>& body) {
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back(body, t);
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+}
+
+}  // namespace
+
+template <typename T>
+void nesterov_a_sample_sort_stl::SampleSortSTL<T>::Sort(std::vector<T>& data, int num_threads) {
+  const std::size_t n = data.size();
+  if (num_threads <= 1 || n < kSequentialThreshold) {
+    std::ranges::sort(data);
+    return;
+  }
+
+  const auto splitters = PickSplitters(data, static_cast<std::size_t>(num_threads) * kBucketsPerThread);
+  const std::size_t num_buckets = (2 * splitters.size()) + 1;
+  const std::size_t chunk = (n + num_threads - 1) / num_threads;
+
+  std::vector<std::uint32_t> bucket_of(n);
+  // counts[(t * num_buckets) + b] is the number of keys of chunk t falling into bucket b
+  std::vector<std::size_t> counts(num_threads * num_buckets, 0);
+
+  RunInThreads(num_threads, [&](int t) {
+    std::size_t* local = &counts[t * num_buckets];
+    const std::size_t last = std::min(n, (t + 1) * chunk);
+    for (std::size_t i = t * chunk; i < last; ++i) {
+      bucket_of[i] = Classify(splitters, data[i]);
+      ++local[bucket_of[i]];
+    }
+  });
+
+  std::vector<std::size_t> bucket_begin(num_buckets + 1, 0);
+  std::size_t sum = 0;
+  for (std::size_t b = 0; b < num_buckets; ++b) {
+    bucket_begin[b] = sum;
+    for (int t = 0; t < num_threads; ++t) {
+      const std::size_t cnt = counts[(t * num_buckets) + b];
+      counts[(t * num_buckets) + b] = sum;
+      sum += cnt;
+    }
+  }
+  bucket_begin[num_buckets] = n;
+
+  std::vector<T> buffer(n);
+  RunInThreads(num_threads, [&](int t) {
+    std::size_t* pos = &counts[t * num_buckets];
+    const std::size_t last = std::min(n, (t + 1) * chunk);
+    for (std::size_t i = t * chunk; i < last; ++i) {
+      buffer[pos[bucket_of[i]]++] = data[i];
+    }
+  });
+
+  // buckets differ in size, so threads grab them one at a time instead of a fixed share
+  std::atomic<std::size_t> next_bucket{0};
+  RunInThreads(num_threads, [&](int /*t*/) {
+    for (std::size_t b = 2 * next_bucket++; b < num_buckets; b = 2 * next_bucket++) {
+      std::sort(buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b]),
+                buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]));
+    }
+  });
+
+  data.swap(buffer);
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_stl::SampleSortSTL<T>::PreProcessingImpl() {
+  auto* in_ptr = reinterpret_cast<T*>(task_data->inputs[0]);
+  data_ = std::vector<T>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_stl::SampleSortSTL<T>::ValidationImpl() {
+  return task_data->inputs.size() == 1 && task_data->outputs.size() == 1 &&
+         task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_stl::SampleSortSTL<T>::RunImpl() {
+  Sort(data_, ppc::util::GetPPCNumThreads());
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_stl::SampleSortSTL<T>::PostProcessingImpl() {
+  std::ranges::copy(data_, reinterpret_cast<T*>(task_data->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sample_sort_stl::SampleSortSTL<int>;
+template class nesterov_a_sample_sort_stl::SampleSortSTL<std::int64_t>;
+template class nesterov_a_sample_sort_stl::SampleSortSTL<double>;
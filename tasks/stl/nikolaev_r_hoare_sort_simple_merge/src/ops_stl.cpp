@@ -1,13 +1,38 @@
 #include "../include/ops_stl.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <random>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/stl_part_runner.hpp"
 #include "core/util/include/util.hpp"
 
+namespace {
+
+constexpr std::size_t kParallelPartitionThreshold = 1 << 16;
+
+std::minstd_rand &PivotGenerator() {
+  thread_local std::minstd_rand gen(std::random_device{}());
+  return gen;
+}
+
+int DepthLimit(std::size_t n) { return 2 * static_cast<int>(std::bit_width(n)); }
+
+double MedianOfThree(const double *first, std::size_t n) {
+  std::uniform_int_distribution<std::size_t> dist(0, n - 1);
+  const double a = first[dist(PivotGenerator())];
+  const double b = first[dist(PivotGenerator())];
+  const double c = first[dist(PivotGenerator())];
+  return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+}  // namespace
+
 bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -22,39 +47,11 @@ bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::Validation
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::RunImpl() {
-  unsigned int num_threads = ppc::util::GetPPCNumThreads();
-  if (num_threads == 1 || vect_size_ < num_threads) {
-    QuickSort(0, vect_size_ - 1);
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  if (ppc::core::SortIfPresorted(vect_, static_cast<std::size_t>(num_threads), ppc::core::StlPartRunner())) {
     return true;
   }
-
-  size_t total = vect_.size();
-  std::vector<size_t> boundaries;
-  boundaries.push_back(0);
-  size_t chunk_size = total / num_threads;
-  for (unsigned int i = 1; i < num_threads; i++) {
-    boundaries.push_back(i * chunk_size);
-  }
-  boundaries.push_back(total);
-
-  std::vector<std::thread> threads;
-  for (unsigned int i = 0; i < num_threads; ++i) {
-    size_t start_index = boundaries[i];
-    size_t end_index = boundaries[i + 1];
-    threads.emplace_back([this, start_index, end_index]() { QuickSort(start_index, end_index - 1); });
-  }
-
-  for (auto &t : threads) {
-    t.join();
-  }
-
-  size_t merged_end = boundaries[1];
-  for (unsigned int i = 1; i < num_threads; i++) {
-    size_t next_end = boundaries[i + 1];
-    std::inplace_merge(vect_.begin(), vect_.begin() + static_cast<std::vector<double>::difference_type>(merged_end),
-                       vect_.begin() + static_cast<std::vector<double>::difference_type>(next_end));
-    merged_end = next_end;
-  }
+  ParallelQuickSort(0, vect_size_ - 1, num_threads, DepthLimit(vect_size_));
   return true;
 }
 
@@ -66,11 +63,8 @@ bool nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::PostProces
 }
 
 size_t nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::Partition(size_t low, size_t high) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(static_cast<int>(low), static_cast<int>(high));
-
-  size_t random_pivot_index = dist(gen);
+  std::uniform_int_distribution<size_t> dist(low, high);
+  size_t random_pivot_index = dist(PivotGenerator());
   double pivot = vect_[random_pivot_index];
 
   std::swap(vect_[random_pivot_index], vect_[low]);
@@ -91,9 +85,48 @@ void nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::QuickSort(
   if (low >= high) {
     return;
   }
+  IntroSort(low, high, DepthLimit(high - low + 1));
+}
+
+void nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::IntroSort(size_t low, size_t high, int depth) {
+  if (low >= high) {
+    return;
+  }
+  if (depth == 0) {
+    // Too many unbalanced partitions on this path: finish the range with heapsort
+    const auto first = vect_.begin() + static_cast<std::ptrdiff_t>(low);
+    const auto last = vect_.begin() + static_cast<std::ptrdiff_t>(high) + 1;
+    std::make_heap(first, last);
+    std::sort_heap(first, last);
+    return;
+  }
   size_t pivot = Partition(low, high);
   if (pivot > low) {
-    QuickSort(low, pivot - 1);
+    IntroSort(low, pivot - 1, depth - 1);
+  }
+  IntroSort(pivot + 1, high, depth - 1);
+}
+
+// The top levels partition with all available workers; the two halves then split the workers in proportion
+// to their sizes until a range is small enough, or has a single worker, to be finished sequentially.
+void nikolaev_r_hoare_sort_simple_merge_stl::HoareSortSimpleMergeSTL::ParallelQuickSort(size_t low, size_t high,
+                                                                                        int workers, int depth) {
+  const size_t n = high - low + 1;
+  if (workers <= 1 || n < kParallelPartitionThreshold || depth == 0) {
+    IntroSort(low, high, depth);
+    return;
+  }
+  double *first = vect_.data() + low;
+  const size_t split = ppc::core::ParallelPartition(first, n, MedianOfThree(first, n),
+                                                    static_cast<size_t>(workers), ppc::core::StlPartRunner());
+  if (split == 0 || split == n) {
+    IntroSort(low, high, depth - 1);
+    return;
   }
-  QuickSort(pivot + 1, high);
+  const int left_workers = std::clamp(static_cast<int>(((workers * split) + (n / 2)) / n), 1, workers - 1);
+  std::thread left([this, low, split, left_workers, depth] {
+    ParallelQuickSort(low, low + split - 1, left_workers, depth - 1);
+  });
+  ParallelQuickSort(low + split, high, workers - left_workers, depth - 1);
+  left.join();
 }
@@ -7,6 +7,8 @@
 #include <thread>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 void odintsov_m_mulmatrix_cannon_stl::MulMatrixCannonSTL::ShiftRow(std::vector<double>& matrix, int root, int row,
                                                                    int shift) {
   shift = shift % root;
@@ -103,16 +105,6 @@ int odintsov_m_mulmatrix_cannon_stl::MulMatrixCannonSTL::GetBlockSize(int n) {
   }
   return 1;
 }
-void odintsov_m_mulmatrix_cannon_stl::MulMatrixCannonSTL::CopyBlock(const std::vector<double>& matrix,
-                                                                    std::vector<double>& block, int start, int root,
-                                                                    int block_sz) {
-  for (int i = 0; i < block_sz; i++) {
-    for (int j = 0; j < block_sz; j++) {
-      int index = start + (i * root) + j;
-      block[(i * block_sz) + j] = matrix[index];
-    }
-  }
-}
 void odintsov_m_mulmatrix_cannon_stl::MulMatrixCannonSTL::InitializeShift(std::vector<double>& matrix, int root,
                                                                           int grid_size, int block_sz,
                                                                           bool is_row_shift) {
@@ -132,28 +124,10 @@ void odintsov_m_mulmatrix_cannon_stl::MulMatrixCannonSTL::ProcessBlock(int bi, i
                                                                        const std::vector<double>& matrix_a,
                                                                        const std::vector<double>& matrix_b,
                                                                        std::vector<double>& local_c) {
-  std::vector<std::vector<double>> local_blocks_a(num_blocks, std::vector<double>(block_sz * block_sz));
-  std::vector<std::vector<double>> local_blocks_b(num_blocks, std::vector<double>(block_sz * block_sz));
-
   for (int bj = 0; bj < num_blocks; ++bj) {
     int start = ((bi * block_sz) * root) + (bj * block_sz);
-    CopyBlock(matrix_a, local_blocks_a[bj], start, root, block_sz);
-    CopyBlock(matrix_b, local_blocks_b[bj], start, root, block_sz);
-  }
-
-  for (int bj = 0; bj < num_blocks; ++bj) {
-    const auto& a = local_blocks_a[bj];
-    const auto& b = local_blocks_b[bj];
-
-    for (int i = 0; i < block_sz; ++i) {
-      for (int k = 0; k < block_sz; ++k) {
-        double a_ik = a[(i * block_sz) + k];
-        for (int j = 0; j < block_sz; ++j) {
-          int index = (((bi * block_sz) + i) * root) + ((bj * block_sz) + j);
-          local_c[index] += a_ik * b[((k * block_sz) + j)];
-        }
-      }
-    }
+    ppc::core::Gemm(block_sz, block_sz, block_sz, &matrix_a[start], root, &matrix_b[start], root, &local_c[start],
+                    root);
   }
 }
 
@@ -5,9 +5,14 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_stl {
+// T is the input element type and AccT the type C is accumulated in.
+// inputs[2] may point to ppc::core::MatrixDesc A, B and C, in which case each operand is an n x n view with its own
+// leading dimension, layout and transpose flag instead of a contiguous row-major matrix.
+template <typename T, typename AccT = T>
 class CannonSTL : public ppc::core::Task {
  public:
   explicit CannonSTL(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -21,14 +26,33 @@ class CannonSTL : public ppc::core::Task {
   int N_;
   int block_size_;
   int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
-
-  void InitialShift(int num_threads, int blocks_per_thread);
-  void BlockMultiply(int num_threads, int blocks_per_thread);
-  void ShiftBlocks(int num_threads, int blocks_per_thread);
-  void ProcessSingleBlock(int bi, int bj, int bi_start, std::vector<double>& local);
-  void MergeResults(int num_threads, int bi_range, const std::vector<std::vector<double>>& local_c);
+  const T *A_{};
+  const T *B_{};
+  std::vector<AccT> C_;
+  ppc::core::MatrixDesc desc_a_;
+  ppc::core::MatrixDesc desc_b_;
+  ppc::core::MatrixDesc desc_c_;
+
+  void BlockMultiply(int step, int num_threads, int blocks_per_thread);
+};
+
+// Batched product of n x n matrices stored consecutively: each std::thread multiplies its share of the batch with
+// the fixed-size kernels. Task data as in CannonSTL, with inputs_count[2] = n instead of a block count.
+template <typename T>
+class BatchedMatMulSTL : public ppc::core::Task {
+ public:
+  explicit BatchedMatMulSTL(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  int N_;
+  int batch_size_;
+  std::vector<T> A_;
+  std::vector<T> B_;
+  std::vector<T> C_;
 };
 }  // namespace vavilov_v_cannon_stl
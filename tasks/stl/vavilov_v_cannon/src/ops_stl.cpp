@@ -1,55 +1,100 @@
 #include "stl/vavilov_v_cannon/include/ops_stl.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <thread>
 #include <vector>
 
+#include "core/batched_gemm/include/batched_gemm.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/tuning/include/tuning.hpp"
 #include "core/util/include/util.hpp"
 
-bool vavilov_v_cannon_stl::CannonSTL::PreProcessingImpl() {
-  N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
+namespace {
+
+// Descriptors of A, B and C if the caller passed them in inputs[2]
+const ppc::core::MatrixDesc *Layouts(const ppc::core::TaskData &data) {
+  return data.inputs.size() > 2 ? reinterpret_cast<const ppc::core::MatrixDesc *>(data.inputs[2]) : nullptr;
+}
+
+// All three views are n x n and stay inside their buffers.
+bool ValidLayouts(const ppc::core::TaskData &data, const ppc::core::MatrixDesc *layouts) {
+  const std::size_t n = layouts[0].rows;
+  const std::array<std::size_t, 3> sizes = {data.inputs_count[0], data.inputs_count[1], data.outputs_count[0]};
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    if (!layouts[i].IsValid() || layouts[i].rows != n || layouts[i].cols != n || layouts[i].Span() > sizes[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_stl::CannonSTL<T, AccT>::PreProcessingImpl() {
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    desc_a_ = layouts[0];
+    desc_b_ = layouts[1];
+    desc_c_ = layouts[2];
+  } else {
+    const auto n = static_cast<std::size_t>(std::sqrt(task_data->inputs_count[0]));
+    desc_a_ = desc_b_ = desc_c_ = ppc::core::RowMajorDesc(n, n);
+  }
+  N_ = static_cast<int>(desc_a_.rows);
+  num_blocks_ = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  if (num_blocks_ == 0) {
+    const auto block = static_cast<int>(ppc::core::NearestDivisor(N_, ppc::core::TunedMatrixBlockSize()));
+    num_blocks_ = std::max<int>(N_ / block, 1);
+  }
   block_size_ = N_ / num_blocks_;
 
-  auto *a = reinterpret_cast<double *>(task_data->inputs[0]);
-  auto *b = reinterpret_cast<double *>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
+  A_ = reinterpret_cast<const T *>(task_data->inputs[0]);
+  B_ = reinterpret_cast<const T *>(task_data->inputs[1]);
   C_.assign(N_ * N_, 0);
 
   return true;
 }
 
-bool vavilov_v_cannon_stl::CannonSTL::ValidationImpl() {
-  if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
-      task_data->outputs_count[0] != task_data->inputs_count[0]) {
-    return false;
+template <typename T, typename AccT>
+bool vavilov_v_cannon_stl::CannonSTL<T, AccT>::ValidationImpl() {
+  int n = 0;
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    if (!ValidLayouts(*task_data, layouts)) {
+      return false;
+    }
+    n = static_cast<int>(layouts[0].rows);
+  } else {
+    if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
+        task_data->outputs_count[0] != task_data->inputs_count[0]) {
+      return false;
+    }
+    n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   }
-
-  auto n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  auto num_blocks = static_cast<int>(task_data->inputs_count[2]);
-  return n % num_blocks == 0;
+  // Without a block count, or with 0, PreProcessing picks one from the tuned block size
+  auto num_blocks = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  return num_blocks == 0 || n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_stl::CannonSTL::InitialShift(int num_threads, int blocks_per_thread) {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
+// Step `step` of Cannon's algorithm with the rotations folded into the block index k; A_ and B_ stay in place.
+template <typename T, typename AccT>
+void vavilov_v_cannon_stl::CannonSTL<T, AccT>::BlockMultiply(int step, int num_threads, int blocks_per_thread) {
+  const ppc::core::MatrixDesc block_a = desc_a_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_b = desc_b_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_c = ppc::core::RowMajorDesc(N_, N_).Block(block_size_, block_size_);
   std::vector<std::thread> threads;
 
-  auto shift_work = [&](int bi_start, int bi_end) {
+  // Each thread owns whole block rows of C, so the threads accumulate straight into C_
+  auto process_block_range = [&](int bi_start, int bi_end) {
     for (int bi = bi_start; bi < bi_end; ++bi) {
       for (int bj = 0; bj < num_blocks_; ++bj) {
-        int src_row = (bi + bj) % num_blocks_;
-        int src_col = (bj + bi) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[((bi * block_size_ + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
+        const int k = (bi + bj + step) % num_blocks_;
+        ppc::core::Gemm(block_a, A_ + desc_a_.Offset(bi * block_size_, k * block_size_), block_b,
+                        B_ + desc_b_.Offset(k * block_size_, bj * block_size_), block_c,
+                        &C_[(bi * block_size_ * N_) + (bj * block_size_)]);
       }
     }
   };
@@ -58,7 +103,7 @@ void vavilov_v_cannon_stl::CannonSTL::InitialShift(int num_threads, int blocks_p
     int start = t * blocks_per_thread;
     int end = std::min(start + blocks_per_thread, num_blocks_);
     if (start < end) {
-      threads.emplace_back(shift_work, start, end);
+      threads.emplace_back(process_block_range, start, end);
     }
   }
   for (auto &thread : threads) {
@@ -66,114 +111,76 @@ void vavilov_v_cannon_stl::CannonSTL::InitialShift(int num_threads, int blocks_p
   }
 }
 
-void vavilov_v_cannon_stl::CannonSTL::ProcessSingleBlock(int bi, int bj, int bi_start, std::vector<double> &local) {
-  for (int i = bi; i < bi + block_size_; i++) {
-    for (int j = bj; j < bj + block_size_; j++) {
-      double temp = 0.0;
-      for (int k = 0; k < block_size_; k++) {
-        const int row_a = bi + (i - bi);
-        const int col_a = bj + k;
-        const int row_b = bi + k;
-        const int col_b = bj + (j - bj);
-        temp += A_[(row_a * N_) + col_a] * B_[(row_b * N_) + col_b];
-      }
-      local[((i - bi_start) * N_) + j] += temp;
-    }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_stl::CannonSTL<T, AccT>::RunImpl() {
+  int num_threads = std::min(ppc::util::GetPPCNumThreads(), num_blocks_);
+  int blocks_per_thread = (num_blocks_ + num_threads - 1) / num_threads;
+  for (int iter = 0; iter < num_blocks_; ++iter) {
+    BlockMultiply(iter, num_threads, blocks_per_thread);
   }
+  return true;
 }
 
-void vavilov_v_cannon_stl::CannonSTL::MergeResults(int num_threads, int bi_range,
-                                                   const std::vector<std::vector<double>> &local_c) {
-  for (int t = 0; t < num_threads; ++t) {
-    const int bi_start = t * bi_range;
-    const int bi_end = std::min(bi_start + bi_range, N_);
-    if (bi_start < N_) {
-      const std::vector<double> &local = local_c[t];
-      for (int i = bi_start; i < bi_end; ++i) {
-        for (int j = 0; j < N_; ++j) {
-          C_[(i * N_) + j] += local[((i - bi_start) * N_) + j];
-        }
-      }
-    }
-  }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_stl::CannonSTL<T, AccT>::PostProcessingImpl() {
+  ppc::core::CopyToMatrix(C_.data(), desc_c_, reinterpret_cast<AccT *>(task_data->outputs[0]));
+  return true;
 }
 
-void vavilov_v_cannon_stl::CannonSTL::BlockMultiply(int num_threads, int blocks_per_thread) {
-  std::vector<std::vector<double>> local_c(num_threads);
-  const int bi_range = blocks_per_thread * block_size_;
-  std::vector<std::thread> threads;
+template <typename T>
+bool vavilov_v_cannon_stl::BatchedMatMulSTL<T>::PreProcessingImpl() {
+  N_ = static_cast<int>(task_data->inputs_count[2]);
+  batch_size_ = static_cast<int>(task_data->inputs_count[0] / (N_ * N_));
 
-  auto process_block_range = [&](int bi_start, int bi_end, int thread_id) {
-    std::vector<double> &local = local_c[thread_id];
-    local.resize((bi_end - bi_start) * N_, 0.0);
+  auto *a = reinterpret_cast<T *>(task_data->inputs[0]);
+  auto *b = reinterpret_cast<T *>(task_data->inputs[1]);
+  A_.assign(a, a + task_data->inputs_count[0]);
+  B_.assign(b, b + task_data->inputs_count[1]);
+  C_.assign(task_data->outputs_count[0], 0);
 
-    for (int bi = bi_start; bi < bi_end; bi += block_size_) {
-      for (int bj = 0; bj < N_; bj += block_size_) {
-        ProcessSingleBlock(bi, bj, bi_start, local);
-      }
-    }
-  };
+  return true;
+}
 
-  for (int t = 0; t < num_threads; ++t) {
-    const int bi_start = t * bi_range;
-    const int bi_end = std::min(bi_start + bi_range, N_);
-    if (bi_start < N_) {
-      threads.emplace_back(process_block_range, bi_start, bi_end, t);
-    }
-  }
-  for (auto &thread : threads) {
-    thread.join();
+template <typename T>
+bool vavilov_v_cannon_stl::BatchedMatMulSTL<T>::ValidationImpl() {
+  if (task_data->inputs_count.size() < 3 || task_data->inputs_count[0] != task_data->inputs_count[1] ||
+      task_data->outputs_count[0] != task_data->inputs_count[0]) {
+    return false;
   }
 
-  MergeResults(num_threads, bi_range, local_c);
+  auto n = task_data->inputs_count[2];
+  return n > 0 && task_data->inputs_count[0] % (n * n) == 0;
 }
 
-void vavilov_v_cannon_stl::CannonSTL::ShiftBlocks(int num_threads, int blocks_per_thread) {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
+template <typename T>
+bool vavilov_v_cannon_stl::BatchedMatMulSTL<T>::RunImpl() {
+  const auto stride = static_cast<std::size_t>(N_) * N_;
+  const int num_threads = std::min(ppc::util::GetPPCNumThreads(), std::max(batch_size_, 1));
   std::vector<std::thread> threads;
-
-  auto shift_work = [&](int bi_start, int bi_end) {
-    for (int bi = bi_start; bi < bi_end; ++bi) {
-      for (int bj = 0; bj < num_blocks_; ++bj) {
-        int src_row = (bi + 1) % num_blocks_;
-        int src_col = (bj + 1) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
-    }
-  };
-
+  threads.reserve(num_threads);
   for (int t = 0; t < num_threads; ++t) {
-    int start = t * blocks_per_thread;
-    int end = std::min(start + blocks_per_thread, num_blocks_);
-    if (start < end) {
-      threads.emplace_back(shift_work, start, end);
-    }
+    const std::size_t first = static_cast<std::size_t>(batch_size_) * t / num_threads;
+    const std::size_t last = static_cast<std::size_t>(batch_size_) * (t + 1) / num_threads;
+    threads.emplace_back([this, first, last, stride] {
+      const std::size_t offset = first * stride;
+      ppc::core::GemmStridedBatched(last - first, N_, N_, N_, A_.data() + offset, N_, stride, B_.data() + offset, N_,
+                                    stride, C_.data() + offset, N_, stride);
+    });
   }
   for (auto &thread : threads) {
     thread.join();
   }
-}
-
-bool vavilov_v_cannon_stl::CannonSTL::RunImpl() {
-  int num_threads = std::min(ppc::util::GetPPCNumThreads(), num_blocks_);
-  int blocks_per_thread = (num_blocks_ + num_threads - 1) / num_threads;
-  InitialShift(num_threads, blocks_per_thread);
-  for (int iter = 0; iter < num_blocks_; ++iter) {
-    BlockMultiply(num_threads, blocks_per_thread);
-    ShiftBlocks(num_threads, blocks_per_thread);
-  }
   return true;
 }
 
-bool vavilov_v_cannon_stl::CannonSTL::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double *>(task_data->outputs[0]));
+template <typename T>
+bool vavilov_v_cannon_stl::BatchedMatMulSTL<T>::PostProcessingImpl() {
+  std::ranges::copy(C_, reinterpret_cast<T *>(task_data->outputs[0]));
   return true;
 }
+
+template class vavilov_v_cannon_stl::CannonSTL<double>;
+template class vavilov_v_cannon_stl::CannonSTL<float>;
+template class vavilov_v_cannon_stl::CannonSTL<float, double>;
+template class vavilov_v_cannon_stl::BatchedMatMulSTL<double>;
+template class vavilov_v_cannon_stl::BatchedMatMulSTL<float>;
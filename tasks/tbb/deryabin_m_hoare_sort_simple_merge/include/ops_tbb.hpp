@@ -12,6 +12,13 @@ namespace deryabin_m_hoare_sort_simple_merge_tbb {
 void HoaraSort(std::vector<double>& a, size_t first, size_t last);
 // слияние двух отсортированных частей
 void MergeTwoParts(std::vector<double>& a, size_t left, size_t right, size_t dimension);
+// k-я порядковая статистика: a[k] встаёт на место, которое занял бы после полной сортировки, слева от него
+// нет больших элементов, справа нет меньших; при k вне массива ничего не делает
+void NthElement(std::vector<double>& a, size_t k);
+// k наименьших элементов сортируются в a[0, k), порядок остальных не определён
+void PartialSort(std::vector<double>& a, size_t k);
+// k наибольших элементов в порядке убывания
+std::vector<double> TopK(const std::vector<double>& a, size_t k);
 
 class HoareSortTaskSequential : public ppc::core::Task {
  public:
@@ -8,6 +8,9 @@
 #include <numbers>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+#include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
@@ -66,6 +69,20 @@ void deryabin_m_hoare_sort_simple_merge_tbb::MergeTwoParts(std::vector<double>&
   }
 }
 
+// Выбор разбивает массив параллельным разбиением Хоара из core/sort, а не HoaraSort, которая не завершается на
+// равных опорному элементах
+void deryabin_m_hoare_sort_simple_merge_tbb::NthElement(std::vector<double>& a, size_t k) {
+  ppc::core::NthElement(a, k, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()), ppc::core::TbbPartRunner());
+}
+
+void deryabin_m_hoare_sort_simple_merge_tbb::PartialSort(std::vector<double>& a, size_t k) {
+  ppc::core::PartialSort(a, k, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()), ppc::core::TbbPartRunner());
+}
+
+std::vector<double> deryabin_m_hoare_sort_simple_merge_tbb::TopK(const std::vector<double>& a, size_t k) {
+  return ppc::core::TopK(a, k, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()), ppc::core::TbbPartRunner());
+}
+
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskSequential::PreProcessingImpl() {
   input_array_A_ = reinterpret_cast<std::vector<double>*>(task_data->inputs[0])[0];
   dimension_ = task_data->inputs_count[0];
@@ -117,6 +134,10 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::RunImpl() {
+  if (ppc::core::SortIfPresorted(input_array_A_, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()),
+                                 ppc::core::TbbPartRunner())) {
+    return true;
+  }
   oneapi::tbb::parallel_for(0, (int)chunk_count_, 1, [=, this](int count) {
     HoaraSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
   });
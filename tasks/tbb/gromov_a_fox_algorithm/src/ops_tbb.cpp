@@ -4,22 +4,22 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+#include "core/tuning/include/tuning.hpp"
+#include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 namespace {
 void FoxBlockMul(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int n,
-                 int block_size, int stage, int i, int j, int k) {
-  for (int bi = i; bi < std::min(i + block_size, n); ++bi) {
-    for (int bj = j; bj < std::min(j + block_size, n); ++bj) {
-      double sum = 0.0;
-      for (int bk = k; bk < std::min(k + block_size, n); ++bk) {
-        sum += a[(bi * n) + bk] * b[(bk * n) + bj];
-      }
-      c[(bi * n) + bj] += sum;
-    }
-  }
+                 int block_size, int i, int j, int k) {
+  const auto rows = static_cast<std::size_t>(std::min(block_size, n - i));
+  const auto cols = static_cast<std::size_t>(std::min(block_size, n - j));
+  const auto depth = static_cast<std::size_t>(std::min(block_size, n - k));
+  const auto ld = static_cast<std::size_t>(n);
+  ppc::core::Gemm(rows, cols, depth, &a[(i * n) + k], ld, &b[(k * n) + j], ld, &c[(i * n) + j], ld);
 }
 }  // namespace
 
@@ -43,21 +43,9 @@ bool gromov_a_fox_algorithm_tbb::TestTaskTBB::PreProcessingImpl() {
     return false;
   }
 
-  block_size_ = static_cast<int>(std::sqrt(n_));
-  for (int i = block_size_; i >= 1; --i) {
-    if (n_ % i == 0) {
-      block_size_ = i;
-      break;
-    }
-  }
-  for (int i = block_size_ + 1; i <= n_; ++i) {
-    if (n_ % i == 0) {
-      if (std::abs(i - static_cast<int>(std::sqrt(n_))) < std::abs(block_size_ - static_cast<int>(std::sqrt(n_)))) {
-        block_size_ = i;
-      }
-      break;
-    }
-  }
+  // The tuned block size, shrunk if needed so that there is a block of C for every thread
+  const int side = static_cast<int>(std::ceil(std::sqrt(ppc::util::GetPPCNumThreads())));
+  block_size_ = std::min(static_cast<int>(ppc::core::TunedMatrixBlockSize()), (n_ + side - 1) / side);
   return block_size_ > 0;
 }
 
@@ -80,7 +68,7 @@ bool gromov_a_fox_algorithm_tbb::TestTaskTBB::RunImpl() {
 
     for (int step = 0; step < num_blocks; ++step) {
       int k = (i + step) % num_blocks;
-      FoxBlockMul(A_, B_, output_, n_, block_size_, step, i * block_size_, j * block_size_, k * block_size_);
+      FoxBlockMul(A_, B_, output_, n_, block_size_, i * block_size_, j * block_size_, k * block_size_);
     }
   });
 
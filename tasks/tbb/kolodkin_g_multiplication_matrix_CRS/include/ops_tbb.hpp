@@ -1,9 +1,11 @@
 #pragma once
 
 #include <complex>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sparse_io/include/sparse_io.hpp"
 #include "core/task/include/task.hpp"
 
 using Complex = std::complex<double>;
@@ -24,8 +26,10 @@ struct SparseMatrixCRS {
   SparseMatrixCRS& operator=(const SparseMatrixCRS& other) = default;
   static void PrintSparseMatrix(const SparseMatrixCRS& matrix);
 };
-std::vector<Complex> ParseMatrixIntoVec(const SparseMatrixCRS& mat);
-SparseMatrixCRS ParseVectorIntoMatrix(std::vector<Complex>& vec);
+// Matrices are passed to and from the task one per buffer, in the binary format of core/sparse_io.
+std::vector<std::byte> ParseMatrixIntoBytes(const SparseMatrixCRS& mat,
+                                            ppc::core::SparseIndexCoding coding = ppc::core::SparseIndexCoding::kPlain);
+SparseMatrixCRS ParseBytesIntoMatrix(const std::byte* data, std::size_t size);
 bool CheckMatrixesEquality(const SparseMatrixCRS& a, const SparseMatrixCRS& b);
 bool AreEqualElems(const Complex& a, const Complex& b, double epsilon);
 class TestTaskTBB : public ppc::core::Task {
@@ -37,8 +41,8 @@ class TestTaskTBB : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<Complex> input_, output_;
-  SparseMatrixCRS A_, B_;
+  std::vector<std::byte> output_;
+  ppc::core::SparseFileView<Complex> A_, B_;
 };
 
 }  // namespace kolodkin_g_multiplication_matrix_tbb
@@ -10,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/kondratev_ya_ccs_complex_multiplication/include/ops_tbb.hpp"
 
@@ -102,7 +103,7 @@ struct Matrices {
   kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix &out;
 };
 
-void RunTest(Matrices matrices) {
+void RunTest(Matrices matrices, ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved) {
   auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
 
   task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(&matrices.in1));
@@ -112,7 +113,7 @@ void RunTest(Matrices matrices) {
   task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(&matrices.out));
   task_data_tbb->outputs_count.emplace_back(1);
 
-  kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB test_task_tbbuential(task_data_tbb);
+  kondratev_ya_ccs_complex_multiplication_tbb::TestTaskTBB test_task_tbbuential(task_data_tbb, storage);
   ASSERT_TRUE(test_task_tbbuential.Validation());
   ASSERT_TRUE(test_task_tbbuential.PreProcessing());
   ASSERT_TRUE(test_task_tbbuential.Run());
@@ -274,6 +275,20 @@ TEST(kondratev_ya_ccs_complex_multiplication_tbb, random_matrix_multiplication)
   CCSExpectEqual(ccs_c, ccs_expected);
 }
 
+TEST(kondratev_ya_ccs_complex_multiplication_tbb, split_storage_random_matrix_multiplication) {
+  auto a = GenerateRandomSparseMatrix({60, 45}, 0.1);
+  auto b = GenerateRandomSparseMatrix({45, 70}, 0.1);
+
+  auto ccs_a = ConvertToCCS(a, {60, 45});
+  auto ccs_b = ConvertToCCS(b, {45, 70});
+  kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix interleaved({60, 70});
+  kondratev_ya_ccs_complex_multiplication_tbb::CCSMatrix split({60, 70});
+
+  RunTest({.in1 = ccs_a, .in2 = ccs_b, .out = interleaved});
+  RunTest({.in1 = ccs_a, .in2 = ccs_b, .out = split}, ppc::core::ComplexStorage::kSplit);
+  CCSExpectEqual(split, interleaved);
+}
+
 TEST(kondratev_ya_ccs_complex_multiplication_tbb, test_incompatible_matrix_sizes) {
   auto a = GenerateRandomSparseMatrix({3, 2}, 0.2);
   auto b = GenerateRandomSparseMatrix({3, 4}, 0.2);
@@ -7,6 +7,7 @@
 #include <random>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/korneeva_e_sparse_matrix_mult_complex_ccs/include/ops_tbb.hpp"
 
@@ -14,13 +15,14 @@ namespace korneeva_e_tbb = korneeva_e_sparse_matrix_mult_complex_ccs_tbb;
 
 namespace {
 void RunTask(korneeva_e_tbb::SparseMatrixCCS& m1, korneeva_e_tbb::SparseMatrixCCS& m2,
-             korneeva_e_tbb::SparseMatrixCCS& result) {
+             korneeva_e_tbb::SparseMatrixCCS& result,
+             ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved) {
   std::shared_ptr<ppc::core::TaskData> task_data = std::make_shared<ppc::core::TaskData>();
   task_data->inputs.push_back(reinterpret_cast<uint8_t*>(&m1));
   task_data->inputs.push_back(reinterpret_cast<uint8_t*>(&m2));
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(&result));
 
-  korneeva_e_tbb::SparseMatrixMultComplexCCS task(task_data);
+  korneeva_e_tbb::SparseMatrixMultComplexCCS task(task_data, storage);
   ASSERT_TRUE(task.Validation());
   task.PreProcessing();
   task.Run();
@@ -370,6 +372,18 @@ TEST(korneeva_e_sparse_matrix_mult_complex_ccs_tbb, test_random_matrices2) {
   EXPECT_LE(result.nnz, 10000);
 }
 
+TEST(korneeva_e_sparse_matrix_mult_complex_ccs_tbb, test_split_storage_matches_interleaved) {
+  auto m1 = CreateRandomMatrix(120, 90, 900);
+  auto m2 = CreateRandomMatrix(90, 110, 800);
+  korneeva_e_tbb::SparseMatrixCCS interleaved;
+  korneeva_e_tbb::SparseMatrixCCS split;
+
+  RunTask(m1, m2, interleaved);
+  RunTask(m1, m2, split, ppc::core::ComplexStorage::kSplit);
+
+  ExpectMatrixEq(split, interleaved, 1e-12);
+}
+
 TEST(korneeva_e_sparse_matrix_mult_complex_ccs_tbb, test_associativity) {
   auto a = CreateCcsFromDense({{korneeva_e_tbb::Complex(1.0, 0.0), korneeva_e_tbb::Complex(2.0, 0.0)},
                                {korneeva_e_tbb::Complex(0.0, 0.0), korneeva_e_tbb::Complex(3.0, 0.0)}});
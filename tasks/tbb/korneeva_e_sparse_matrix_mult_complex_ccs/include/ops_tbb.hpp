@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb {
@@ -28,22 +29,27 @@ struct SparseMatrixCCS {
   }
 };
 
+// The product is formed by ppc::core::CscMatrix::Multiply, or with ComplexStorage::kSplit by the SIMD kernels of
+// ppc::core::SplitCscMatrix on split real and imaginary arrays. Entries that sum to zero are left out either way.
 class SparseMatrixMultComplexCCS : public ppc::core::Task {
  public:
-  explicit SparseMatrixMultComplexCCS(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  explicit SparseMatrixMultComplexCCS(ppc::core::TaskDataPtr task_data,
+                                      ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved)
+      : Task(std::move(task_data)), storage_(storage) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
  private:
+  ppc::core::ComplexStorage storage_;
   SparseMatrixCCS* matrix1_;
   SparseMatrixCCS* matrix2_;
+  ppc::core::CscMatrix<Complex> lhs_;
+  ppc::core::CscMatrix<Complex> rhs_;
+  ppc::core::SplitCscMatrix<double> split_lhs_;
+  ppc::core::SplitCscMatrix<double> split_rhs_;
   SparseMatrixCCS result_;
-
-  void ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data);
-  Complex ComputeElement(int row_idx, int col_start2, int col_end2);
-  Complex ComputeContribution(int row_idx, int k, int col_start1, int col_end1, int col_start2, int col_end2);
 };
 
 }  // namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb
\ No newline at end of file
@@ -1,18 +1,53 @@
 #include "tbb/korneeva_e_sparse_matrix_mult_complex_ccs/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 
 #include <algorithm>
-#include <cmath>
+#include <complex>
 #include <cstddef>
-#include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+#include "core/util/include/util.hpp"
+
 namespace korneeva_e_sparse_matrix_mult_complex_ccs_tbb {
 
+namespace {
+ppc::core::CscMatrix<Complex> ToCscMatrix(const SparseMatrixCCS& ccs) {
+  return {
+      .rows = ccs.rows, .cols = ccs.cols, .col_ptr = ccs.col_offsets, .row_idx = ccs.row_indices, .values = ccs.values};
+}
+
+// Copies the product into result without the entries that sum to zero; value_at(e) is entry e of the product
+template <typename Product, typename ValueAt>
+void CopyNonZeros(const Product& product, const ValueAt& value_at, SparseMatrixCCS& result) {
+  result.values.clear();
+  result.row_indices.clear();
+  result.col_offsets.assign(product.col_ptr.size(), 0);
+  for (std::size_t j = 0; j + 1 < product.col_ptr.size(); ++j) {
+    for (int e = product.col_ptr[j]; e < product.col_ptr[j + 1]; ++e) {
+      if (const Complex value = value_at(e); value != Complex(0.0, 0.0)) {
+        result.values.push_back(value);
+        result.row_indices.push_back(product.row_idx[e]);
+      }
+    }
+    result.col_offsets[j + 1] = static_cast<int>(result.values.size());
+  }
+  result.nnz = static_cast<int>(result.values.size());
+}
+}  // namespace
+
 bool SparseMatrixMultComplexCCS::PreProcessingImpl() {
   matrix1_ = reinterpret_cast<SparseMatrixCCS*>(task_data->inputs[0]);
   matrix2_ = reinterpret_cast<SparseMatrixCCS*>(task_data->inputs[1]);
+  lhs_ = ToCscMatrix(*matrix1_);
+  rhs_ = ToCscMatrix(*matrix2_);
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_lhs_ = ppc::core::SplitCscMatrix<double>::FromInterleaved(lhs_);
+    split_rhs_ = ppc::core::SplitCscMatrix<double>::FromInterleaved(rhs_);
+  }
   result_ = SparseMatrixCCS(matrix1_->rows, matrix2_->cols, 0);
   return true;
 }
@@ -30,76 +65,19 @@ bool SparseMatrixMultComplexCCS::ValidationImpl() {
 }
 
 bool SparseMatrixMultComplexCCS::RunImpl() {
-  std::vector<std::vector<std::pair<Complex, int>>> column_results(matrix2_->cols);
-
-  oneapi::tbb::parallel_for(
-      oneapi::tbb::blocked_range<int>(0, matrix2_->cols, std::max<size_t>(16, matrix2_->cols / 16)),
-      [&](const oneapi::tbb::blocked_range<int>& r) {
-        for (int j = r.begin(); j != r.end(); ++j) {
-          ComputeColumn(j, column_results[j]);
-        }
-      });
-
-  std::vector<Complex> temp_values;
-  std::vector<int> temp_row_indices;
-  std::vector<int> temp_col_offsets(matrix2_->cols + 1, 0);
-
-  int nnz = 0;
-  for (int j = 0; j < matrix2_->cols; ++j) {
-    auto& col_data = column_results[j];
-    for (const auto& [value, row_idx] : col_data) {
-      temp_values.push_back(value);
-      temp_row_indices.push_back(row_idx);
-      nnz++;
-    }
-    temp_col_offsets[j + 1] = nnz;
+  const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+  oneapi::tbb::task_arena arena(static_cast<int>(parts));
+  const ppc::core::TbbPartRunner run(arena);
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    const auto product = split_lhs_.Multiply(split_rhs_, parts, run);
+    CopyNonZeros(product, [&](int e) { return Complex(product.real[e], product.imag[e]); }, result_);
+  } else {
+    const auto product = lhs_.Multiply(rhs_, parts, run);
+    CopyNonZeros(product, [&](int e) { return product.values[e]; }, result_);
   }
-
-  result_.values = std::move(temp_values);
-  result_.row_indices = std::move(temp_row_indices);
-  result_.col_offsets = std::move(temp_col_offsets);
-  result_.nnz = nnz;
   return true;
 }
 
-void SparseMatrixMultComplexCCS::ComputeColumn(int col_idx, std::vector<std::pair<Complex, int>>& column_data) {
-  int col_start2 = matrix2_->col_offsets[col_idx];
-  int col_end2 = matrix2_->col_offsets[col_idx + 1];
-
-  column_data.reserve(matrix1_->rows);
-  for (int i = 0; i < matrix1_->rows; i++) {
-    Complex sum = ComputeElement(i, col_start2, col_end2);
-    if (sum != Complex(0.0, 0.0)) {
-      column_data.emplace_back(sum, i);
-    }
-  }
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeElement(int row_idx, int col_start2, int col_end2) {
-  Complex sum(0.0, 0.0);
-  for (int k = 0; k < matrix1_->cols; k++) {
-    int col_start1 = matrix1_->col_offsets[k];
-    int col_end1 = matrix1_->col_offsets[k + 1];
-    sum += ComputeContribution(row_idx, k, col_start1, col_end1, col_start2, col_end2);
-  }
-  return sum;
-}
-
-Complex SparseMatrixMultComplexCCS::ComputeContribution(int row_idx, int k, int col_start1, int col_end1,
-                                                        int col_start2, int col_end2) {
-  Complex contribution(0.0, 0.0);
-  for (int p = col_start1; p < col_end1; p++) {
-    if (matrix1_->row_indices[p] == row_idx) {
-      for (int q = col_start2; q < col_end2; q++) {
-        if (matrix2_->row_indices[q] == k) {
-          contribution += matrix1_->values[p] * matrix2_->values[q];
-        }
-      }
-    }
-  }
-  return contribution;
-}
-
 bool SparseMatrixMultComplexCCS::PostProcessingImpl() {
   *reinterpret_cast<SparseMatrixCCS*>(task_data->outputs[0]) = result_;
   return true;
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include <cstdlib>
@@ -173,3 +174,51 @@ TEST(kovalchuk_a_shell_sort_tbb_func, Test_RandomData) {
   std::vector<int> expected = {1, 2, 3, 4, 7, 9};
   EXPECT_EQ(expected, output);
 }
+
+TEST(kovalchuk_a_shell_sort_tbb_func, Test_FewAscendingRuns) {
+  std::vector<int> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<int>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  kovalchuk_a_shell_sort_tbb::ShellSortTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(kovalchuk_a_shell_sort_tbb_func, Test_NonIncreasing) {
+  std::vector<int> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<int>(500 - (i / 3));
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  kovalchuk_a_shell_sort_tbb::ShellSortTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
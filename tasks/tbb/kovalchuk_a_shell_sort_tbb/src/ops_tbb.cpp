@@ -3,10 +3,14 @@
 #include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 namespace kovalchuk_a_shell_sort_tbb {
@@ -25,6 +29,10 @@ bool ShellSortTBB::ValidationImpl() {
 }
 
 bool ShellSortTBB::RunImpl() {
+  if (ppc::core::SortIfPresorted(input_, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()),
+                                 ppc::core::TbbPartRunner())) {
+    return true;
+  }
   ShellSort();
   return true;
 }
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "tbb/nesterov_a_sample_sort/include/ops_tbb.hpp"
+
+namespace {
+template <typename T>
+void RunAndCheck(std::vector<T> in) {
+  std::vector<T> out(in.size());
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nesterov_a_sample_sort_tbb::SampleSortTBB<T> test_task_tbb(task_data_tbb);
+  ASSERT_TRUE(test_task_tbb.Validation());
+  ASSERT_TRUE(test_task_tbb.PreProcessing());
+  ASSERT_TRUE(test_task_tbb.Run());
+  ASSERT_TRUE(test_task_tbb.PostProcessing());
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+std::vector<int> GenRandVec(std::size_t size, int min, int max) {
+  std::mt19937 gen(static_cast<unsigned>(size));
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<int> vec(size);
+  std::ranges::generate(vec, [&] { return dist(gen); });
+  return vec;
+}
+}  // namespace
+
+TEST(nesterov_a_sample_sort_tbb, test_empty) { RunAndCheck(std::vector<int>{}); }
+
+TEST(nesterov_a_sample_sort_tbb, test_single_element) { RunAndCheck(std::vector<int>{42}); }
+
+TEST(nesterov_a_sample_sort_tbb, test_small_random) { RunAndCheck(GenRandVec(100, -1000, 1000)); }
+
+TEST(nesterov_a_sample_sort_tbb, test_large_random) { RunAndCheck(GenRandVec(100000, -1000000, 1000000)); }
+
+TEST(nesterov_a_sample_sort_tbb, test_few_unique) { RunAndCheck(GenRandVec(100000, 0, 3)); }
+
+TEST(nesterov_a_sample_sort_tbb, test_all_equal) { RunAndCheck(std::vector<int>(50000, 7)); }
+
+TEST(nesterov_a_sample_sort_tbb, test_sorted) {
+  auto in = GenRandVec(50000, -100000, 100000);
+  std::ranges::sort(in);
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_tbb, test_reverse_sorted) {
+  auto in = GenRandVec(50000, -100000, 100000);
+  std::ranges::sort(in, std::greater<>());
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_tbb, test_int64) {
+  std::mt19937_64 gen(1);
+  std::vector<std::int64_t> in(40000);
+  std::ranges::generate(in, [&] { return static_cast<std::int64_t>(gen()); });
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_tbb, test_double) {
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<double> dist(-1e6, 1e6);
+  std::vector<double> in(40000);
+  std::ranges::generate(in, [&] { return dist(gen); });
+  RunAndCheck(in);
+}
+
+TEST(nesterov_a_sample_sort_tbb, test_sort_with_many_threads) {
+  auto in = GenRandVec(30000, -500, 500);
+  auto expected = in;
+  std::ranges::sort(expected);
+  nesterov_a_sample_sort_tbb::SampleSortTBB<int>::Sort(in, 16);
+  EXPECT_EQ(expected, in);
+}
+
+TEST(nesterov_a_sample_sort_tbb, test_invalid_output_size) {
+  std::vector<int> in(10, 1);
+  std::vector<int> out(5);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nesterov_a_sample_sort_tbb::SampleSortTBB<int> test_task_tbb(task_data_tbb);
+  EXPECT_FALSE(test_task_tbb.Validation());
+}
@@ -0,0 +1,141 @@
+#include "tbb/nesterov_a_sample_sort/include/ops_tbb.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/util/include/util.hpp"
+#include "oneapi/tbb/blocked_range.h"
+#include "oneapi/tbb/parallel_for.h"
+
+namespace {
+
+constexpr std::size_t kSequentialThreshold = 1 << 12;
+constexpr std::size_t kBucketsPerThread = 4;
+constexpr std::size_t kOversampling = 16;
+
+template <typename T>
+std::vector<T> PickSplitters(const std::vector<T>& data, std::size_t buckets) {
+  const std::size_t sample_size = std::min(data.size(), buckets * kOversampling);
+  std::mt19937_64 gen(data.size());
+  std::uniform_int_distribution<std::size_t> dist(0, data.size() - 1);
+
+  std::vector<T> sample(sample_size);
+  for (auto& s : sample) {
+    s = data[dist(gen)];
+  }
+  std::ranges::sort(sample);
+
+  std::vector<T> splitters;
+  splitters.reserve(buckets - 1);
+  for (std::size_t i = 1; i < buckets; ++i) {
+    const T& candidate = sample[(i * sample_size) / buckets];
+    if (splitters.empty() || splitters.back() < candidate) {
+      splitters.push_back(candidate);
+    }
+  }
+  return splitters;
+}
+
+// Buckets alternate between open intervals and single splitter values: bucket 2j holds keys lying
+// between splitters j-1 and j, bucket 2j+1 holds keys equal to splitter j and never needs sorting.
+template <typename T>
+std::uint32_t Classify(const std::vector<T>& splitters, const T& value) {
+  const auto it = std::ranges::lower_bound(splitters, value);
+  const auto j = static_cast<std::uint32_t>(it - splitters.begin());
+  return (it != splitters.end() && !(value < *it)) ? (2 * j) + 1 : 2 * j;
+}
+
+}  // namespace
+
+template <typename T>
+void nesterov_a_sample_sort_tbb::SampleSortTBB<T>::Sort(std::vector<T>& data, int num_threads) {
+  const std::size_t n = data.size();
+  if (num_threads <= 1 || n < kSequentialThreshold) {
+    std::ranges::sort(data);
+    return;
+  }
+
+  const auto splitters = PickSplitters(data, static_cast<std::size_t>(num_threads) * kBucketsPerThread);
+  const std::size_t num_buckets = (2 * splitters.size()) + 1;
+  const std::size_t chunk = (n + num_threads - 1) / num_threads;
+
+  std::vector<std::uint32_t> bucket_of(n);
+  // counts[(t * num_buckets) + b] is the number of keys of chunk t falling into bucket b
+  std::vector<std::size_t> counts(num_threads * num_buckets, 0);
+
+  oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<int>(0, num_threads, 1), [&](const auto& range) {
+    for (int t = range.begin(); t < range.end(); ++t) {
+      std::size_t* local = &counts[t * num_buckets];
+      const std::size_t last = std::min(n, (t + 1) * chunk);
+      for (std::size_t i = t * chunk; i < last; ++i) {
+        bucket_of[i] = Classify(splitters, data[i]);
+        ++local[bucket_of[i]];
+      }
+    }
+  });
+
+  std::vector<std::size_t> bucket_begin(num_buckets + 1, 0);
+  std::size_t sum = 0;
+  for (std::size_t b = 0; b < num_buckets; ++b) {
+    bucket_begin[b] = sum;
+    for (int t = 0; t < num_threads; ++t) {
+      const std::size_t cnt = counts[(t * num_buckets) + b];
+      counts[(t * num_buckets) + b] = sum;
+      sum += cnt;
+    }
+  }
+  bucket_begin[num_buckets] = n;
+
+  std::vector<T> buffer(n);
+  oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<int>(0, num_threads, 1), [&](const auto& range) {
+    for (int t = range.begin(); t < range.end(); ++t) {
+      std::size_t* pos = &counts[t * num_buckets];
+      const std::size_t last = std::min(n, (t + 1) * chunk);
+      for (std::size_t i = t * chunk; i < last; ++i) {
+        buffer[pos[bucket_of[i]]++] = data[i];
+      }
+    }
+  });
+
+  const std::size_t num_open_buckets = splitters.size() + 1;
+  oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, num_open_buckets, 1), [&](const auto& range) {
+    for (std::size_t j = range.begin(); j < range.end(); ++j) {
+      std::sort(buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[2 * j]),
+                buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[(2 * j) + 1]));
+    }
+  });
+
+  data.swap(buffer);
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_tbb::SampleSortTBB<T>::PreProcessingImpl() {
+  auto* in_ptr = reinterpret_cast<T*>(task_data->inputs[0]);
+  data_ = std::vector<T>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_tbb::SampleSortTBB<T>::ValidationImpl() {
+  return task_data->inputs.size() == 1 && task_data->outputs.size() == 1 &&
+         task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_tbb::SampleSortTBB<T>::RunImpl() {
+  Sort(data_, ppc::util::GetPPCNumThreads());
+  return true;
+}
+
+template <typename T>
+bool nesterov_a_sample_sort_tbb::SampleSortTBB<T>::PostProcessingImpl() {
+  std::ranges::copy(data_, reinterpret_cast<T*>(task_data->outputs[0]));
+  return true;
+}
+
+template class nesterov_a_sample_sort_tbb::SampleSortTBB<int>;
+template class nesterov_a_sample_sort_tbb::SampleSortTBB<std::int64_t>;
+template class nesterov_a_sample_sort_tbb::SampleSortTBB<double>;
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_io/include/sparse_io.hpp"
+#include "core/task/include/task.hpp"
+#include "tbb/nesterov_a_spmv/include/ops_tbb.hpp"
+
+namespace {
+
+constexpr ppc::core::SpmvFormat kFormats[] = {ppc::core::SpmvFormat::kCsr, ppc::core::SpmvFormat::kSell};
+
+// Row i holds lengths[i] entries at distinct random columns, or every column within `band` of the diagonal if band
+// is positive.
+ppc::core::CsrMatrix<double> GenerateMatrix(int rows, int cols, const std::vector<int> &lengths, int band,
+                                            unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> col_dist(0, cols - 1);
+  std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+  ppc::core::CsrMatrix<double> matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  for (int i = 0; i < rows; ++i) {
+    std::vector<int> row;
+    if (band > 0) {
+      for (int j = std::max(0, i - band); j <= std::min(cols - 1, i + band); ++j) {
+        row.push_back(j);
+      }
+    } else {
+      for (int k = 0; k < lengths[i]; ++k) {
+        row.push_back(col_dist(gen));
+      }
+      std::ranges::sort(row);
+      row.erase(std::ranges::unique(row).begin(), row.end());
+    }
+    for (const int j : row) {
+      matrix.col_idx.push_back(j);
+      matrix.values.push_back(value_dist(gen));
+    }
+    matrix.row_ptr.push_back(static_cast<int>(matrix.col_idx.size()));
+  }
+  return matrix;
+}
+
+std::vector<double> Reference(const ppc::core::CsrMatrix<double> &matrix, const std::vector<double> &x) {
+  std::vector<double> y(matrix.rows, 0.0);
+  for (int i = 0; i < matrix.rows; ++i) {
+    for (int e = matrix.row_ptr[i]; e < matrix.row_ptr[i + 1]; ++e) {
+      y[i] += matrix.values[e] * x[matrix.col_idx[e]];
+    }
+  }
+  return y;
+}
+
+void RunAndCheck(const ppc::core::CsrMatrix<double> &matrix,
+                 ppc::core::SparseIndexCoding coding = ppc::core::SparseIndexCoding::kPlain) {
+  std::vector<std::byte> encoded = ppc::core::EncodeSparse(matrix, coding);
+  std::mt19937 gen(static_cast<unsigned>(matrix.cols));
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> x(matrix.cols);
+  std::ranges::generate(x, [&] { return dist(gen); });
+  const std::vector<double> expected = Reference(matrix, x);
+
+  for (const auto format : kFormats) {
+    std::vector<double> y(matrix.rows, -1.0);
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(encoded.data()));
+    task_data_tbb->inputs_count.emplace_back(encoded.size());
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+    task_data_tbb->inputs_count.emplace_back(x.size());
+    task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(y.data()));
+    task_data_tbb->outputs_count.emplace_back(y.size());
+
+    nesterov_a_spmv_tbb::SpmvTBB test_task_tbb(task_data_tbb, format);
+    ASSERT_TRUE(test_task_tbb.Validation());
+    ASSERT_TRUE(test_task_tbb.PreProcessing());
+    ASSERT_TRUE(test_task_tbb.Run());
+    ASSERT_TRUE(test_task_tbb.PostProcessing());
+    for (std::size_t i = 0; i < y.size(); ++i) {
+      EXPECT_NEAR(y[i], expected[i], 1e-12) << "row " << i << ", format " << static_cast<int>(format);
+    }
+  }
+}
+
+std::vector<int> RandomLengths(int rows, int max_length, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, max_length);
+  std::vector<int> lengths(rows);
+  std::ranges::generate(lengths, [&] { return dist(gen); });
+  return lengths;
+}
+
+}  // namespace
+
+TEST(nesterov_a_spmv_tbb, test_random) { RunAndCheck(GenerateMatrix(500, 400, RandomLengths(500, 12, 1), 0, 2)); }
+
+TEST(nesterov_a_spmv_tbb, test_banded) { RunAndCheck(GenerateMatrix(1000, 1000, {}, 3, 3)); }
+
+TEST(nesterov_a_spmv_tbb, test_few_long_rows) {
+  // A handful of dense rows among short ones: the rows do not split evenly across threads or slices
+  std::vector<int> lengths(2000, 2);
+  for (int i = 0; i < 2000; i += 397) {
+    lengths[i] = 1500;
+  }
+  RunAndCheck(GenerateMatrix(2000, 1500, lengths, 0, 4));
+}
+
+TEST(nesterov_a_spmv_tbb, test_empty_rows) {
+  std::vector<int> lengths = RandomLengths(777, 9, 5);
+  for (std::size_t i = 0; i < lengths.size(); i += 3) {
+    lengths[i] = 0;
+  }
+  RunAndCheck(GenerateMatrix(777, 300, lengths, 0, 6));
+}
+
+TEST(nesterov_a_spmv_tbb, test_no_entries) { RunAndCheck(GenerateMatrix(40, 30, std::vector<int>(40, 0), 0, 7)); }
+
+TEST(nesterov_a_spmv_tbb, test_compressed_indices) {
+  RunAndCheck(GenerateMatrix(300, 5000, RandomLengths(300, 40, 8), 0, 9), ppc::core::SparseIndexCoding::kDeltaVarint);
+}
+
+TEST(nesterov_a_spmv_tbb, test_wrong_vector_size) {
+  const auto matrix = GenerateMatrix(20, 10, RandomLengths(20, 4, 10), 0, 11);
+  std::vector<std::byte> encoded = ppc::core::EncodeSparse(matrix);
+  std::vector<double> x(matrix.cols + 1, 1.0);
+  std::vector<double> y(matrix.rows);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(encoded.data()));
+  task_data_tbb->inputs_count.emplace_back(encoded.size());
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_tbb->inputs_count.emplace_back(x.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(y.data()));
+  task_data_tbb->outputs_count.emplace_back(y.size());
+
+  nesterov_a_spmv_tbb::SpmvTBB test_task_tbb(task_data_tbb, ppc::core::SpmvFormat::kSell);
+  EXPECT_FALSE(test_task_tbb.Validation());
+}
+
+TEST(nesterov_a_spmv_tbb, test_corrupt_indices) {
+  const auto matrix = GenerateMatrix(20, 10, RandomLengths(20, 4, 12), 0, 13);
+  std::vector<std::byte> encoded = ppc::core::EncodeSparse(matrix);
+  std::vector<double> x(matrix.cols, 1.0);
+  std::vector<double> y(matrix.rows);
+
+  // The header is intact, only a column index in the body points past the last column
+  const auto *indices = ppc::core::SparseFileView<double>(encoded.data(), encoded.size()).Indices().data();
+  const auto offset = reinterpret_cast<const std::byte *>(indices) - encoded.data();
+  const int far_column = 1000;
+  std::memcpy(encoded.data() + offset, &far_column, sizeof(far_column));
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(encoded.data()));
+  task_data_tbb->inputs_count.emplace_back(encoded.size());
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_tbb->inputs_count.emplace_back(x.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(y.data()));
+  task_data_tbb->outputs_count.emplace_back(y.size());
+
+  nesterov_a_spmv_tbb::SpmvTBB test_task_tbb(task_data_tbb);
+  EXPECT_FALSE(test_task_tbb.Validation());
+  EXPECT_FALSE(test_task_tbb.PreProcessingImpl());
+}
@@ -54,7 +54,7 @@ class HoareSortTest : public testing::TestWithParam<size_t> {
 TEST_P(HoareSortTest, sort_test) { CreateTest(GetParam()); }
 
 INSTANTIATE_TEST_SUITE_P(nikolaev_r_hoare_sort_simple_merge_seq, HoareSortTest,
-                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000));
+                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000, 300000));
 
 }  // namespace
 
@@ -120,3 +120,79 @@ TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_input_and_output_sizes_not_equ
   nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
   ASSERT_FALSE(hoare_sort_simple_merge_tbb.Validation());
 }
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_few_ascending_runs) {
+  std::vector<double> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<double>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Validation());
+  hoare_sort_simple_merge_tbb.PreProcessing();
+  hoare_sort_simple_merge_tbb.Run();
+  hoare_sort_simple_merge_tbb.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_non_increasing) {
+  std::vector<double> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<double>(500 - (i / 3));
+  }
+  std::vector<double> out(in.size());
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Validation());
+  hoare_sort_simple_merge_tbb.PreProcessing();
+  hoare_sort_simple_merge_tbb.Run();
+  hoare_sort_simple_merge_tbb.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_few_unique_values) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> dis(0, 3);
+  std::vector<double> in(200000);
+  for (auto &x : in) {
+    x = dis(gen);
+  }
+  std::vector<double> out(in.size(), 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Validation());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.PreProcessing());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Run());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.PostProcessing());
+
+  std::vector<double> ref(in.size());
+  std::ranges::copy(in, ref.begin());
+  std::ranges::sort(ref);
+
+  EXPECT_EQ(out, ref);
+}
@@ -23,6 +23,8 @@ class HoareSortSimpleMergeTBB : public ppc::core::Task {
   size_t vect_size_{};
 
   size_t Partition(size_t low, size_t high);
+  void IntroSort(size_t low, size_t high, int depth);
+  void ParallelQuickSort(size_t low, size_t high, int workers, int depth);
 };
 
 }  // namespace nikolaev_r_hoare_sort_simple_merge_tbb
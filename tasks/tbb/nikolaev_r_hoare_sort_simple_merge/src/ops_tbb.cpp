@@ -3,15 +3,39 @@
 #include <tbb/tbb.h>
 
 #include <algorithm>
+#include <bit>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <random>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
 
+namespace {
+
+constexpr std::size_t kParallelPartitionThreshold = 1 << 16;
+
+std::minstd_rand &PivotGenerator() {
+  thread_local std::minstd_rand gen(std::random_device{}());
+  return gen;
+}
+
+int DepthLimit(std::size_t n) { return 2 * static_cast<int>(std::bit_width(n)); }
+
+double MedianOfThree(const double *first, std::size_t n) {
+  std::uniform_int_distribution<std::size_t> dist(0, n - 1);
+  const double a = first[dist(PivotGenerator())];
+  const double b = first[dist(PivotGenerator())];
+  const double c = first[dist(PivotGenerator())];
+  return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+}  // namespace
+
 bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -26,41 +50,12 @@ bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::Validation
 }
 
 bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::RunImpl() {
-  size_t num_segments = ppc::util::GetPPCNumThreads();
-
-  num_segments = std::min(num_segments, vect_size_);
-
-  size_t segment_size = vect_size_ / num_segments;
-  size_t remainder = vect_size_ % num_segments;
-
-  std::vector<std::pair<size_t, size_t>> segments;
-  size_t start = 0;
-
-  for (size_t i = 0; i < num_segments; ++i) {
-    size_t current_segment_size = segment_size + (i < remainder ? 1 : 0);
-    size_t end = start + current_segment_size - 1;
-    segments.emplace_back(start, end);
-    start = end + 1;
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  oneapi::tbb::task_arena arena(num_threads);
+  if (ppc::core::SortIfPresorted(vect_, static_cast<std::size_t>(num_threads), ppc::core::TbbPartRunner(arena))) {
+    return true;
   }
-
-  oneapi::tbb::task_arena arena(static_cast<int>(num_segments));
-  arena.execute([this, &segments]() {
-    oneapi::tbb::task_group tg;
-
-    for (const auto &seg : segments) {
-      tg.run([this, seg]() { QuickSort(seg.first, seg.second); });
-    }
-
-    tg.wait();
-  });
-
-  size_t merged_end = segments[0].second;
-  for (size_t i = 1; i < segments.size(); ++i) {
-    std::inplace_merge(vect_.begin(), vect_.begin() + static_cast<std::vector<double>::difference_type>(merged_end + 1),
-                       vect_.begin() + static_cast<std::vector<double>::difference_type>(segments[i].second + 1));
-    merged_end = segments[i].second;
-  }
-
+  arena.execute([this, num_threads] { ParallelQuickSort(0, vect_size_ - 1, num_threads, DepthLimit(vect_size_)); });
   return true;
 }
 
@@ -72,11 +67,8 @@ bool nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::PostProces
 }
 
 size_t nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::Partition(size_t low, size_t high) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<int> dist(static_cast<int>(low), static_cast<int>(high));
-
-  size_t random_pivot_index = dist(gen);
+  std::uniform_int_distribution<size_t> dist(low, high);
+  size_t random_pivot_index = dist(PivotGenerator());
   double pivot = vect_[random_pivot_index];
 
   std::swap(vect_[random_pivot_index], vect_[low]);
@@ -97,9 +89,47 @@ void nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::QuickSort(
   if (low >= high) {
     return;
   }
+  IntroSort(low, high, DepthLimit(high - low + 1));
+}
+
+void nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::IntroSort(size_t low, size_t high, int depth) {
+  if (low >= high) {
+    return;
+  }
+  if (depth == 0) {
+    // Too many unbalanced partitions on this path: finish the range with heapsort
+    const auto first = vect_.begin() + static_cast<std::ptrdiff_t>(low);
+    const auto last = vect_.begin() + static_cast<std::ptrdiff_t>(high) + 1;
+    std::make_heap(first, last);
+    std::sort_heap(first, last);
+    return;
+  }
   size_t pivot = Partition(low, high);
   if (pivot > low) {
-    QuickSort(low, pivot - 1);
+    IntroSort(low, pivot - 1, depth - 1);
+  }
+  IntroSort(pivot + 1, high, depth - 1);
+}
+
+// The top levels partition with all available workers; the two halves then split the workers in proportion
+// to their sizes until a range is small enough, or has a single worker, to be finished sequentially.
+void nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB::ParallelQuickSort(size_t low, size_t high,
+                                                                                        int workers, int depth) {
+  const size_t n = high - low + 1;
+  if (workers <= 1 || n < kParallelPartitionThreshold || depth == 0) {
+    IntroSort(low, high, depth);
+    return;
+  }
+  double *first = vect_.data() + low;
+  const size_t split = ppc::core::ParallelPartition(first, n, MedianOfThree(first, n),
+                                                    static_cast<size_t>(workers), ppc::core::TbbPartRunner());
+  if (split == 0 || split == n) {
+    IntroSort(low, high, depth - 1);
+    return;
   }
-  QuickSort(pivot + 1, high);
+  const int left_workers = std::clamp(static_cast<int>(((workers * split) + (n / 2)) / n), 1, workers - 1);
+  oneapi::tbb::task_group tg;
+  tg.run([this, low, split, left_workers, depth] { ParallelQuickSort(low, low + split - 1, left_workers, depth - 1); });
+  ParallelQuickSort(low + split, high, workers - left_workers, depth - 1);
+  tg.wait();
 }
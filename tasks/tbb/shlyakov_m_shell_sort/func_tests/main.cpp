@@ -465,3 +465,51 @@ TEST(shlyakov_m_shell_sort_tbb, Test_With_False_Validation) {
   shlyakov_m_shell_sort_tbb::TestTaskTBB test_task_tbb(task_data_tbb);
   ASSERT_FALSE(test_task_tbb.Validation());
 }
+
+TEST(shlyakov_m_shell_sort_tbb, Test_Few_Ascending_Runs) {
+  std::vector<int> in;
+  for (int run = 0; run < 5; ++run) {
+    for (int i = 0; i < 400; ++i) {
+      in.push_back(static_cast<int>((i * 7) - (run * 100)));
+    }
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  shlyakov_m_shell_sort_tbb::TestTaskTBB test_task_tbb(task_data_tbb);
+  ASSERT_TRUE(test_task_tbb.Validation());
+  test_task_tbb.PreProcessing();
+  test_task_tbb.Run();
+  test_task_tbb.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
+
+TEST(shlyakov_m_shell_sort_tbb, Test_Non_Increasing) {
+  std::vector<int> in(1000);
+  for (int i = 0; i < static_cast<int>(in.size()); ++i) {
+    in[i] = static_cast<int>(500 - (i / 3));
+  }
+  std::vector<int> out(in.size());
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  shlyakov_m_shell_sort_tbb::TestTaskTBB test_task_tbb(task_data_tbb);
+  ASSERT_TRUE(test_task_tbb.Validation());
+  test_task_tbb.PreProcessing();
+  test_task_tbb.Run();
+  test_task_tbb.PostProcessing();
+
+  std::ranges::sort(in);
+  EXPECT_EQ(in, out);
+}
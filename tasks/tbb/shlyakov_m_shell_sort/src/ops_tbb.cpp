@@ -9,6 +9,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+
 namespace shlyakov_m_shell_sort_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -28,6 +31,12 @@ bool TestTaskTBB::RunImpl() {
     return true;
   }
 
+  if (ppc::core::SortIfPresorted(input_, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()),
+                                 ppc::core::TbbPartRunner())) {
+    output_ = input_;
+    return true;
+  }
+
   const int max_threads = ppc::util::GetPPCNumThreads();
   int threads = std::min(max_threads, n);
   const int seg_size = (n + threads - 1) / threads;
@@ -115,4 +124,4 @@ bool TestTaskTBB::PostProcessingImpl() {
   return true;
 }
 
-}  // namespace shlyakov_m_shell_sort_tbb
\ No newline at end of file
+}  // namespace shlyakov_m_shell_sort_tbb
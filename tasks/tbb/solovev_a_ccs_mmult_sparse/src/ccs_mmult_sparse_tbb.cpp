@@ -2,10 +2,42 @@
 
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 
+#include <algorithm>
 #include <complex>
+#include <cstddef>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+// The first c_n columns of matrix, which are all that the multiplication reads of it
+ppc::core::SplitCscMatrix<double> ToSplit(const solovev_a_matrix_tbb::MatrixInCcsSparse& matrix) {
+  ppc::core::CscMatrix<std::complex<double>> csc;
+  csc.rows = matrix.r_n;
+  csc.cols = matrix.c_n;
+  csc.col_ptr.assign(matrix.col_p.begin(), matrix.col_p.begin() + matrix.c_n + 1);
+  csc.row_idx.assign(matrix.row.begin(), matrix.row.begin() + csc.col_ptr.back());
+  csc.values.assign(matrix.val.begin(), matrix.val.begin() + csc.col_ptr.back());
+  return ppc::core::SplitCscMatrix<double>::FromInterleaved(csc);
+}
+
+void StoreProduct(const ppc::core::SplitCscMatrix<double>& product, solovev_a_matrix_tbb::MatrixInCcsSparse& result) {
+  result.r_n = product.rows;
+  result.c_n = product.cols;
+  result.n_z = static_cast<int>(product.NonZeros());
+  result.col_p = product.col_ptr;
+  result.row = product.row_idx;
+  result.val.resize(product.NonZeros());
+  for (std::size_t i = 0; i < product.NonZeros(); ++i) {
+    result.val[i] = {product.real[i], product.imag[i]};
+  }
+}
+}  // namespace
+
 void solovev_a_matrix_tbb::TBBMatMultCcs::ComputeColumnSizes() {
   tbb::parallel_for(tbb::blocked_range<int>(0, M3_->c_n), [&](const tbb::blocked_range<int>& r) {
     for (int m2_c = r.begin(); m2_c != r.end(); ++m2_c) {
@@ -59,6 +91,10 @@ bool solovev_a_matrix_tbb::TBBMatMultCcs::PreProcessingImpl() {
   M1_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[0]);
   M2_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->inputs[1]);
   M3_ = reinterpret_cast<MatrixInCcsSparse*>(task_data->outputs[0]);
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    split_m1_ = ToSplit(*M1_);
+    split_m2_ = ToSplit(*M2_);
+  }
   return true;
 }
 
@@ -69,6 +105,13 @@ bool solovev_a_matrix_tbb::TBBMatMultCcs::ValidationImpl() {
 }
 
 bool solovev_a_matrix_tbb::TBBMatMultCcs::RunImpl() {
+  if (storage_ == ppc::core::ComplexStorage::kSplit) {
+    const auto parts = static_cast<std::size_t>(std::max(1, ppc::util::GetPPCNumThreads()));
+    oneapi::tbb::task_arena arena(static_cast<int>(parts));
+    const ppc::core::TbbPartRunner run(arena);
+    StoreProduct(split_m1_.Multiply(split_m2_, parts, run), *M3_);
+    return true;
+  }
   M3_->r_n = M1_->r_n;
   M3_->c_n = M2_->c_n;
   M3_->col_p.resize(M3_->c_n + 1);
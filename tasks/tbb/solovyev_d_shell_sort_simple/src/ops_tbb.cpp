@@ -2,10 +2,15 @@
 
 #include <oneapi/tbb/parallel_for.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+#include "core/util/include/util.hpp"
+
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -19,6 +24,10 @@ bool solovyev_d_shell_sort_simple_tbb::TaskTBB::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_tbb::TaskTBB::RunImpl() {
+  if (ppc::core::SortIfPresorted(input_, static_cast<std::size_t>(ppc::util::GetPPCNumThreads()),
+                                 ppc::core::TbbPartRunner())) {
+    return true;
+  }
   for (int gap = static_cast<int>(input_.size()) / 2; gap > 0; gap /= 2) {
     tbb::parallel_for(0, gap, [this, gap](int i) {
       for (size_t f = gap + i; f < input_.size(); f += gap) {
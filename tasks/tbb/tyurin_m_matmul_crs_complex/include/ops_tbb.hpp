@@ -5,6 +5,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse_order/include/sparse_order.hpp"
 #include "core/task/include/task.hpp"
 
 struct Matrix {
@@ -84,17 +86,35 @@ inline Matrix CRSToRegular(const MatrixCRS& crs) {
 
 namespace tyurin_m_matmul_crs_complex_tbb {
 
+// With ComplexStorage::kSplit the product is formed on split real and imaginary arrays by the SIMD kernels of
+// ppc::core::SplitCsrMatrix; the result is the same either way.
+// A square left matrix can be reordered first: with PA P^T and PB the product comes out as PC, whose rows are put
+// back in PostProcessing. A bandwidth-reducing ordering keeps the rows of B a row of the product gathers close to
+// each other. BandBefore() and BandAfter() report the bandwidth and profile of the left matrix around it.
 class TestTaskTbb : public ppc::core::Task {
  public:
-  explicit TestTaskTbb(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  explicit TestTaskTbb(ppc::core::TaskDataPtr task_data,
+                       ppc::core::ComplexStorage storage = ppc::core::ComplexStorage::kInterleaved,
+                       ppc::core::SparseOrdering ordering = ppc::core::SparseOrdering::kNatural)
+      : Task(std::move(task_data)), storage_(storage), ordering_(ordering) {}
   bool ValidationImpl() override;
   bool PreProcessingImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  [[nodiscard]] ppc::core::BandProfile BandBefore() const { return band_before_; }
+  [[nodiscard]] ppc::core::BandProfile BandAfter() const { return band_after_; }
+
  private:
-  MatrixCRS lhs_;
-  MatrixCRS rhs_;
+  ppc::core::ComplexStorage storage_;
+  ppc::core::SparseOrdering ordering_;
+  std::vector<int> perm_;
+  ppc::core::BandProfile band_before_;
+  ppc::core::BandProfile band_after_;
+  ppc::core::CsrMatrix<std::complex<double>> lhs_;
+  ppc::core::CsrMatrix<std::complex<double>> rhs_;
+  ppc::core::SplitCsrMatrix<double> split_lhs_;
+  ppc::core::SplitCsrMatrix<double> split_rhs_;
   MatrixCRS res_;
 };
 
@@ -5,9 +5,14 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_tbb {
+// Instantiated for double, float and float inputs with double accumulation (T = float, AccT = double).
+// With an array of three ppc::core::MatrixDesc in inputs[2] (A, B, C) the operands are views of the buffers, e.g. a
+// transposed or column-major matrix or a block of a larger one, and are used without copying.
+template <typename T, typename AccT = T>
 class CannonTBB : public ppc::core::Task {
  public:
   explicit CannonTBB(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
@@ -21,14 +26,33 @@ class CannonTBB : public ppc::core::Task {
   int N_;
   int block_size_;
   int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
-
-  void InitialShift();
-  void BlockMultiply();
-  void ShiftBlocks();
-  void CopyBlocksToLocal(std::vector<double>& a_block, std::vector<double>& b_block, int base_row, int base_col);
-  void ComputeBlock(const std::vector<double>& a_block, const std::vector<double>& b_block, int base_row, int base_col);
+  const T *A_{};
+  const T *B_{};
+  std::vector<AccT> C_;
+  ppc::core::MatrixDesc desc_a_;
+  ppc::core::MatrixDesc desc_b_;
+  ppc::core::MatrixDesc desc_c_;
+
+  void BlockMultiply(int step);
+};
+
+// C_i = A_i * B_i for a batch of n x n matrices laid out one after another. TBB hands out ranges of the batch, so a
+// product is never split and small ones cost no synchronization. Inputs as for CannonTBB, inputs_count[2] being n.
+template <typename T>
+class BatchedMatMulTBB : public ppc::core::Task {
+ public:
+  explicit BatchedMatMulTBB(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  int N_;
+  int batch_size_;
+  std::vector<T> A_;
+  std::vector<T> B_;
+  std::vector<T> C_;
 };
 }  // namespace vavilov_v_cannon_tbb
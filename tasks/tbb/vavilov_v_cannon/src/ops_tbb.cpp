@@ -1,151 +1,174 @@
 #include "tbb/vavilov_v_cannon/include/ops_tbb.hpp"
 
+#include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/blocked_range2d.h>
 #include <oneapi/tbb/parallel_for.h>
-#include <tbb/tbb.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/batched_gemm/include/batched_gemm.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+#include "core/tuning/include/tuning.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/task_arena.h"
 
-bool vavilov_v_cannon_tbb::CannonTBB::PreProcessingImpl() {
-  N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  num_blocks_ = static_cast<int>(task_data->inputs_count[2]);
-  block_size_ = N_ / num_blocks_;
+namespace {
 
-  auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
-  auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+// Descriptors of A, B and C if the caller passed them in inputs[2]
+const ppc::core::MatrixDesc *Layouts(const ppc::core::TaskData &data) {
+  return data.inputs.size() > 2 ? reinterpret_cast<const ppc::core::MatrixDesc *>(data.inputs[2]) : nullptr;
+}
 
+// All three views are n x n and stay inside their buffers.
+bool ValidLayouts(const ppc::core::TaskData &data, const ppc::core::MatrixDesc *layouts) {
+  const std::size_t n = layouts[0].rows;
+  const std::array<std::size_t, 3> sizes = {data.inputs_count[0], data.inputs_count[1], data.outputs_count[0]};
+  for (std::size_t i = 0; i < sizes.size(); ++i) {
+    if (!layouts[i].IsValid() || layouts[i].rows != n || layouts[i].cols != n || layouts[i].Span() > sizes[i]) {
+      return false;
+    }
+  }
   return true;
 }
 
-bool vavilov_v_cannon_tbb::CannonTBB::ValidationImpl() {
-  if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
-      task_data->outputs_count[0] != task_data->inputs_count[0]) {
-    return false;
+}  // namespace
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_tbb::CannonTBB<T, AccT>::PreProcessingImpl() {
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    desc_a_ = layouts[0];
+    desc_b_ = layouts[1];
+    desc_c_ = layouts[2];
+  } else {
+    const auto n = static_cast<std::size_t>(std::sqrt(task_data->inputs_count[0]));
+    desc_a_ = desc_b_ = desc_c_ = ppc::core::RowMajorDesc(n, n);
+  }
+  N_ = static_cast<int>(desc_a_.rows);
+  num_blocks_ = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  if (num_blocks_ == 0) {
+    const auto block = static_cast<int>(ppc::core::NearestDivisor(N_, ppc::core::TunedMatrixBlockSize()));
+    num_blocks_ = std::max<int>(N_ / block, 1);
   }
+  block_size_ = N_ / num_blocks_;
 
-  auto n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
-  auto num_blocks = static_cast<int>(task_data->inputs_count[2]);
-  return n % num_blocks == 0;
-}
+  A_ = reinterpret_cast<const T *>(task_data->inputs[0]);
+  B_ = reinterpret_cast<const T *>(task_data->inputs[1]);
+  C_.assign(N_ * N_, 0);
 
-void vavilov_v_cannon_tbb::CannonTBB::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  tbb::parallel_for(tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_), [&](const tbb::blocked_range2d<int>& r) {
-    for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
-      for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-        int src_row = (bi + bj) % num_blocks_;
-        int src_col = (bj + bi) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
-    }
-  });
+  return true;
 }
 
-void vavilov_v_cannon_tbb::CannonTBB::CopyBlocksToLocal(std::vector<double>& a_block, std::vector<double>& b_block,
-                                                        int base_row, int base_col) {
-  for (int i = 0; i < block_size_ && base_row + i < N_; ++i) {
-    for (int k = 0; k < block_size_ && base_col + k < N_; ++k) {
-      a_block[(i * block_size_) + k] = A_[((base_row + i) * N_) + (base_col + k)];
-      b_block[(k * block_size_) + i] = B_[((base_row + k) * N_) + (base_col + i)];
+template <typename T, typename AccT>
+bool vavilov_v_cannon_tbb::CannonTBB<T, AccT>::ValidationImpl() {
+  int n = 0;
+  if (const ppc::core::MatrixDesc *layouts = Layouts(*task_data)) {
+    if (!ValidLayouts(*task_data, layouts)) {
+      return false;
     }
-  }
-}
-
-void vavilov_v_cannon_tbb::CannonTBB::ComputeBlock(const std::vector<double>& a_block,
-                                                   const std::vector<double>& b_block, int base_row, int base_col) {
-  for (int i = 0; i < block_size_ && base_row + i < N_; ++i) {
-    int row = base_row + i;
-    for (int j = 0; j < block_size_ && base_col + j < N_; ++j) {
-      int col = base_col + j;
-      double temp = 0.0;
-      int k = 0;
-
-      for (; k <= block_size_ - 4; k += 4) {
-        temp += a_block[(i * block_size_) + k] * b_block[(k * block_size_) + j] +
-                a_block[(i * block_size_) + k + 1] * b_block[((k + 1) * block_size_) + j] +
-                a_block[(i * block_size_) + k + 2] * b_block[((k + 2) * block_size_) + j] +
-                a_block[(i * block_size_) + k + 3] * b_block[((k + 3) * block_size_) + j];
-      }
-
-      for (; k < block_size_ && base_row + k < N_; ++k) {
-        temp += a_block[(i * block_size_) + k] * b_block[(k * block_size_) + j];
-      }
-
-      C_[(row * N_) + col] += temp;
+    n = static_cast<int>(layouts[0].rows);
+  } else {
+    if (task_data->inputs_count[0] != task_data->inputs_count[1] ||
+        task_data->outputs_count[0] != task_data->inputs_count[0]) {
+      return false;
     }
+    n = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
   }
+  // Without a block count, or with 0, PreProcessing picks one from the tuned block size
+  auto num_blocks = task_data->inputs_count.size() > 2 ? static_cast<int>(task_data->inputs_count[2]) : 0;
+  return num_blocks == 0 || n % num_blocks == 0;
 }
 
-void vavilov_v_cannon_tbb::CannonTBB::BlockMultiply() {
+// Instead of rotating A left and B up after every step, block (bi, bj) reads A(bi, k) and B(k, bj) with
+// k = (bi + bj + step) mod num_blocks.
+template <typename T, typename AccT>
+void vavilov_v_cannon_tbb::CannonTBB<T, AccT>::BlockMultiply(int step) {
+  const ppc::core::MatrixDesc block_a = desc_a_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_b = desc_b_.Block(block_size_, block_size_);
+  const ppc::core::MatrixDesc block_c = ppc::core::RowMajorDesc(N_, N_).Block(block_size_, block_size_);
   oneapi::tbb::parallel_for(
       oneapi::tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_),
-      [&](const oneapi::tbb::blocked_range2d<int>& r) {
-        std::vector<double> a_block(block_size_ * block_size_);
-        std::vector<double> b_block(block_size_ * block_size_);
-
+      [&](const oneapi::tbb::blocked_range2d<int> &r) {
         for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
           for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-            int base_row = bi * block_size_;
-            int base_col = bj * block_size_;
-
-            CopyBlocksToLocal(a_block, b_block, base_row, base_col);
-            ComputeBlock(a_block, b_block, base_row, base_col);
+            const int k = (bi + bj + step) % num_blocks_;
+            ppc::core::Gemm(block_a, A_ + desc_a_.Offset(bi * block_size_, k * block_size_), block_b,
+                            B_ + desc_b_.Offset(k * block_size_, bj * block_size_), block_c,
+                            &C_[(bi * block_size_ * N_) + (bj * block_size_)]);
           }
         }
       },
       oneapi::tbb::auto_partitioner());
 }
 
-void vavilov_v_cannon_tbb::CannonTBB::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-  tbb::parallel_for(tbb::blocked_range2d<int>(0, num_blocks_, 0, num_blocks_), [&](const tbb::blocked_range2d<int>& r) {
-    for (int bi = r.rows().begin(); bi != r.rows().end(); ++bi) {
-      for (int bj = r.cols().begin(); bj != r.cols().end(); ++bj) {
-        int src_row = (bi + 1) % num_blocks_;
-        int src_col = (bj + 1) % num_blocks_;
-        for (int i = 0; i < block_size_; ++i) {
-          for (int j = 0; j < block_size_; ++j) {
-            B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-            A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-                a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-          }
-        }
-      }
+template <typename T, typename AccT>
+bool vavilov_v_cannon_tbb::CannonTBB<T, AccT>::RunImpl() {
+  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  arena.execute([&]() {
+    for (int iter = 0; iter < num_blocks_; ++iter) {
+      BlockMultiply(iter);
     }
   });
+  return true;
+}
+
+template <typename T, typename AccT>
+bool vavilov_v_cannon_tbb::CannonTBB<T, AccT>::PostProcessingImpl() {
+  ppc::core::CopyToMatrix(C_.data(), desc_c_, reinterpret_cast<AccT *>(task_data->outputs[0]));
+  return true;
+}
+
+template <typename T>
+bool vavilov_v_cannon_tbb::BatchedMatMulTBB<T>::PreProcessingImpl() {
+  N_ = static_cast<int>(task_data->inputs_count[2]);
+  batch_size_ = static_cast<int>(task_data->inputs_count[0] / (N_ * N_));
+
+  auto *a = reinterpret_cast<T *>(task_data->inputs[0]);
+  auto *b = reinterpret_cast<T *>(task_data->inputs[1]);
+  A_.assign(a, a + task_data->inputs_count[0]);
+  B_.assign(b, b + task_data->inputs_count[1]);
+  C_.assign(task_data->outputs_count[0], 0);
+
+  return true;
 }
 
-bool vavilov_v_cannon_tbb::CannonTBB::RunImpl() {
+template <typename T>
+bool vavilov_v_cannon_tbb::BatchedMatMulTBB<T>::ValidationImpl() {
+  if (task_data->inputs_count.size() < 3 || task_data->inputs_count[0] != task_data->inputs_count[1] ||
+      task_data->outputs_count[0] != task_data->inputs_count[0]) {
+    return false;
+  }
+
+  auto n = task_data->inputs_count[2];
+  return n > 0 && task_data->inputs_count[0] % (n * n) == 0;
+}
+
+template <typename T>
+bool vavilov_v_cannon_tbb::BatchedMatMulTBB<T>::RunImpl() {
+  const auto stride = static_cast<std::size_t>(N_) * N_;
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
-  arena.execute([&]() {
-    InitialShift();
-    for (int iter = 0; iter < num_blocks_; ++iter) {
-      BlockMultiply();
-      ShiftBlocks();
-    }
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<std::size_t>(0, batch_size_), [&](const auto &r) {
+      const std::size_t offset = r.begin() * stride;
+      ppc::core::GemmStridedBatched(r.size(), N_, N_, N_, A_.data() + offset, N_, stride, B_.data() + offset, N_,
+                                    stride, C_.data() + offset, N_, stride);
+    });
   });
   return true;
 }
 
-bool vavilov_v_cannon_tbb::CannonTBB::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double*>(task_data->outputs[0]));
+template <typename T>
+bool vavilov_v_cannon_tbb::BatchedMatMulTBB<T>::PostProcessingImpl() {
+  std::ranges::copy(C_, reinterpret_cast<T *>(task_data->outputs[0]));
   return true;
 }
+
+template class vavilov_v_cannon_tbb::CannonTBB<double>;
+template class vavilov_v_cannon_tbb::CannonTBB<float>;
+template class vavilov_v_cannon_tbb::CannonTBB<float, double>;
+template class vavilov_v_cannon_tbb::BatchedMatMulTBB<double>;
+template class vavilov_v_cannon_tbb::BatchedMatMulTBB<float>;
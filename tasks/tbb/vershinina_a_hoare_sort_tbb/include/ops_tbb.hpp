@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -7,6 +8,15 @@
 
 namespace vershinina_a_hoare_sort_tbb {
 
+// Selection primitives for callers that need only a rank or the extremes instead of the fully sorted array.
+// Rearranges data so that data[k] is the element a full sort would put there, with no greater element
+// before it and no smaller one after it; does nothing when k is out of range.
+void NthElement(std::vector<double> &data, std::size_t k);
+// Sorts the k smallest elements into data[0, k); the order of the rest is unspecified.
+void PartialSort(std::vector<double> &data, std::size_t k);
+// Returns the k largest elements in descending order.
+std::vector<double> TopK(const std::vector<double> &data, std::size_t k);
+
 class TestTaskTBB : public ppc::core::Task {
  public:
   explicit TestTaskTBB(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
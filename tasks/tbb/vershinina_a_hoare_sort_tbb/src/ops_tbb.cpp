@@ -5,9 +5,12 @@
 #include <algorithm>
 #include <cmath>
 #include <core/util/include/util.hpp>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/sort.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
 #include "oneapi/tbb/blocked_range.h"
 #include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
@@ -61,6 +64,29 @@ void BatcherMerge(int thread_input_size, std::vector<double *> &pointers, std::v
     }
   }
 }
+// Sorts [data, data + n): blocks are sorted by HoareSort in parallel and then merged by BatcherMerge.
+void HoareSortParallel(double *data, int n) {
+  const auto numthreads = std::min(n, ppc::util::GetPPCNumThreads());
+  int thread_input_size = n / numthreads;
+  int thread_input_remainder_size = n % numthreads;
+
+  std::vector<double *> pointers(numthreads);
+  std::vector<int> sizes(numthreads);
+  for (int i = 0; i < numthreads; i++) {
+    pointers[i] = data + (i * thread_input_size);
+    sizes[i] = thread_input_size;
+  }
+  sizes[sizes.size() - 1] += thread_input_remainder_size;
+  tbb::task_arena arena(numthreads);
+  arena.execute([&] {
+    tbb::parallel_for(tbb::blocked_range<int>(0, numthreads, 1), [&pointers, &sizes](const auto &r) {
+      for (int i = r.begin(); i < r.end(); i++) {
+        HoareSort(pointers[i], 0, sizes[i] - 1);
+      }
+    });
+  });
+  BatcherMerge(thread_input_size, pointers, sizes, 32);
+}
 }  // namespace
 bool vershinina_a_hoare_sort_tbb::TestTaskTBB::PreProcessingImpl() {
   input_.assign(reinterpret_cast<double *>(task_data->inputs[0]),
@@ -80,27 +106,13 @@ bool vershinina_a_hoare_sort_tbb::TestTaskTBB::RunImpl() {
   }
   res_.resize(input_.size());
   std::ranges::copy(input_, res_.begin());
-
-  const auto numthreads = std::min(n, ppc::util::GetPPCNumThreads());
-  int thread_input_size = n / numthreads;
-  int thread_input_remainder_size = n % numthreads;
-
-  std::vector<double *> pointers(numthreads);
-  std::vector<int> sizes(numthreads);
-  for (int i = 0; i < numthreads; i++) {
-    pointers[i] = res_.data() + (i * thread_input_size);
-    sizes[i] = thread_input_size;
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  tbb::task_arena arena(num_threads);
+  if (ppc::core::SortIfPresorted(res_, static_cast<std::size_t>(num_threads), ppc::core::TbbPartRunner(arena))) {
+    return true;
   }
-  sizes[sizes.size() - 1] += thread_input_remainder_size;
-  tbb::task_arena arena(numthreads);
-  arena.execute([&] {
-    tbb::parallel_for(tbb::blocked_range<int>(0, numthreads, 1), [&pointers, &sizes](const auto &r) {
-      for (int i = r.begin(); i < r.end(); i++) {
-        HoareSort(pointers[i], 0, sizes[i] - 1);
-      }
-    });
-  });
-  BatcherMerge(thread_input_size, pointers, sizes, 32);
+
+  HoareSortParallel(res_.data(), n);
   return true;
 }
 
@@ -108,3 +120,21 @@ bool vershinina_a_hoare_sort_tbb::TestTaskTBB::PostProcessingImpl() {
   std::ranges::copy(res_, reinterpret_cast<double *>(task_data->outputs[0]));
   return true;
 }
+
+void vershinina_a_hoare_sort_tbb::NthElement(std::vector<double> &data, std::size_t k) {
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  tbb::task_arena arena(num_threads);
+  ppc::core::NthElement(data, k, static_cast<std::size_t>(num_threads), ppc::core::TbbPartRunner(arena));
+}
+
+void vershinina_a_hoare_sort_tbb::PartialSort(std::vector<double> &data, std::size_t k) {
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  tbb::task_arena arena(num_threads);
+  ppc::core::PartialSort(data, k, static_cast<std::size_t>(num_threads), ppc::core::TbbPartRunner(arena));
+}
+
+std::vector<double> vershinina_a_hoare_sort_tbb::TopK(const std::vector<double> &data, std::size_t k) {
+  const int num_threads = ppc::util::GetPPCNumThreads();
+  tbb::task_arena arena(num_threads);
+  return ppc::core::TopK(data, k, static_cast<std::size_t>(num_threads), ppc::core::TbbPartRunner(arena));
+}
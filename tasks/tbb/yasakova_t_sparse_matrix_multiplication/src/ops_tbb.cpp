@@ -10,6 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse.hpp"
+#include "core/sparse/include/tbb_part_runner.hpp"
+
 void yasakova_t_sparse_matrix_multiplication::CompressedRowStorageMatrix::InsertElement(int row, ComplexNumber value,
                                                                                         int col) {
   bool found = false;
@@ -150,32 +153,29 @@ bool yasakova_t_sparse_matrix_multiplication::TestTaskTBB::ValidationImpl() {
 }
 
 bool yasakova_t_sparse_matrix_multiplication::TestTaskTBB::RunImpl() {
-  CompressedRowStorageMatrix expected_result(firstMatrix_.rowCount, secondMatrix_.columnCount);
-
-  std::vector<std::vector<std::pair<int, ComplexNumber>>> local_results(firstMatrix_.rowCount);
-
-  tbb::parallel_for(
-      tbb::blocked_range<unsigned int>(0, firstMatrix_.rowCount), [&](const tbb::blocked_range<unsigned int>& r) {
-        for (unsigned int i = r.begin(); i < r.end(); ++i) {
-          for (unsigned int j = firstMatrix_.rowPointers[i]; j < (unsigned int)firstMatrix_.rowPointers[i + 1]; ++j) {
-            unsigned int col_a = firstMatrix_.columnIndices[j];
-            ComplexNumber value_a = firstMatrix_.nonZeroValues[j];
-            for (unsigned int k = secondMatrix_.rowPointers[col_a];
-                 k < (unsigned int)secondMatrix_.rowPointers[col_a + 1]; ++k) {
-              unsigned int col_b = secondMatrix_.columnIndices[k];
-              ComplexNumber value_b = secondMatrix_.nonZeroValues[k];
-              local_results[i].emplace_back(col_b, value_a * value_b);
-            }
-          }
+  // Every worker appends the products of its rows to a buffer of its own; the builder then sums them in parallel
+  const int num_threads = tbb::this_task_arena::max_concurrency();
+  ppc::core::TripletBuilder<ComplexNumber> builder(firstMatrix_.rowCount, secondMatrix_.columnCount, num_threads);
+
+  tbb::parallel_for(tbb::blocked_range<int>(0, firstMatrix_.rowCount), [&](const tbb::blocked_range<int>& r) {
+    const auto buffer = static_cast<std::size_t>(tbb::this_task_arena::current_thread_index());
+    for (int i = r.begin(); i < r.end(); ++i) {
+      for (int j = firstMatrix_.rowPointers[i]; j < firstMatrix_.rowPointers[i + 1]; ++j) {
+        const int col_a = firstMatrix_.columnIndices[j];
+        const ComplexNumber value_a = firstMatrix_.nonZeroValues[j];
+        for (int k = secondMatrix_.rowPointers[col_a]; k < secondMatrix_.rowPointers[col_a + 1]; ++k) {
+          builder.Add(i, secondMatrix_.columnIndices[k], value_a * secondMatrix_.nonZeroValues[k], buffer);
         }
-      });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      expected_result.InsertElement(static_cast<int>(row_index), value, col_index);
+      }
     }
-  }
+  });
 
+  const ppc::core::TbbPartRunner run;
+  ppc::core::CsrMatrix<ComplexNumber> product = builder.BuildCsr(num_threads, run);
+  CompressedRowStorageMatrix expected_result(firstMatrix_.rowCount, secondMatrix_.columnCount);
+  expected_result.nonZeroValues = std::move(product.values);
+  expected_result.columnIndices = std::move(product.col_idx);
+  expected_result.rowPointers = std::move(product.row_ptr);
   resultData_ = ConvertMatrixToVector(expected_result);
 
   return true;